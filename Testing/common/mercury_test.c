@@ -68,6 +68,8 @@ hg_test_usage(const char *execname)
     printf("    -B, --bidirectional Bidirectional communication\n");
     printf("    -u, --mrecv-ops     Number of multi-recv ops (server only)\n");
     printf("    -i, --post-init     Number of handles posted (server only)\n");
+    printf("    -K, --bulk-chunk    Bulk transfer chunk size (0 to disable)\n");
+    printf("    -W, --bulk-window   Max number of bulk chunks in flight\n");
 }
 
 /*---------------------------------------------------------------------------*/
@@ -110,6 +112,14 @@ hg_test_parse_options(int argc, char *argv[], struct hg_test_info *hg_test_info)
                 hg_test_info->request_post_init =
                     (unsigned int) atoi(na_test_opt_arg_g);
                 break;
+            case 'K': /* bulk_chunk_size */
+                hg_test_info->bulk_chunk_size =
+                    (size_t) atol(na_test_opt_arg_g);
+                break;
+            case 'W': /* bulk_chunk_window */
+                hg_test_info->bulk_chunk_window =
+                    (unsigned int) atoi(na_test_opt_arg_g);
+                break;
             default:
                 break;
         }
@@ -229,6 +239,10 @@ HG_Test_init(int argc, char *argv[], struct hg_test_info *hg_test_info)
         /* Post init */
         hg_init_info.request_post_init = hg_test_info->request_post_init;
 
+        /* Bulk chunks */
+        hg_init_info.bulk_chunk_size = hg_test_info->bulk_chunk_size;
+        hg_init_info.bulk_chunk_window = hg_test_info->bulk_chunk_window;
+
         /* Init HG with init options */
         hg_test_info->hg_classes[i] =
             HG_Init_opt2(NULL, hg_test_info->na_test_info.listen,
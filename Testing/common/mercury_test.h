@@ -24,6 +24,8 @@ struct hg_test_info {
     unsigned int thread_count;        /* Max number of threads */
     unsigned int multi_recv_op_max;   /* Max number of multi-recv ops */
     unsigned int request_post_init;   /* Init number of posted handles */
+    size_t bulk_chunk_size;           /* Bulk chunk size */
+    unsigned int bulk_chunk_window;   /* Max number of bulk chunks in flight */
     hg_bool_t auto_sm;                /* Use shared-memory */
     hg_bool_t bidirectional;          /* Bidirectional tests */
 };
@@ -119,6 +119,7 @@ na_test_usage(const char *execname)
     printf("    -R, --force-register Force registration of buffers\n");
     printf("    -M, --mbps           Output in MB/s instead of MiB/s\n");
     printf("    -U, --no-multi-recv  Disable multi-recv\n");
+    printf("    -A, --mem-alloc      Allocate RMA buffers through NA\n");
     printf("    -f, --hostfile       Specify hostfile to use\n"
            "                         Default: " HG_TEST_TEMP_DIRECTORY
                HG_TEST_CONFIG_FILE_NAME "\n");
@@ -216,6 +217,9 @@ na_test_parse_options(int argc, char *argv[], struct na_test_info *na_test_info)
             case 'U': /* no-multi-recv */
                 na_test_info->no_multi_recv = true;
                 break;
+            case 'A': /* mem-alloc */
+                na_test_info->mem_alloc = true;
+                break;
             case 'f': /* hostfile */
                 na_test_info->hostfile = strdup(na_test_opt_arg_g);
                 break;
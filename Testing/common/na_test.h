@@ -61,6 +61,7 @@ struct na_test_info {
     bool verify;         /* Verify data */
     bool mbps;           /* OSU-style of output in MB/s */
     bool no_multi_recv;  /* Disable multi-recv */
+    bool mem_alloc;      /* Allocate RMA buffers with NA_Mem_alloc() */
 };
 
 /*****************/
@@ -15,7 +15,7 @@
 int na_test_opt_ind_g = 1;            /* token pointer */
 const char *na_test_opt_arg_g = NULL; /* flag argument (or value) */
 const char *na_test_short_opt_g =
-    "hc:d:p:H:P:sSk:l:bC:X:VZ:y:z:w:x:mt:BRvMUf:T:u:i:";
+    "hc:d:p:H:P:sSk:l:bC:X:VZ:y:z:w:x:mt:BRvMUAf:T:u:i:K:W:";
 /* clang-format off */
 const struct na_test_opt na_test_opt_g[] = {
     {"help", no_arg, 'h'},
@@ -44,10 +44,13 @@ const struct na_test_opt na_test_opt_g[] = {
     {"verify", no_arg, 'v'},
     {"millionbps", no_arg, 'M'},
     {"no-multi-recv", no_arg, 'U'},
+    {"mem-alloc", no_arg, 'A'},
     {"hostfile", require_arg, 'f'},
     {"tclass", require_arg, 'T'},
     {"mrecv-ops", require_arg, 'u'},
     {"post-init", require_arg, 'i'},
+    {"bulk-chunk", require_arg, 'K'},
+    {"bulk-window", require_arg, 'W'},
     {NULL, 0, '\0'} /* Must add this at the end */
 };
 /* clang-format on */
@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2013-2022 UChicago Argonne, LLC and The HDF Group.
+ * Copyright (c) 2022-2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "mercury_perf.h"
+
+#include "mercury_mem.h"
+
+/****************/
+/* Local Macros */
+/****************/
+#define BENCHMARK_NAME "Read BW, scattered segments (server bulk push)"
+
+/* Max number of segments per bulk transfer */
+#define HG_PERF_SEGMENT_COUNT_MAX (1024)
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static hg_return_t
+hg_perf_segments_create(struct hg_perf_class_info *info, void **seg_bufs,
+    size_t segment_count, hg_bulk_t *bulk_handles);
+
+static hg_return_t
+hg_perf_segments_verify(struct hg_perf_class_info *info, void **seg_bufs,
+    size_t segment_count, size_t buf_size);
+
+static hg_return_t
+hg_perf_run(const struct hg_test_info *hg_test_info,
+    struct hg_perf_class_info *info, hg_bulk_t *bulk_handles, void **seg_bufs,
+    size_t segment_count, size_t skip);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_perf_segments_create(struct hg_perf_class_info *info, void **seg_bufs,
+    size_t segment_count, hg_bulk_t *bulk_handles)
+{
+    size_t seg_size = info->buf_size_max / segment_count,
+           count = segment_count * info->bulk_count;
+    void **bufs = NULL;
+    hg_size_t *lens = NULL;
+    hg_return_t ret;
+    size_t i, j;
+
+    bufs = (void **) malloc(count * sizeof(void *));
+    HG_TEST_CHECK_ERROR(bufs == NULL, error, ret, HG_NOMEM,
+        "malloc(%zu) failed", count * sizeof(void *));
+
+    lens = (hg_size_t *) malloc(count * sizeof(hg_size_t));
+    HG_TEST_CHECK_ERROR(lens == NULL, error, ret, HG_NOMEM,
+        "malloc(%zu) failed", count * sizeof(hg_size_t));
+
+    for (i = 0; i < info->handle_max; i++) {
+        /* Leave a gap after each segment so that segments are not contiguous
+         */
+        for (j = 0; j < count; j++) {
+            bufs[j] = (char *) seg_bufs[i] + 2 * j * seg_size;
+            lens[j] = seg_size;
+        }
+
+        ret = HG_Bulk_create(info->hg_class, (uint32_t) count, bufs, lens,
+            HG_BULK_WRITE_ONLY, &bulk_handles[i]);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_create() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    free(bufs);
+    free(lens);
+
+    return HG_SUCCESS;
+
+error:
+    free(bufs);
+    free(lens);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_perf_segments_verify(struct hg_perf_class_info *info, void **seg_bufs,
+    size_t segment_count, size_t buf_size)
+{
+    size_t seg_size = info->buf_size_max / segment_count;
+    hg_return_t ret;
+    size_t i, j, k;
+
+    for (i = 0; i < info->handle_max; i++) {
+        /* Gather segments back into contiguous buffer */
+        for (j = 0; j < info->bulk_count; j++) {
+            char *buf_p = (char *) info->bulk_bufs[i] + info->buf_size_max * j;
+
+            for (k = 0; k < segment_count; k++) {
+                const char *seg_p = (const char *) seg_bufs[i] +
+                                    2 * (j * segment_count + k) * seg_size;
+
+                memcpy(buf_p + k * seg_size, seg_p, seg_size);
+            }
+
+            ret = hg_perf_verify_data(buf_p, buf_size);
+            HG_TEST_CHECK_HG_ERROR(error, ret,
+                "hg_perf_verify_data() failed (%s)", HG_Error_to_string(ret));
+        }
+    }
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_perf_run(const struct hg_test_info *hg_test_info,
+    struct hg_perf_class_info *info, hg_bulk_t *bulk_handles, void **seg_bufs,
+    size_t segment_count, size_t skip)
+{
+    size_t comm_rank = (size_t) hg_test_info->na_test_info.mpi_info.rank,
+           comm_size = (size_t) hg_test_info->na_test_info.mpi_info.size,
+           loop = (size_t) hg_test_info->na_test_info.loop,
+           buf_size = info->buf_size_max;
+    hg_time_t t1, t2;
+    hg_return_t ret;
+    size_t i;
+
+    /* Warm up for RPC */
+    for (i = 0; i < skip + loop; i++) {
+        struct hg_perf_request request = {
+            .expected_count = (int32_t) info->handle_max,
+            .complete_count = 0,
+            .completed = HG_ATOMIC_VAR_INIT(0)};
+        size_t j;
+
+        if (i == skip) {
+            if (comm_size > 1)
+                NA_Test_barrier(&hg_test_info->na_test_info);
+            hg_time_get_current(&t1);
+        }
+
+        for (j = 0; j < info->handle_max; j++) {
+            struct hg_perf_bulk_info in_struct = {.bulk = bulk_handles[j],
+                .handle_id = (uint32_t) ((comm_rank + j * comm_size) /
+                                         info->target_addr_max),
+                .size = (uint32_t) buf_size};
+
+            ret = HG_Forward(info->handles[j], hg_perf_request_complete,
+                &request, &in_struct);
+            HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Forward() failed (%s)",
+                HG_Error_to_string(ret));
+        }
+
+        ret = hg_perf_request_wait(info, &request, HG_MAX_IDLE_TIME, NULL);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "hg_perf_request_wait() failed (%s)",
+            HG_Error_to_string(ret));
+
+        if (info->verify) {
+            ret = hg_perf_segments_verify(
+                info, seg_bufs, segment_count, buf_size);
+            HG_TEST_CHECK_HG_ERROR(error, ret,
+                "hg_perf_segments_verify() failed (%s)",
+                HG_Error_to_string(ret));
+        }
+    }
+
+    if (comm_size > 1)
+        NA_Test_barrier(&hg_test_info->na_test_info);
+
+    hg_time_get_current(&t2);
+
+    if (comm_rank == 0)
+        hg_perf_print_bw_segments(hg_test_info, info, buf_size,
+            segment_count, hg_time_subtract(t2, t1));
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*****************************************************************************/
+int
+main(int argc, char *argv[])
+{
+    struct hg_perf_info perf_info;
+    struct hg_test_info *hg_test_info;
+    struct hg_perf_class_info *info;
+    hg_bulk_t *bulk_handles = NULL;
+    void **seg_bufs = NULL;
+    size_t page_size = (size_t) hg_mem_get_page_size();
+    size_t segment_count, seg_size_min, i;
+    hg_return_t hg_ret;
+
+    /* Initialize the interface */
+    hg_ret = hg_perf_init(argc, argv, false, &perf_info);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_init() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    hg_test_info = &perf_info.hg_test_info;
+    info = &perf_info.class_info[0];
+
+    /* Allocate bulk buffers */
+    hg_ret = hg_perf_bulk_buf_init(hg_test_info, info, HG_BULK_PUSH);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_bulk_buf_init() failed (%s)",
+        HG_Error_to_string(hg_ret));
+
+    /* Set HG handles */
+    hg_ret = hg_perf_set_handles(hg_test_info, info, HG_PERF_BW_READ);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_set_handles() failed (%s)",
+        HG_Error_to_string(hg_ret));
+
+    /* Scattered buffers are twice as large to leave gaps between segments */
+    seg_bufs = (void **) calloc(info->handle_max, sizeof(void *));
+    HG_TEST_CHECK_ERROR(seg_bufs == NULL, error, hg_ret, HG_NOMEM,
+        "calloc(%zu) failed", info->handle_max * sizeof(void *));
+    for (i = 0; i < info->handle_max; i++) {
+        seg_bufs[i] = hg_mem_aligned_alloc(
+            page_size, 2 * info->buf_size_max * info->bulk_count);
+        HG_TEST_CHECK_ERROR(seg_bufs[i] == NULL, error, hg_ret, HG_NOMEM,
+            "hg_mem_aligned_alloc(%zu, %zu) failed", page_size,
+            2 * info->buf_size_max * info->bulk_count);
+    }
+
+    bulk_handles = (hg_bulk_t *) calloc(info->handle_max, sizeof(hg_bulk_t));
+    HG_TEST_CHECK_ERROR(bulk_handles == NULL, error, hg_ret, HG_NOMEM,
+        "calloc(%zu) failed", info->handle_max * sizeof(hg_bulk_t));
+
+    /* Header info */
+    if (hg_test_info->na_test_info.mpi_info.rank == 0)
+        hg_perf_print_header_bw_segments(hg_test_info, info, BENCHMARK_NAME);
+
+    /* Bulk RPC with increasing number of segments, segments are never
+     * smaller than min buffer size */
+    seg_size_min = MAX(1, info->buf_size_min);
+    for (segment_count = 1; segment_count <= HG_PERF_SEGMENT_COUNT_MAX &&
+                            info->buf_size_max / segment_count >= seg_size_min;
+         segment_count *= 2) {
+        hg_ret = hg_perf_segments_create(
+            info, seg_bufs, segment_count, bulk_handles);
+        HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+            "hg_perf_segments_create() failed (%s)",
+            HG_Error_to_string(hg_ret));
+
+        hg_ret = hg_perf_run(hg_test_info, info, bulk_handles, seg_bufs,
+            segment_count,
+            (info->buf_size_max > HG_PERF_LARGE_SIZE) ? HG_PERF_LAT_SKIP_LARGE
+                                                      : HG_PERF_LAT_SKIP_SMALL);
+        HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_perf_run() failed (%s)",
+            HG_Error_to_string(hg_ret));
+
+        for (i = 0; i < info->handle_max; i++) {
+            (void) HG_Bulk_free(bulk_handles[i]);
+            bulk_handles[i] = HG_BULK_NULL;
+        }
+    }
+
+    /* Finalize interface */
+    if (hg_test_info->na_test_info.mpi_info.rank == 0)
+        hg_perf_send_done(info);
+
+    free(bulk_handles);
+    for (i = 0; i < info->handle_max; i++)
+        hg_mem_aligned_free(seg_bufs[i]);
+    free(seg_bufs);
+
+    hg_perf_cleanup(&perf_info);
+
+    return EXIT_SUCCESS;
+
+error:
+    if (bulk_handles != NULL) {
+        for (i = 0; i < info->handle_max; i++)
+            (void) HG_Bulk_free(bulk_handles[i]);
+        free(bulk_handles);
+    }
+    if (seg_bufs != NULL) {
+        for (i = 0; i < info->handle_max; i++)
+            hg_mem_aligned_free(seg_bufs[i]);
+        free(seg_bufs);
+    }
+    hg_perf_cleanup(&perf_info);
+
+    return EXIT_FAILURE;
+}
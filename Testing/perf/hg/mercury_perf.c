@@ -105,6 +105,12 @@ hg_perf_bulk_common(hg_handle_t handle, hg_bulk_op_t op);
 static hg_return_t
 hg_perf_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info);
 
+static hg_return_t
+hg_perf_bulk_gather_cb(hg_handle_t handle);
+
+static hg_return_t
+hg_perf_bulk_gather_transfer_cb(const struct hg_cb_info *hg_cb_info);
+
 static hg_return_t
 hg_perf_done_cb(hg_handle_t handle);
 
@@ -317,6 +323,11 @@ hg_perf_class_init(const struct hg_test_info *hg_test_info, int class_id,
     HG_TEST_CHECK_HG_ERROR(
         error, ret, "HG_Register() failed (%s)", HG_Error_to_string(ret));
 
+    ret = HG_Register(info->hg_class, HG_PERF_BW_GATHER,
+        hg_perf_proc_bulk_info, NULL, hg_perf_bulk_gather_cb);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Register() failed (%s)", HG_Error_to_string(ret));
+
     ret =
         HG_Register(info->hg_class, HG_PERF_DONE, NULL, NULL, hg_perf_done_cb);
     HG_TEST_CHECK_HG_ERROR(
@@ -401,6 +412,7 @@ hg_perf_class_cleanup(struct hg_perf_class_info *info)
             HG_Bulk_free(info->remote_bulk_handles[i]);
         free(info->remote_bulk_handles);
     }
+    free(info->bulk_origins);
 
     hg_perf_bulk_buf_free(info);
 
@@ -893,6 +905,54 @@ hg_perf_print_bw(const struct hg_test_info *hg_test_info,
     }
 }
 
+/*---------------------------------------------------------------------------*/
+void
+hg_perf_print_header_bw_segments(const struct hg_test_info *hg_test_info,
+    const struct hg_perf_class_info *info, const char *benchmark)
+{
+    const char *bw_label = (hg_test_info->na_test_info.mbps)
+                               ? "Bandwidth (MB/s)"
+                               : "Bandwidth (MiB/s)";
+
+    printf("# %s v%s\n", benchmark, VERSION_NAME);
+    printf(
+        "# %d client process(es)\n", hg_test_info->na_test_info.mpi_info.size);
+    printf("# Loop %d times with size %zu byte(s) and %zu handle(s) "
+           "in-flight\n# - %zu bulk transfer(s) per handle\n",
+        hg_test_info->na_test_info.loop, info->buf_size_max, info->handle_max,
+        (size_t) info->bulk_count);
+    if (info->verify)
+        printf("# WARNING verifying data, output will be slower\n");
+    printf("%-*s%*s%*s\n", 10, "# Segments", NWIDTH, bw_label, NWIDTH,
+        "Time (us)");
+    fflush(stdout);
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_perf_print_bw_segments(const struct hg_test_info *hg_test_info,
+    const struct hg_perf_class_info *info, size_t buf_size,
+    size_t segment_count, hg_time_t t)
+{
+    size_t loop = (size_t) hg_test_info->na_test_info.loop,
+           mpi_comm_size = (size_t) hg_test_info->na_test_info.mpi_info.size,
+           handle_max = (size_t) info->handle_max,
+           buf_count = (size_t) info->bulk_count;
+    double avg_bw =
+        (double) (buf_size * loop * handle_max * mpi_comm_size * buf_count) /
+        hg_time_to_double(t);
+    double avg_time = hg_time_to_double(t) * 1e6 /
+                      (double) (loop * handle_max * mpi_comm_size * buf_count);
+
+    if (hg_test_info->na_test_info.mbps)
+        avg_bw /= 1e6; /* MB/s, matches OSU benchmarks */
+    else
+        avg_bw /= (1024 * 1024); /* MiB/s */
+
+    printf("%-*zu%*.*f%*.*f\n", 10, segment_count, NWIDTH, NDIGITS, avg_bw,
+        NWIDTH, NDIGITS, avg_time);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_perf_proc_iovec(hg_proc_t proc, void *arg)
@@ -1150,6 +1210,12 @@ hg_perf_bulk_init_cb(hg_handle_t handle)
         HG_TEST_CHECK_ERROR(info->remote_bulk_handles == NULL, error_free, ret,
             HG_NOMEM, "malloc(%zu) failed",
             info->handle_max * sizeof(hg_bulk_t));
+
+        info->bulk_origins = (struct hg_bulk_origin_desc *) malloc(
+            info->bulk_count * sizeof(struct hg_bulk_origin_desc));
+        HG_TEST_CHECK_ERROR(info->bulk_origins == NULL, error_free, ret,
+            HG_NOMEM, "malloc(%zu) failed",
+            info->bulk_count * sizeof(struct hg_bulk_origin_desc));
     }
 
     HG_TEST_CHECK_ERROR(bulk_info.handle_id >= info->handle_max, error_free,
@@ -1295,6 +1361,93 @@ error:
     return HG_FAULT;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_perf_bulk_gather_cb(hg_handle_t handle)
+{
+    const struct hg_info *hg_info = HG_Get_info(handle);
+    struct hg_perf_class_info *info = HG_Context_get_data(hg_info->context);
+    struct hg_perf_bulk_info bulk_info;
+    hg_bulk_t remote_bulk;
+    hg_return_t ret;
+    size_t i;
+
+    /* Get input struct */
+    ret = HG_Get_input(handle, &bulk_info);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Get_input() failed (%s)", HG_Error_to_string(ret));
+    remote_bulk = bulk_info.bulk != HG_BULK_NULL
+                      ? bulk_info.bulk
+                      : info->remote_bulk_handles[bulk_info.handle_id];
+
+    /* Gather all fragments into contiguous local buffer at once */
+    for (i = 0; i < info->bulk_count; i++)
+        info->bulk_origins[i] = (struct hg_bulk_origin_desc){
+            .addr = hg_info->addr,
+            .handle = remote_bulk,
+            .offset = i * info->buf_size_max,
+            .size = bulk_info.size};
+
+    ret = HG_Bulk_transfer_multi(info->context,
+        hg_perf_bulk_gather_transfer_cb, handle, HG_BULK_PULL,
+        info->bulk_origins, (uint32_t) info->bulk_count,
+        info->local_bulk_handles[bulk_info.handle_id], 0, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(error_free, ret,
+        "HG_Bulk_transfer_multi() failed (%s)", HG_Error_to_string(ret));
+
+    (void) HG_Free_input(handle, &bulk_info);
+
+    return HG_SUCCESS;
+
+error_free:
+    (void) HG_Free_input(handle, &bulk_info);
+error:
+    (void) HG_Destroy(handle);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_perf_bulk_gather_transfer_cb(const struct hg_cb_info *hg_cb_info)
+{
+    hg_handle_t handle = (hg_handle_t) hg_cb_info->arg;
+    const struct hg_info *hg_info = HG_Get_info(handle);
+    struct hg_perf_class_info *info = HG_Context_get_data(hg_info->context);
+    hg_return_t ret = hg_cb_info->ret;
+
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Bulk transfer failed (%s)",
+        HG_Error_to_string(ret));
+
+    if (info->verify) {
+        size_t size = hg_cb_info->info.bulk.size / info->bulk_count;
+        void *buf;
+        hg_size_t buf_size;
+        hg_uint32_t actual_count;
+        size_t i;
+
+        ret = HG_Bulk_access(hg_cb_info->info.bulk.local_handle, 0,
+            hg_cb_info->info.bulk.size, HG_BULK_READWRITE, 1, &buf, &buf_size,
+            &actual_count);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_access() failed (%s)",
+            HG_Error_to_string(ret));
+
+        /* Fragments are packed */
+        for (i = 0; i < info->bulk_count; i++) {
+            ret = hg_perf_verify_data((char *) buf + size * i, size);
+            HG_TEST_CHECK_HG_ERROR(done, ret,
+                "hg_perf_verify_data() failed (%s, %p)",
+                HG_Error_to_string(ret), buf);
+        }
+    }
+
+done:
+    HG_Respond(handle, NULL, NULL, NULL);
+    (void) HG_Destroy(handle);
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_perf_done_cb(hg_handle_t handle)
@@ -29,6 +29,7 @@ enum hg_perf_rpc_id {
     HG_PERF_BW_INIT,
     HG_PERF_BW_READ,
     HG_PERF_BW_WRITE,
+    HG_PERF_BW_GATHER,
     HG_PERF_DONE
 };
 
@@ -55,6 +56,7 @@ struct hg_perf_class_info {
     size_t buf_size_max;
     hg_bulk_t *local_bulk_handles;
     hg_bulk_t *remote_bulk_handles;
+    struct hg_bulk_origin_desc *bulk_origins;
     int wait_fd; /* Wait fd */
     int class_id;
     bool done;
@@ -156,6 +158,15 @@ hg_perf_print_bw(const struct hg_test_info *hg_test_info,
     const struct hg_perf_class_info *info, size_t buf_size, hg_time_t t,
     hg_time_t t_reg, hg_time_t t_dereg);
 
+void
+hg_perf_print_header_bw_segments(const struct hg_test_info *hg_test_info,
+    const struct hg_perf_class_info *info, const char *benchmark);
+
+void
+hg_perf_print_bw_segments(const struct hg_test_info *hg_test_info,
+    const struct hg_perf_class_info *info, size_t buf_size,
+    size_t segment_count, hg_time_t t);
+
 hg_return_t
 hg_perf_send_done(struct hg_perf_class_info *info);
 
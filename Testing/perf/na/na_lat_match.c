@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2013-2022 UChicago Argonne, LLC and The HDF Group.
+ * Copyright (c) 2022-2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "na_perf.h"
+
+/****************/
+/* Local Macros */
+/****************/
+#define BENCHMARK_NAME "Expected msg matching latency"
+
+/* Max number of expected recvs posted at once */
+#define NA_PERF_MATCH_COUNT_MAX (10000)
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static na_return_t
+na_perf_run(struct na_perf_info *info, size_t buf_size, size_t recv_count,
+    na_op_id_t **recv_op_ids, struct na_perf_request_info *request_infos);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_perf_send_init(struct na_perf_info *info)
+{
+    struct na_perf_request_info request_info = {
+        .completed = HG_ATOMIC_VAR_INIT(0),
+        .complete_count = 0,
+        .expected_count = (int32_t) 1};
+    na_return_t ret;
+
+    /* Post one-way msg send */
+    ret = NA_Msg_send_unexpected(info->na_class, info->context,
+        na_perf_request_complete, &request_info, info->msg_unexp_buf,
+        info->msg_unexp_header_size, info->msg_unexp_data, info->target_addr, 0,
+        NA_PERF_TAG_LAT_INIT, info->msg_unexp_op_id);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "NA_Msg_send_unexpected() failed (%s)",
+        NA_Error_to_string(ret));
+
+    /* Wait for completion */
+    ret = na_perf_request_wait(info, &request_info, NA_MAX_IDLE_TIME, NULL);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "na_perf_request_wait() failed (%s)",
+        NA_Error_to_string(ret));
+
+    return NA_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_perf_run(struct na_perf_info *info, size_t buf_size, size_t recv_count,
+    na_op_id_t **recv_op_ids, struct na_perf_request_info *request_infos)
+{
+    hg_time_t t = hg_time_from_ms(0);
+    na_return_t ret;
+    size_t i, j;
+
+    for (i = 0; i < (size_t) info->na_test_info.loop; i++) {
+        hg_time_t t1, t2;
+
+        /* Post all recvs with distinct tags, all buffers alias since only one
+         * reply is in flight at a time */
+        for (j = 0; j < recv_count; j++) {
+            request_infos[j].expected_count = (int32_t) 2;
+            request_infos[j].complete_count = 0;
+            hg_atomic_init32(&request_infos[j].completed, 0);
+
+            ret = NA_Msg_recv_expected(info->na_class, info->context,
+                na_perf_request_complete, &request_infos[j], info->msg_exp_buf,
+                buf_size, info->msg_exp_data, info->target_addr, 0,
+                (na_tag_t) (NA_PERF_TAG_MATCH + j), recv_op_ids[j]);
+            NA_TEST_CHECK_NA_ERROR(error, ret,
+                "NA_Msg_recv_expected() failed (%s)", NA_Error_to_string(ret));
+        }
+
+        hg_time_get_current(&t1);
+
+        /* Request replies starting from the most recently posted recv */
+        for (j = recv_count; j > 0; j--) {
+            ret = NA_Msg_send_unexpected(info->na_class, info->context,
+                na_perf_request_complete, &request_infos[j - 1],
+                info->msg_unexp_buf, buf_size, info->msg_unexp_data,
+                info->target_addr, 0, (na_tag_t) (NA_PERF_TAG_MATCH + j - 1),
+                info->msg_unexp_op_id);
+            NA_TEST_CHECK_NA_ERROR(error, ret,
+                "NA_Msg_send_unexpected() failed (%s)",
+                NA_Error_to_string(ret));
+
+            /* Wait for completion */
+            ret = na_perf_request_wait(
+                info, &request_infos[j - 1], NA_MAX_IDLE_TIME, NULL);
+            NA_TEST_CHECK_NA_ERROR(error, ret,
+                "na_perf_request_wait() failed (%s)", NA_Error_to_string(ret));
+        }
+
+        hg_time_get_current(&t2);
+        t = hg_time_add(t, hg_time_subtract(t2, t1));
+    }
+
+    na_perf_print_match(info, recv_count, t);
+
+    return NA_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    struct na_perf_info info;
+    struct na_perf_request_info *request_infos = NULL;
+    na_op_id_t **recv_op_ids = NULL;
+    size_t buf_size, count, i;
+    na_return_t na_ret;
+
+    /* Initialize the interface */
+    na_ret = na_perf_init(argc, argv, false, &info);
+    NA_TEST_CHECK_NA_ERROR(error, na_ret, "na_perf_init() failed (%s)",
+        NA_Error_to_string(na_ret));
+
+    /* Create recv op IDs */
+    request_infos = (struct na_perf_request_info *) malloc(
+        sizeof(*request_infos) * NA_PERF_MATCH_COUNT_MAX);
+    NA_TEST_CHECK_ERROR(request_infos == NULL, error, na_ret, NA_NOMEM,
+        "malloc(request_infos) failed");
+
+    recv_op_ids =
+        (na_op_id_t **) calloc(NA_PERF_MATCH_COUNT_MAX, sizeof(na_op_id_t *));
+    NA_TEST_CHECK_ERROR(
+        recv_op_ids == NULL, error, na_ret, NA_NOMEM, "calloc() failed");
+    for (i = 0; i < NA_PERF_MATCH_COUNT_MAX; i++) {
+        recv_op_ids[i] = NA_Op_create(info.na_class, NA_OP_SINGLE);
+        NA_TEST_CHECK_ERROR(recv_op_ids[i] == NULL, error, na_ret,
+            NA_NOMEM, "NA_Op_create() failed");
+    }
+
+    /* Init data */
+    na_perf_init_data(info.msg_unexp_buf, info.msg_unexp_size_max,
+        info.msg_unexp_header_size);
+    na_perf_send_init(&info);
+
+    buf_size =
+        (info.msg_unexp_header_size > 0) ? info.msg_unexp_header_size : 1;
+
+    /* Header info */
+    na_perf_print_header_match(&info, BENCHMARK_NAME, buf_size);
+
+    /* Increasing number of outstanding recvs */
+    for (count = 1; count <= NA_PERF_MATCH_COUNT_MAX; count *= 10) {
+        na_ret =
+            na_perf_run(&info, buf_size, count, recv_op_ids, request_infos);
+        NA_TEST_CHECK_NA_ERROR(error, na_ret, "na_perf_run(%zu) failed (%s)",
+            count, NA_Error_to_string(na_ret));
+    }
+
+    /* Finalize interface */
+    na_perf_send_finalize(&info);
+
+    for (i = 0; i < NA_PERF_MATCH_COUNT_MAX; i++)
+        NA_Op_destroy(info.na_class, recv_op_ids[i]);
+    free(recv_op_ids);
+    free(request_infos);
+
+    na_perf_cleanup(&info);
+
+    return EXIT_SUCCESS;
+
+error:
+    if (recv_op_ids != NULL) {
+        for (i = 0; i < NA_PERF_MATCH_COUNT_MAX; i++)
+            if (recv_op_ids[i] != NULL)
+                NA_Op_destroy(info.na_class, recv_op_ids[i]);
+        free(recv_op_ids);
+    }
+    free(request_infos);
+    na_perf_cleanup(&info);
+
+    return EXIT_FAILURE;
+}
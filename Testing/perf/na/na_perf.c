@@ -243,10 +243,18 @@ na_perf_init(int argc, char *argv[], bool listen, struct na_perf_info *info)
     }
 
     /* Prepare RMA buf */
-    info->rma_buf =
-        hg_mem_aligned_alloc(page_size, info->rma_size_max * info->rma_count);
-    NA_TEST_CHECK_ERROR(info->rma_buf == NULL, error, ret, NA_NOMEM,
-        "hg_mem_aligned_alloc(%zu, %zu) failed", page_size, info->rma_size_max);
+    if (info->na_test_info.mem_alloc) {
+        info->rma_buf = NA_Mem_alloc(info->na_class,
+            info->rma_size_max * info->rma_count, 0, &info->rma_data);
+        NA_TEST_CHECK_ERROR(info->rma_buf == NULL, error, ret, NA_NOMEM,
+            "NA_Mem_alloc(%zu) failed", info->rma_size_max * info->rma_count);
+    } else {
+        info->rma_buf = hg_mem_aligned_alloc(
+            page_size, info->rma_size_max * info->rma_count);
+        NA_TEST_CHECK_ERROR(info->rma_buf == NULL, error, ret, NA_NOMEM,
+            "hg_mem_aligned_alloc(%zu, %zu) failed", page_size,
+            info->rma_size_max);
+    }
     memset(info->rma_buf, 0, info->rma_size_max * info->rma_count);
 
     if (!info->na_test_info.force_register || listen) {
@@ -348,7 +356,10 @@ na_perf_cleanup(struct na_perf_info *info)
     }
     if (info->remote_handle != NULL)
         NA_Mem_handle_free(info->na_class, info->remote_handle);
-    hg_mem_aligned_free(info->rma_buf);
+    if (info->rma_data != NULL)
+        NA_Mem_free(info->na_class, info->rma_buf, info->rma_data);
+    else
+        hg_mem_aligned_free(info->rma_buf);
     hg_mem_aligned_free(info->verify_buf);
 
     if (info->target_addr != NULL)
@@ -392,6 +403,32 @@ na_perf_print_lat(const struct na_perf_info *info, size_t buf_size, hg_time_t t)
     printf("%-*zu%*.*f\n", 10, buf_size, NWIDTH, NDIGITS, msg_lat);
 }
 
+/*---------------------------------------------------------------------------*/
+void
+na_perf_print_header_match(
+    const struct na_perf_info *info, const char *benchmark, size_t buf_size)
+{
+    fprintf(stdout, "# %s v%s\n", benchmark, VERSION_NAME);
+    fprintf(stdout,
+        "# Loop %d times with %zu byte(s) msgs, matched in reverse order\n",
+        info->na_test_info.loop, buf_size);
+    fprintf(stdout, "%-*s%*s\n", 10, "# Posted", NWIDTH, "Avg Lat (us)");
+    fflush(stdout);
+}
+
+/*---------------------------------------------------------------------------*/
+void
+na_perf_print_match(
+    const struct na_perf_info *info, size_t recv_count, hg_time_t t)
+{
+    double msg_lat;
+    size_t loop = (size_t) info->na_test_info.loop;
+
+    msg_lat = hg_time_to_double(t) * 1e6 / (double) (loop * recv_count * 2);
+
+    printf("%-*zu%*.*f\n", 10, recv_count, NWIDTH, NDIGITS, msg_lat);
+}
+
 /*---------------------------------------------------------------------------*/
 void
 na_perf_print_header_bw(const struct na_perf_info *info, const char *benchmark)
@@ -34,6 +34,7 @@ struct na_perf_info {
     na_op_id_t *msg_unexp_op_id;      /* Msg unexpected op ID */
     na_op_id_t *msg_exp_op_id;        /* Msg expected op ID */
     void *rma_buf;                    /* RMA buffer */
+    void *rma_data;                   /* Plugin data (NA_Mem_alloc) */
     void *verify_buf;                 /* Verify buffer */
     na_mem_handle_t *local_handle;    /* Local handle */
     na_mem_handle_t *remote_handle;   /* Remote handle */
@@ -64,6 +65,7 @@ struct na_perf_request_info {
 #define NA_PERF_TAG_PUT      10
 #define NA_PERF_TAG_GET      20
 #define NA_PERF_TAG_DONE     111
+#define NA_PERF_TAG_MATCH    1000 /* Tags above are echoed back */
 
 #define NA_PERF_LAT_SKIP_SMALL 100
 #define NA_PERF_LAT_SKIP_LARGE 10
@@ -101,6 +103,14 @@ void
 na_perf_print_lat(
     const struct na_perf_info *info, size_t buf_size, hg_time_t t);
 
+void
+na_perf_print_header_match(
+    const struct na_perf_info *info, const char *benchmark, size_t buf_size);
+
+void
+na_perf_print_match(
+    const struct na_perf_info *info, size_t recv_count, hg_time_t t);
+
 void
 na_perf_print_header_bw(const struct na_perf_info *info, const char *benchmark);
 
@@ -198,7 +198,16 @@ na_perf_process_recv(struct na_perf_recv_info *recv_info,
             recv_info->done = true;
             break;
         default:
-            ret = NA_PROTOCOL_ERROR;
+            if (tag < NA_PERF_TAG_MATCH) {
+                ret = NA_PROTOCOL_ERROR;
+                break;
+            }
+            /* Respond with same tag */
+            ret = NA_Msg_send_expected(info->na_class, info->context, NULL,
+                NULL, info->msg_exp_buf, actual_buf_size, info->msg_exp_data,
+                source, 0, tag, info->msg_exp_op_id);
+            NA_TEST_CHECK_NA_ERROR(done, ret,
+                "NA_Msg_send_expected() failed (%s)", NA_Error_to_string(ret));
             break;
     }
 
@@ -114,6 +114,10 @@ rpc_open(const char *path, rpc_handle_t handle, int *event_id)
 #endif
     *event_id = (int) handle.cookie;
 
+    /* Delay response so that responses can complete out of order */
+    if (handle.cookie & HG_TEST_RPC_COOKIE_DELAY)
+        hg_time_sleep(hg_time_from_ms((unsigned int) (handle.cookie & 0x3)));
+
     return HG_SUCCESS;
 }
 
@@ -61,6 +61,7 @@ hg_test_register(hg_class_t *hg_class);
 hg_id_t hg_test_rpc_null_id_g = 0;
 hg_id_t hg_test_rpc_open_id_g = 0;
 hg_id_t hg_test_rpc_open_id_no_resp_g = 0;
+hg_id_t hg_test_rpc_open_id_no_copy_g = 0;
 hg_id_t hg_test_overflow_id_g = 0;
 hg_id_t hg_test_cancel_rpc_id_g = 0;
 
@@ -215,6 +216,16 @@ hg_test_register(hg_class_t *hg_class)
     HG_Registered_disable_response(
         hg_class, hg_test_rpc_open_id_no_resp_g, HG_TRUE);
 
+    hg_test_rpc_open_id_no_copy_g =
+        MERCURY_REGISTER(hg_class, "hg_test_rpc_open_no_copy", rpc_open_in_t,
+            rpc_open_out_t, hg_test_rpc_open_no_resp_cb);
+
+    /* Disable response, handler does not hold on to its input */
+    HG_Registered_disable_response(
+        hg_class, hg_test_rpc_open_id_no_copy_g, HG_TRUE);
+    HG_Registered_disable_input_copy(
+        hg_class, hg_test_rpc_open_id_no_copy_g, HG_TRUE);
+
     hg_test_overflow_id_g = MERCURY_REGISTER(hg_class, "hg_test_overflow", void,
         overflow_out_t, hg_test_overflow_cb);
     hg_test_cancel_rpc_id_g = MERCURY_REGISTER(
@@ -7,6 +7,7 @@
 
 #include "mercury_unit.h"
 
+#include "mercury_bulk_proc.h"
 #include "mercury_param.h"
 
 /****************/
@@ -16,6 +17,27 @@
 /* Wait timeout in ms */
 #define HG_TEST_WAIT_TIMEOUT (HG_TEST_TIMEOUT * 1000)
 
+/* Number of segments of varying size used for offset lookups */
+#define HG_TEST_BULK_ACCESS_SEGMENTS (256)
+
+/* Number of chunks used for chunked transfers */
+#define HG_TEST_BULK_CHUNK_COUNT (16)
+
+/* Number of contexts used for striped transfers */
+#define HG_TEST_BULK_STRIPE_CONTEXTS (4)
+
+/* Number of origins gathered by multi-origin transfers */
+#define HG_TEST_BULK_MULTI_ORIGINS (4)
+
+/* Number of segments of origin used for transfers to self */
+#define HG_TEST_BULK_SELF_SEGMENTS (4)
+
+/* Number of handles successively created on same buffer */
+#define HG_TEST_BULK_REG_CACHE_COUNT (4)
+
+/* Number of times a same handle is serialized */
+#define HG_TEST_BULK_SERIALIZE_COUNT (4)
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -33,6 +55,24 @@ struct forward_cb_args {
     hg_return_t ret;
 };
 
+struct hg_test_bulk_transfer_args {
+    hg_atomic_int32_t done;
+    hg_return_t ret;
+};
+
+/* Origin memory exposed to a target class and local buffer receiving it */
+struct hg_test_bulk_origin {
+    struct hg_test_bulk_info bulk_info; /* Origin memory */
+    hg_class_t *hg_class;               /* Class exposing origin memory */
+    hg_class_t *target_class;           /* Class accessing origin memory */
+    hg_addr_t self_addr;                /* Origin address in origin class */
+    hg_addr_t addr;                     /* Origin address in target class */
+    hg_bulk_t handle;                   /* Origin handle in target class */
+    hg_bulk_t local_handle;             /* Local handle in target class */
+    void *local_buf;                    /* Local buffer */
+    hg_size_t local_size;               /* Local buffer size */
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -41,6 +81,11 @@ static hg_return_t
 hg_test_bulk_create(hg_class_t *hg_class, size_t segment_count,
     size_t segment_size, struct hg_test_bulk_info *bulk_info_p);
 
+static hg_return_t
+hg_test_bulk_create_attr(hg_class_t *hg_class, size_t segment_count,
+    size_t segment_size, const struct hg_bulk_attr *attrs,
+    struct hg_test_bulk_info *bulk_info_p);
+
 static hg_return_t
 hg_test_bulk_destroy(struct hg_test_bulk_info *bulk_info);
 
@@ -52,6 +97,58 @@ hg_test_bulk_forward(hg_handle_t handle, hg_addr_t addr, hg_id_t rpc_id,
 static hg_return_t
 hg_test_bulk_forward_cb(const struct hg_cb_info *callback_info);
 
+static hg_return_t
+hg_test_bulk_access(hg_class_t *hg_class);
+
+#ifdef NA_HAS_SM
+static hg_return_t
+hg_test_bulk_origin_setup(hg_class_t *hg_class, bool self,
+    const struct hg_init_info *hg_init_info, const struct hg_bulk_attr *attrs,
+    size_t segment_count, size_t segment_size,
+    struct hg_test_bulk_origin *origin);
+
+static void
+hg_test_bulk_origin_cleanup(struct hg_test_bulk_origin *origin);
+
+static hg_return_t
+hg_test_bulk_wait(hg_context_t **contexts, unsigned int context_count,
+    struct hg_test_bulk_transfer_args *args);
+
+static hg_return_t
+hg_test_bulk_transfer_cb(const struct hg_cb_info *callback_info);
+
+static hg_return_t
+hg_test_bulk_chunk(
+    size_t buf_size, size_t chunk_size, unsigned int chunk_window, bool cancel);
+
+static hg_return_t
+hg_test_bulk_striped(size_t buf_size, unsigned int context_count);
+
+static hg_return_t
+hg_test_bulk_multi(size_t buf_size);
+
+static hg_return_t
+hg_test_bulk_self(size_t buf_size);
+
+static hg_return_t
+hg_test_bulk_shared(size_t buf_size);
+
+static hg_return_t
+hg_test_bulk_reg_cache(size_t buf_size);
+
+static hg_return_t
+hg_test_bulk_reg_cache_check(
+    hg_class_t *hg_class, uint64_t hit_count, uint64_t miss_count);
+
+static hg_return_t
+hg_test_bulk_serialize(const hg_class_t *test_class, size_t buf_size);
+
+static hg_return_t
+hg_test_bulk_serialize_check(hg_context_t **contexts,
+    struct hg_test_bulk_origin *origin, unsigned long flags, bool transfer,
+    hg_size_t *serialize_size_p);
+#endif
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -119,6 +216,60 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_create_attr(hg_class_t *hg_class, size_t segment_count,
+    size_t segment_size, const struct hg_bulk_attr *attrs,
+    struct hg_test_bulk_info *bulk_info_p)
+{
+    hg_size_t *buf_sizes = NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    size_t i;
+    hg_return_t ret;
+
+    buf_sizes = (hg_size_t *) malloc(segment_count * sizeof(*buf_sizes));
+    HG_TEST_CHECK_ERROR(buf_sizes == NULL, error, ret, HG_NOMEM,
+        "Could not allocate buf_sizes");
+    for (i = 0; i < segment_count; i++)
+        buf_sizes[i] = (hg_size_t) segment_size;
+
+    /* Memory is allocated by mercury and released with the handle */
+    ret = HG_Bulk_create_attr(hg_class, (uint32_t) segment_count, NULL,
+        buf_sizes, HG_BULK_READWRITE, attrs, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_create_attr() failed (%s)",
+        HG_Error_to_string(ret));
+
+    for (i = 0; i < segment_count; i++) {
+        void *buf_ptr = NULL;
+        hg_size_t buf_size = 0;
+        uint32_t actual_count = 0;
+        size_t j;
+
+        ret = HG_Bulk_access(bulk_handle, i * segment_size, segment_size,
+            HG_BULK_READWRITE, 1, &buf_ptr, &buf_size, &actual_count);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_access() failed (%s)",
+            HG_Error_to_string(ret));
+
+        for (j = 0; j < buf_size; j++)
+            ((char *) buf_ptr)[j] = (char) (i * segment_size + j);
+    }
+    free(buf_sizes);
+
+    *bulk_info_p = (struct hg_test_bulk_info){.buf_count = 0,
+        .buf_ptrs = NULL,
+        .buf_sizes = NULL,
+        .bulk_handle = bulk_handle};
+
+    return HG_SUCCESS;
+
+error:
+    if (bulk_handle != HG_BULK_NULL)
+        (void) HG_Bulk_free(bulk_handle);
+    free(buf_sizes);
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_bulk_destroy(struct hg_test_bulk_info *bulk_info)
@@ -129,6 +280,7 @@ hg_test_bulk_destroy(struct hg_test_bulk_info *bulk_info)
     ret = HG_Bulk_free(bulk_info->bulk_handle);
     HG_TEST_CHECK_HG_ERROR(
         error, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+    bulk_info->bulk_handle = HG_BULK_NULL;
 
     if (bulk_info->buf_ptrs != NULL) {
         for (i = 0; i < bulk_info->buf_count; i++)
@@ -240,6 +392,1008 @@ done:
     return HG_SUCCESS;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_access(hg_class_t *hg_class)
+{
+    void *buf_ptrs[HG_TEST_BULK_ACCESS_SEGMENTS];
+    hg_size_t buf_sizes[HG_TEST_BULK_ACCESS_SEGMENTS];
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    char *buf = NULL;
+    hg_size_t total_size = 0, offset;
+    hg_return_t ret;
+    size_t i;
+
+    /* Segments of 0 to 3 bytes that are contiguous in memory, so that the
+     * address of each offset is known */
+    for (i = 0; i < HG_TEST_BULK_ACCESS_SEGMENTS; i++)
+        total_size += (hg_size_t) (i % 4);
+    buf = (char *) malloc(total_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, error, ret, HG_NOMEM, "Could not allocate buffer");
+
+    for (i = 0, offset = 0; i < HG_TEST_BULK_ACCESS_SEGMENTS; i++) {
+        buf_ptrs[i] = buf + offset;
+        buf_sizes[i] = (hg_size_t) (i % 4);
+        offset += buf_sizes[i];
+    }
+
+    ret = HG_Bulk_create(hg_class, HG_TEST_BULK_ACCESS_SEGMENTS, buf_ptrs,
+        buf_sizes, HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    for (offset = 0; offset < total_size; offset++) {
+        void *ptr = NULL;
+        hg_size_t len = 0;
+        uint32_t actual_count = 0;
+
+        ret = HG_Bulk_access(bulk_handle, offset, total_size - offset,
+            HG_BULK_READ_ONLY, 1, &ptr, &len, &actual_count);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_access() failed (%s)",
+            HG_Error_to_string(ret));
+        HG_TEST_CHECK_ERROR(actual_count != 1 || ptr != buf + offset ||
+                                len == 0,
+            error, ret, HG_FAULT,
+            "Offset %" PRIu64 " translated to wrong segment", offset);
+    }
+
+    (void) HG_Bulk_free(bulk_handle);
+    free(buf);
+
+    return HG_SUCCESS;
+
+error:
+    if (bulk_handle != HG_BULK_NULL)
+        (void) HG_Bulk_free(bulk_handle);
+    free(buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+#ifdef NA_HAS_SM
+static hg_return_t
+hg_test_bulk_origin_setup(hg_class_t *hg_class, bool self,
+    const struct hg_init_info *hg_init_info, const struct hg_bulk_attr *attrs,
+    size_t segment_count, size_t segment_size,
+    struct hg_test_bulk_origin *origin)
+{
+    hg_size_t serialize_size;
+    void *serialize_buf = NULL;
+    hg_return_t ret;
+
+    origin->target_class = hg_class;
+    if (self) {
+        origin->hg_class = hg_class;
+
+        ret = HG_Addr_self(hg_class, &origin->self_addr);
+        HG_TEST_CHECK_HG_ERROR(
+            error, ret, "HG_Addr_self() failed (%s)", HG_Error_to_string(ret));
+
+        ret = HG_Addr_dup(hg_class, origin->self_addr, &origin->addr);
+        HG_TEST_CHECK_HG_ERROR(
+            error, ret, "HG_Addr_dup() failed (%s)", HG_Error_to_string(ret));
+    } else {
+        char addr_string[256], info_string[64];
+        hg_size_t addr_string_size = sizeof(addr_string);
+
+        /* Origin memory is exposed by a separate class of the same plugin so
+         * that transfers go through NA and not through the self code path */
+        snprintf(info_string, sizeof(info_string), "%s+%s",
+            HG_Class_get_name(hg_class), HG_Class_get_protocol(hg_class));
+        origin->hg_class = HG_Init_opt2(info_string, HG_TRUE,
+            HG_VERSION(HG_VERSION_MAJOR, HG_VERSION_MINOR), hg_init_info);
+        HG_TEST_CHECK_ERROR(origin->hg_class == NULL, error, ret, HG_FAULT,
+            "HG_Init_opt2() failed for origin class");
+
+        ret = HG_Addr_self(origin->hg_class, &origin->self_addr);
+        HG_TEST_CHECK_HG_ERROR(
+            error, ret, "HG_Addr_self() failed (%s)", HG_Error_to_string(ret));
+
+        ret = HG_Addr_to_string(origin->hg_class, addr_string,
+            &addr_string_size, origin->self_addr);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Addr_to_string() failed (%s)",
+            HG_Error_to_string(ret));
+
+        ret = HG_Addr_lookup2(hg_class, addr_string, &origin->addr);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Addr_lookup2() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    if (attrs != NULL)
+        ret = hg_test_bulk_create_attr(origin->hg_class, segment_count,
+            segment_size, attrs, &origin->bulk_info);
+    else
+        ret = hg_test_bulk_create(
+            origin->hg_class, segment_count, segment_size, &origin->bulk_info);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "Could not create origin handle (%s)",
+        HG_Error_to_string(ret));
+
+    /* Origin handle is received as it would be by an RPC */
+    serialize_size =
+        HG_Bulk_get_serialize_size(origin->bulk_info.bulk_handle, 0);
+    serialize_buf = malloc(serialize_size);
+    HG_TEST_CHECK_ERROR(serialize_buf == NULL, error, ret, HG_NOMEM,
+        "Could not allocate serialize buffer");
+
+    ret = HG_Bulk_serialize(
+        serialize_buf, serialize_size, 0, origin->bulk_info.bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_serialize() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_deserialize(
+        hg_class, &origin->handle, serialize_buf, serialize_size);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_deserialize() failed (%s)",
+        HG_Error_to_string(ret));
+
+    free(serialize_buf);
+    serialize_buf = NULL;
+
+    /* Local buffer covers the whole origin */
+    origin->local_size = HG_Bulk_get_size(origin->bulk_info.bulk_handle);
+    origin->local_buf = calloc(1, origin->local_size);
+    HG_TEST_CHECK_ERROR(origin->local_buf == NULL, error, ret, HG_NOMEM,
+        "Could not allocate local buffer");
+
+    ret = HG_Bulk_create(hg_class, 1, &origin->local_buf, &origin->local_size,
+        HG_BULK_READWRITE, &origin->local_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    return HG_SUCCESS;
+
+error:
+    free(serialize_buf);
+    hg_test_bulk_origin_cleanup(origin);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_test_bulk_origin_cleanup(struct hg_test_bulk_origin *origin)
+{
+    if (origin->local_handle != HG_BULK_NULL) {
+        (void) HG_Bulk_free(origin->local_handle);
+        origin->local_handle = HG_BULK_NULL;
+    }
+    free(origin->local_buf);
+    origin->local_buf = NULL;
+    if (origin->handle != HG_BULK_NULL) {
+        (void) HG_Bulk_free(origin->handle);
+        origin->handle = HG_BULK_NULL;
+    }
+    if (origin->bulk_info.bulk_handle != HG_BULK_NULL)
+        (void) hg_test_bulk_destroy(&origin->bulk_info);
+    if (origin->addr != HG_ADDR_NULL) {
+        (void) HG_Addr_free(origin->target_class, origin->addr);
+        origin->addr = HG_ADDR_NULL;
+    }
+    if (origin->self_addr != HG_ADDR_NULL) {
+        (void) HG_Addr_free(origin->hg_class, origin->self_addr);
+        origin->self_addr = HG_ADDR_NULL;
+    }
+    if (origin->hg_class != NULL && origin->hg_class != origin->target_class)
+        (void) HG_Finalize(origin->hg_class);
+    origin->hg_class = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_wait(hg_context_t **contexts, unsigned int context_count,
+    struct hg_test_bulk_transfer_args *args)
+{
+    /* Only block when there is a single context to progress */
+    unsigned int timeout = (context_count == 1) ? HG_TEST_WAIT_TIMEOUT : 0;
+    hg_return_t ret;
+
+    /* Transfers complete on first context */
+    do {
+        unsigned int actual_count = 0, i;
+
+        do {
+            ret = HG_Trigger(contexts[0], 0, 1, &actual_count);
+        } while ((ret == HG_SUCCESS) && actual_count);
+        HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT, error,
+            "HG_Trigger() failed (%s)", HG_Error_to_string(ret));
+
+        if (hg_atomic_get32(&args->done))
+            break;
+
+        for (i = 0; i < context_count; i++) {
+            ret = HG_Progress(contexts[i], timeout);
+            if (ret != HG_SUCCESS && ret != HG_TIMEOUT)
+                break;
+        }
+    } while (ret == HG_SUCCESS || ret == HG_TIMEOUT);
+    HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT, error,
+        "HG_Progress() failed (%s)", HG_Error_to_string(ret));
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_transfer_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_test_bulk_transfer_args *args =
+        (struct hg_test_bulk_transfer_args *) callback_info->arg;
+
+    args->ret = callback_info->ret;
+    hg_atomic_set32(&args->done, 1);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_chunk(
+    size_t buf_size, size_t chunk_size, unsigned int chunk_window, bool cancel)
+{
+    struct hg_init_info hg_init_info = HG_INIT_INFO_INITIALIZER;
+    struct hg_test_bulk_origin origin = {.hg_class = NULL};
+    struct hg_test_bulk_transfer_args args = {
+        .done = HG_ATOMIC_VAR_INIT(0), .ret = HG_SUCCESS};
+    hg_class_t *hg_class = NULL;
+    hg_context_t *context = NULL;
+    hg_op_id_t op_id;
+    hg_return_t ret;
+    size_t i;
+
+    hg_init_info.bulk_chunk_size = chunk_size;
+    hg_init_info.bulk_chunk_window = chunk_window;
+    hg_class = HG_Init_opt2("na+sm", HG_FALSE,
+        HG_VERSION(HG_VERSION_MAJOR, HG_VERSION_MINOR), &hg_init_info);
+    HG_TEST_CHECK_ERROR(hg_class == NULL, error, ret, HG_FAULT,
+        "HG_Init_opt2() failed for chunk class");
+
+    context = HG_Context_create(hg_class);
+    HG_TEST_CHECK_ERROR(context == NULL, error, ret, HG_FAULT,
+        "HG_Context_create() failed");
+
+    /* Origin is segmented so that chunks also cross segment boundaries */
+    ret = hg_test_bulk_origin_setup(
+        hg_class, false, NULL, NULL, 4, buf_size / 4, &origin);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "hg_test_bulk_origin_setup() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_transfer(context, hg_test_bulk_transfer_cb, &args,
+        HG_BULK_PULL, origin.addr, origin.handle, 0, origin.local_handle, 0,
+        origin.local_size, &op_id);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_transfer() failed (%s)", HG_Error_to_string(ret));
+
+    /* Remaining chunks are posted from progress, cancel before that */
+    if (cancel) {
+        ret = HG_Bulk_cancel(op_id);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_cancel() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    ret = hg_test_bulk_wait(&context, 1, &args);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "hg_test_bulk_wait() failed (%s)", HG_Error_to_string(ret));
+
+    if (cancel) {
+        ret = (args.ret == HG_CANCELED) ? HG_SUCCESS : HG_FAULT;
+        HG_TEST_CHECK_HG_ERROR(error, ret,
+            "Transfer returned %s, was expecting HG_CANCELED",
+            HG_Error_to_string(args.ret));
+    } else {
+        ret = args.ret;
+        HG_TEST_CHECK_HG_ERROR(error, ret, "Error in bulk callback (%s)",
+            HG_Error_to_string(ret));
+
+        for (i = 0; i < origin.local_size; i++)
+            HG_TEST_CHECK_ERROR(((char *) origin.local_buf)[i] != (char) i,
+                error, ret, HG_FAULT,
+                "Error detected in bulk transfer, buf[%zu] = %d", i,
+                ((char *) origin.local_buf)[i]);
+    }
+
+    hg_test_bulk_origin_cleanup(&origin);
+    (void) HG_Context_destroy(context);
+    (void) HG_Finalize(hg_class);
+
+    return HG_SUCCESS;
+
+error:
+    hg_test_bulk_origin_cleanup(&origin);
+    if (context != NULL)
+        (void) HG_Context_destroy(context);
+    if (hg_class != NULL)
+        (void) HG_Finalize(hg_class);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_striped(size_t buf_size, unsigned int context_count)
+{
+    struct hg_init_info hg_init_info = HG_INIT_INFO_INITIALIZER;
+    struct hg_test_bulk_origin origin = {.hg_class = NULL};
+    struct hg_test_bulk_transfer_args args = {
+        .done = HG_ATOMIC_VAR_INIT(0), .ret = HG_SUCCESS};
+    hg_class_t *hg_class = NULL;
+    hg_context_t *contexts[HG_TEST_BULK_STRIPE_CONTEXTS] = {NULL};
+    hg_return_t ret;
+    unsigned int j;
+    size_t i;
+
+    hg_init_info.na_init_info.max_contexts = (uint8_t) context_count;
+    hg_class = HG_Init_opt2("na+sm", HG_FALSE,
+        HG_VERSION(HG_VERSION_MAJOR, HG_VERSION_MINOR), &hg_init_info);
+    HG_TEST_CHECK_ERROR(hg_class == NULL, error, ret, HG_FAULT,
+        "HG_Init_opt2() failed for striped class");
+
+    for (j = 0; j < context_count; j++) {
+        contexts[j] = HG_Context_create_id(hg_class, (uint8_t) j);
+        HG_TEST_CHECK_ERROR(contexts[j] == NULL, error, ret, HG_FAULT,
+            "HG_Context_create_id() failed");
+    }
+
+    /* Origin is segmented so that stripes also cross segment boundaries */
+    ret = hg_test_bulk_origin_setup(
+        hg_class, false, NULL, NULL, 3, buf_size / 3, &origin);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "hg_test_bulk_origin_setup() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_transfer_striped(contexts, context_count,
+        hg_test_bulk_transfer_cb, &args, HG_BULK_PULL, origin.addr,
+        origin.handle, 0, origin.local_handle, 0, origin.local_size,
+        HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "HG_Bulk_transfer_striped() failed (%s)", HG_Error_to_string(ret));
+
+    /* Stripes progress on their own context */
+    ret = hg_test_bulk_wait(contexts, context_count, &args);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "hg_test_bulk_wait() failed (%s)", HG_Error_to_string(ret));
+
+    ret = args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "Error in bulk callback (%s)", HG_Error_to_string(ret));
+
+    for (i = 0; i < origin.local_size; i++)
+        HG_TEST_CHECK_ERROR(((char *) origin.local_buf)[i] != (char) i, error,
+            ret, HG_FAULT, "Error detected in bulk transfer, buf[%zu] = %d", i,
+            ((char *) origin.local_buf)[i]);
+
+    hg_test_bulk_origin_cleanup(&origin);
+    for (j = 0; j < context_count; j++)
+        (void) HG_Context_destroy(contexts[j]);
+    (void) HG_Finalize(hg_class);
+
+    return HG_SUCCESS;
+
+error:
+    hg_test_bulk_origin_cleanup(&origin);
+    for (j = 0; j < context_count; j++)
+        if (contexts[j] != NULL)
+            (void) HG_Context_destroy(contexts[j]);
+    if (hg_class != NULL)
+        (void) HG_Finalize(hg_class);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_multi(size_t buf_size)
+{
+    struct hg_test_bulk_origin origin = {.hg_class = NULL};
+    struct hg_test_bulk_transfer_args args = {
+        .done = HG_ATOMIC_VAR_INIT(0), .ret = HG_SUCCESS};
+    struct hg_bulk_origin_desc origins[HG_TEST_BULK_MULTI_ORIGINS];
+    hg_class_t *hg_class = NULL;
+    hg_context_t *context = NULL;
+    hg_size_t fragment_size = buf_size / HG_TEST_BULK_MULTI_ORIGINS;
+    hg_return_t ret;
+    size_t i;
+
+    hg_class = HG_Init("na+sm", HG_FALSE);
+    HG_TEST_CHECK_ERROR(
+        hg_class == NULL, error, ret, HG_FAULT, "HG_Init() failed");
+
+    context = HG_Context_create(hg_class);
+    HG_TEST_CHECK_ERROR(
+        context == NULL, error, ret, HG_FAULT, "HG_Context_create() failed");
+
+    ret = hg_test_bulk_origin_setup(
+        hg_class, false, NULL, NULL, 1, buf_size, &origin);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "hg_test_bulk_origin_setup() failed (%s)", HG_Error_to_string(ret));
+
+    /* Gather fragments in reverse order so that packing can be checked */
+    for (i = 0; i < HG_TEST_BULK_MULTI_ORIGINS; i++)
+        origins[i] = (struct hg_bulk_origin_desc){.addr = origin.addr,
+            .handle = origin.handle,
+            .offset = (HG_TEST_BULK_MULTI_ORIGINS - 1 - i) * fragment_size,
+            .size = fragment_size};
+
+    ret = HG_Bulk_transfer_multi(context, hg_test_bulk_transfer_cb, &args,
+        HG_BULK_PULL, origins, HG_TEST_BULK_MULTI_ORIGINS, origin.local_handle,
+        0, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_transfer_multi() failed (%s)",
+        HG_Error_to_string(ret));
+
+    ret = hg_test_bulk_wait(&context, 1, &args);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "hg_test_bulk_wait() failed (%s)", HG_Error_to_string(ret));
+
+    ret = args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "Error in bulk callback (%s)", HG_Error_to_string(ret));
+
+    for (i = 0; i < HG_TEST_BULK_MULTI_ORIGINS * fragment_size; i++) {
+        size_t fragment = i / fragment_size,
+               expected = (HG_TEST_BULK_MULTI_ORIGINS - 1 - fragment) *
+                              fragment_size +
+                          i % fragment_size;
+
+        HG_TEST_CHECK_ERROR(((char *) origin.local_buf)[i] != (char) expected,
+            error, ret, HG_FAULT,
+            "Error detected in bulk transfer, buf[%zu] = %d", i,
+            ((char *) origin.local_buf)[i]);
+    }
+
+    hg_test_bulk_origin_cleanup(&origin);
+    (void) HG_Context_destroy(context);
+    (void) HG_Finalize(hg_class);
+
+    return HG_SUCCESS;
+
+error:
+    hg_test_bulk_origin_cleanup(&origin);
+    if (context != NULL)
+        (void) HG_Context_destroy(context);
+    if (hg_class != NULL)
+        (void) HG_Finalize(hg_class);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_self(size_t buf_size)
+{
+    struct hg_init_info hg_init_info = HG_INIT_INFO_INITIALIZER;
+    struct hg_test_bulk_origin origin = {.hg_class = NULL};
+    struct hg_test_bulk_transfer_args args = {
+        .done = HG_ATOMIC_VAR_INIT(0), .ret = HG_SUCCESS};
+    void *buf_ptrs[HG_TEST_BULK_SELF_SEGMENTS];
+    hg_size_t buf_sizes[HG_TEST_BULK_SELF_SEGMENTS];
+    uint32_t actual_count = 0;
+    hg_class_t *hg_class = NULL;
+    hg_context_t *context = NULL;
+    hg_return_t ret;
+    size_t i;
+
+    /* Local copies of more than half of the buffer are non-temporal */
+    hg_init_info.bulk_nt_copy_threshold = buf_size / 2;
+    hg_class = HG_Init_opt2("na+sm", HG_FALSE,
+        HG_VERSION(HG_VERSION_MAJOR, HG_VERSION_MINOR), &hg_init_info);
+    HG_TEST_CHECK_ERROR(hg_class == NULL, error, ret, HG_FAULT,
+        "HG_Init_opt2() failed for self class");
+
+    context = HG_Context_create(hg_class);
+    HG_TEST_CHECK_ERROR(
+        context == NULL, error, ret, HG_FAULT, "HG_Context_create() failed");
+
+    ret = hg_test_bulk_origin_setup(hg_class, true, NULL, NULL,
+        HG_TEST_BULK_SELF_SEGMENTS, buf_size / HG_TEST_BULK_SELF_SEGMENTS,
+        &origin);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "hg_test_bulk_origin_setup() failed (%s)", HG_Error_to_string(ret));
+
+    /* Origin memory can be read in place */
+    ret = HG_Bulk_access_origin(origin.addr, origin.handle, 0,
+        origin.local_size, HG_BULK_READ_ONLY, HG_TEST_BULK_SELF_SEGMENTS,
+        buf_ptrs, buf_sizes, &actual_count);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "HG_Bulk_access_origin() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(actual_count != HG_TEST_BULK_SELF_SEGMENTS, error, ret,
+        HG_FAULT, "Accessed %" PRIu32 " segments, expected %d", actual_count,
+        HG_TEST_BULK_SELF_SEGMENTS);
+    for (i = 0; i < HG_TEST_BULK_SELF_SEGMENTS; i++)
+        HG_TEST_CHECK_ERROR(buf_ptrs[i] != origin.bulk_info.buf_ptrs[i] ||
+                                buf_sizes[i] != origin.bulk_info.buf_sizes[i],
+            error, ret, HG_FAULT, "Segment %zu does not alias origin memory",
+            i);
+
+    /* But not written since origin handle is read-only */
+    ret = HG_Bulk_access_origin(origin.addr, origin.handle, 0,
+        origin.local_size, HG_BULK_READWRITE, HG_TEST_BULK_SELF_SEGMENTS,
+        buf_ptrs, buf_sizes, &actual_count);
+    HG_TEST_CHECK_ERROR(ret != HG_PERMISSION, error, ret, HG_FAULT,
+        "HG_Bulk_access_origin() returned %s, expected %s",
+        HG_Error_to_string(ret), HG_Error_to_string(HG_PERMISSION));
+
+    /* Unaligned copy that crosses origin segments */
+    ret = HG_Bulk_transfer(context, hg_test_bulk_transfer_cb, &args,
+        HG_BULK_PULL, origin.addr, origin.handle, 1, origin.local_handle, 1,
+        origin.local_size - 1, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_transfer() failed (%s)", HG_Error_to_string(ret));
+
+    ret = hg_test_bulk_wait(&context, 1, &args);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "hg_test_bulk_wait() failed (%s)", HG_Error_to_string(ret));
+
+    ret = args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "Error in bulk callback (%s)", HG_Error_to_string(ret));
+
+    for (i = 1; i < origin.local_size; i++)
+        HG_TEST_CHECK_ERROR(((char *) origin.local_buf)[i] != (char) i, error,
+            ret, HG_FAULT, "Error detected in bulk transfer, buf[%zu] = %d", i,
+            ((char *) origin.local_buf)[i]);
+
+    hg_test_bulk_origin_cleanup(&origin);
+    (void) HG_Context_destroy(context);
+    (void) HG_Finalize(hg_class);
+
+    return HG_SUCCESS;
+
+error:
+    hg_test_bulk_origin_cleanup(&origin);
+    if (context != NULL)
+        (void) HG_Context_destroy(context);
+    if (hg_class != NULL)
+        (void) HG_Finalize(hg_class);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_shared(size_t buf_size)
+{
+    struct hg_bulk_attr attrs = {
+        .mem_type = HG_MEM_TYPE_HOST, .device = 0, .shared = true};
+    struct hg_test_bulk_origin origin = {.hg_class = NULL};
+    struct hg_test_bulk_transfer_args args = {
+        .done = HG_ATOMIC_VAR_INIT(0), .ret = HG_SUCCESS};
+    hg_class_t *hg_class = NULL;
+    hg_context_t *context = NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    hg_size_t size = (hg_size_t) buf_size;
+    void *buf_ptr = NULL;
+    hg_size_t buf_ptr_size = 0;
+    uint32_t actual_count = 0;
+    hg_return_t ret;
+    size_t i;
+
+    hg_class = HG_Init("na+sm", HG_FALSE);
+    HG_TEST_CHECK_ERROR(
+        hg_class == NULL, error, ret, HG_FAULT, "HG_Init() failed");
+
+    context = HG_Context_create(hg_class);
+    HG_TEST_CHECK_ERROR(
+        context == NULL, error, ret, HG_FAULT, "HG_Context_create() failed");
+
+    /* Shared attribute is only valid when memory is allocated */
+    buf_ptr = malloc(buf_size);
+    HG_TEST_CHECK_ERROR(
+        buf_ptr == NULL, error, ret, HG_NOMEM, "Could not allocate buffer");
+    ret = HG_Bulk_create_attr(hg_class, 1, &buf_ptr, &size,
+        HG_BULK_READWRITE, &attrs, &bulk_handle);
+    free(buf_ptr);
+    buf_ptr = NULL;
+    HG_TEST_CHECK_ERROR(ret != HG_INVALID_ARG, error, ret, HG_FAULT,
+        "HG_Bulk_create_attr() returned %s, expected %s",
+        HG_Error_to_string(ret), HG_Error_to_string(HG_INVALID_ARG));
+
+    /* Origin memory is segmented so that mappings are accessed at offsets */
+    ret = hg_test_bulk_origin_setup(
+        hg_class, false, NULL, &attrs, 4, buf_size / 4, &origin);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "hg_test_bulk_origin_setup() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_transfer(context, hg_test_bulk_transfer_cb, &args,
+        HG_BULK_PULL, origin.addr, origin.handle, 0, origin.local_handle, 0,
+        origin.local_size, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_transfer() failed (%s)", HG_Error_to_string(ret));
+
+    ret = hg_test_bulk_wait(&context, 1, &args);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "hg_test_bulk_wait() failed (%s)", HG_Error_to_string(ret));
+
+    ret = args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "Error in bulk callback (%s)", HG_Error_to_string(ret));
+
+    for (i = 0; i < origin.local_size; i++)
+        HG_TEST_CHECK_ERROR(((char *) origin.local_buf)[i] != (char) i, error,
+            ret, HG_FAULT, "Error detected in bulk pull, buf[%zu] = %d", i,
+            ((char *) origin.local_buf)[i]);
+
+    /* Push data back to origin memory */
+    for (i = 0; i < origin.local_size; i++)
+        ((char *) origin.local_buf)[i] = (char) ~i;
+    hg_atomic_set32(&args.done, 0);
+
+    ret = HG_Bulk_transfer(context, hg_test_bulk_transfer_cb, &args,
+        HG_BULK_PUSH, origin.addr, origin.handle, 0, origin.local_handle, 0,
+        origin.local_size, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_transfer() failed (%s)", HG_Error_to_string(ret));
+
+    ret = hg_test_bulk_wait(&context, 1, &args);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "hg_test_bulk_wait() failed (%s)", HG_Error_to_string(ret));
+
+    ret = args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "Error in bulk callback (%s)", HG_Error_to_string(ret));
+
+    /* Memory allocated for the shared attribute is contiguous */
+    ret = HG_Bulk_access(origin.bulk_info.bulk_handle, 0, origin.local_size,
+        HG_BULK_READ_ONLY, 1, &buf_ptr, &buf_ptr_size, &actual_count);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_access() failed (%s)", HG_Error_to_string(ret));
+
+    for (i = 0; i < buf_ptr_size; i++)
+        HG_TEST_CHECK_ERROR(((char *) buf_ptr)[i] != (char) ~i, error, ret,
+            HG_FAULT, "Error detected in bulk push, buf[%zu] = %d", i,
+            ((char *) buf_ptr)[i]);
+
+    hg_test_bulk_origin_cleanup(&origin);
+    (void) HG_Context_destroy(context);
+    (void) HG_Finalize(hg_class);
+
+    return HG_SUCCESS;
+
+error:
+    if (bulk_handle != HG_BULK_NULL)
+        (void) HG_Bulk_free(bulk_handle);
+    hg_test_bulk_origin_cleanup(&origin);
+    if (context != NULL)
+        (void) HG_Context_destroy(context);
+    if (hg_class != NULL)
+        (void) HG_Finalize(hg_class);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_reg_cache(size_t buf_size)
+{
+    struct hg_init_info hg_init_info = HG_INIT_INFO_INITIALIZER;
+    hg_class_t *hg_class = NULL;
+    hg_bulk_t handles[2] = {HG_BULK_NULL, HG_BULK_NULL};
+    void *bufs[2] = {NULL, NULL};
+    hg_size_t size = (hg_size_t) buf_size;
+    hg_return_t ret;
+    int i;
+
+    /* Cache can only hold registration of one buffer */
+    hg_init_info.bulk_reg_cache_size = buf_size;
+    hg_class = HG_Init_opt2("na+sm", HG_FALSE,
+        HG_VERSION(HG_VERSION_MAJOR, HG_VERSION_MINOR), &hg_init_info);
+    HG_TEST_CHECK_ERROR(hg_class == NULL, error, ret, HG_FAULT,
+        "HG_Init_opt2() failed for registration cache class");
+
+    for (i = 0; i < 2; i++) {
+        bufs[i] = malloc(buf_size);
+        HG_TEST_CHECK_ERROR(bufs[i] == NULL, error, ret, HG_NOMEM,
+            "Could not allocate buffer");
+    }
+
+    /* Registration is re-used once first handle is freed */
+    for (i = 0; i < HG_TEST_BULK_REG_CACHE_COUNT; i++) {
+        ret = HG_Bulk_create(
+            hg_class, 1, &bufs[0], &size, HG_BULK_READWRITE, &handles[0]);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_create() failed (%s)",
+            HG_Error_to_string(ret));
+        (void) HG_Bulk_free(handles[0]);
+        handles[0] = HG_BULK_NULL;
+    }
+    ret = hg_test_bulk_reg_cache_check(
+        hg_class, HG_TEST_BULK_REG_CACHE_COUNT - 1, 1);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "Unexpected registration cache counts");
+
+    /* Handles in use share registration */
+    for (i = 0; i < 2; i++) {
+        ret = HG_Bulk_create(
+            hg_class, 1, &bufs[0], &size, HG_BULK_READWRITE, &handles[i]);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_create() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+    for (i = 0; i < 2; i++) {
+        (void) HG_Bulk_free(handles[i]);
+        handles[i] = HG_BULK_NULL;
+    }
+    ret = hg_test_bulk_reg_cache_check(
+        hg_class, HG_TEST_BULK_REG_CACHE_COUNT + 1, 1);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "Unexpected registration cache counts");
+
+    /* Second buffer evicts first one */
+    ret = HG_Bulk_create(
+        hg_class, 1, &bufs[1], &size, HG_BULK_READWRITE, &handles[1]);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    (void) HG_Bulk_free(handles[1]);
+    handles[1] = HG_BULK_NULL;
+
+    ret = HG_Bulk_create(
+        hg_class, 1, &bufs[0], &size, HG_BULK_READWRITE, &handles[0]);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    ret = hg_test_bulk_reg_cache_check(
+        hg_class, HG_TEST_BULK_REG_CACHE_COUNT + 1, 3);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "Unexpected registration cache counts");
+
+    /* Invalidated registration remains valid until handle is freed */
+    ret = HG_Bulk_cache_invalidate(hg_class, bufs[0], size);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_cache_invalidate() failed (%s)",
+        HG_Error_to_string(ret));
+
+    ret = HG_Bulk_create(
+        hg_class, 1, &bufs[0], &size, HG_BULK_READWRITE, &handles[1]);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    for (i = 0; i < 2; i++) {
+        (void) HG_Bulk_free(handles[i]);
+        handles[i] = HG_BULK_NULL;
+    }
+
+    ret = HG_Bulk_create(
+        hg_class, 1, &bufs[0], &size, HG_BULK_READWRITE, &handles[0]);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    (void) HG_Bulk_free(handles[0]);
+    handles[0] = HG_BULK_NULL;
+    ret = hg_test_bulk_reg_cache_check(
+        hg_class, HG_TEST_BULK_REG_CACHE_COUNT + 2, 4);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "Unexpected registration cache counts");
+
+    /* Permission flags are part of key */
+    ret = HG_Bulk_create(
+        hg_class, 1, &bufs[0], &size, HG_BULK_READ_ONLY, &handles[0]);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    (void) HG_Bulk_free(handles[0]);
+    handles[0] = HG_BULK_NULL;
+    ret = hg_test_bulk_reg_cache_check(
+        hg_class, HG_TEST_BULK_REG_CACHE_COUNT + 2, 5);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "Unexpected registration cache counts");
+
+    ret = HG_Finalize(hg_class);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Finalize() failed (%s)", HG_Error_to_string(ret));
+    hg_class = NULL;
+
+    for (i = 0; i < 2; i++)
+        free(bufs[i]);
+
+    return HG_SUCCESS;
+
+error:
+    for (i = 0; i < 2; i++)
+        if (handles[i] != HG_BULK_NULL)
+            (void) HG_Bulk_free(handles[i]);
+    if (hg_class != NULL)
+        (void) HG_Finalize(hg_class);
+    for (i = 0; i < 2; i++)
+        free(bufs[i]);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_reg_cache_check(hg_class_t HG_UNUSED *hg_class,
+    uint64_t HG_UNUSED hit_count, uint64_t HG_UNUSED miss_count)
+{
+#ifdef HG_HAS_DEBUG
+    struct hg_diag_counters counters;
+    hg_return_t ret;
+
+    ret = HG_Class_get_counters(hg_class, &counters);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Class_get_counters() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(counters.bulk_reg_cache_hit_count != hit_count ||
+                            counters.bulk_reg_cache_miss_count != miss_count,
+        error, ret, HG_FAULT,
+        "Registration cache hits/misses are %" PRIu64 "/%" PRIu64
+        ", expected %" PRIu64 "/%" PRIu64,
+        counters.bulk_reg_cache_hit_count, counters.bulk_reg_cache_miss_count,
+        hit_count, miss_count);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+#else
+    return HG_SUCCESS;
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_serialize(const hg_class_t *test_class, size_t buf_size)
+{
+    struct hg_init_info hg_init_info = HG_INIT_INFO_INITIALIZER;
+    char info_string[64];
+    struct hg_test_bulk_origin origin = {.hg_class = NULL};
+    hg_class_t *hg_class = NULL;
+    hg_context_t *contexts[2] = {NULL, NULL};
+    hg_size_t serialize_sizes[2], serialize_size;
+    unsigned long flags[2] = {0, HG_BULK_SM};
+    bool transfers[2] = {true, false};
+    hg_return_t ret;
+    int i;
+
+    /* Both classes use the plugin under test and route local transfers
+     * through SM so that handles also carry SM descriptors. SM forms can only
+     * be received if auto SM is supported, which is not the case if SM is
+     * already the NA plugin */
+    snprintf(info_string, sizeof(info_string), "%s+%s",
+        HG_Class_get_name(test_class), HG_Class_get_protocol(test_class));
+    hg_init_info.auto_sm = strcmp(HG_Class_get_name(test_class), "na") != 0 &&
+                           strcmp(HG_Class_get_name(test_class), "mpi") != 0;
+    transfers[1] = hg_init_info.auto_sm;
+    hg_class = HG_Init_opt2(info_string, HG_FALSE,
+        HG_VERSION(HG_VERSION_MAJOR, HG_VERSION_MINOR), &hg_init_info);
+    HG_TEST_CHECK_ERROR(hg_class == NULL, error, ret, HG_FAULT,
+        "HG_Init_opt2() failed for serialize class");
+
+    contexts[0] = HG_Context_create(hg_class);
+    HG_TEST_CHECK_ERROR(contexts[0] == NULL, error, ret, HG_FAULT,
+        "HG_Context_create() failed");
+
+    ret = hg_test_bulk_origin_setup(
+        hg_class, false, &hg_init_info, NULL, 4, buf_size / 4, &origin);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "hg_test_bulk_origin_setup() failed (%s)", HG_Error_to_string(ret));
+
+    contexts[1] = HG_Context_create(origin.hg_class);
+    HG_TEST_CHECK_ERROR(contexts[1] == NULL, error, ret, HG_FAULT,
+        "HG_Context_create() failed");
+
+    for (i = 0; i < 2; i++) {
+        ret = hg_test_bulk_serialize_check(
+            contexts, &origin, flags[i], transfers[i], &serialize_sizes[i]);
+        HG_TEST_CHECK_HG_ERROR(error, ret,
+            "hg_test_bulk_serialize_check() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    /* Forms serialized before binding must no longer be used */
+    ret = HG_Bulk_bind(origin.bulk_info.bulk_handle, contexts[1]);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_bind() failed (%s)", HG_Error_to_string(ret));
+
+    for (i = 0; i < 2; i++) {
+        ret = hg_test_bulk_serialize_check(
+            contexts, &origin, flags[i], transfers[i], &serialize_size);
+        HG_TEST_CHECK_HG_ERROR(error, ret,
+            "hg_test_bulk_serialize_check() failed (%s)",
+            HG_Error_to_string(ret));
+        HG_TEST_CHECK_ERROR(serialize_size <= serialize_sizes[i], error, ret,
+            HG_FAULT, "Bound handle serialized without address");
+    }
+
+    /* Freeing the origin handle also releases its serialized forms */
+    (void) HG_Context_destroy(contexts[1]);
+    hg_test_bulk_origin_cleanup(&origin);
+    (void) HG_Context_destroy(contexts[0]);
+    (void) HG_Finalize(hg_class);
+
+    return HG_SUCCESS;
+
+error:
+    if (contexts[1] != NULL)
+        (void) HG_Context_destroy(contexts[1]);
+    hg_test_bulk_origin_cleanup(&origin);
+    if (contexts[0] != NULL)
+        (void) HG_Context_destroy(contexts[0]);
+    if (hg_class != NULL)
+        (void) HG_Finalize(hg_class);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_serialize_check(hg_context_t **contexts,
+    struct hg_test_bulk_origin *origin, unsigned long flags, bool transfer,
+    hg_size_t *serialize_size_p)
+{
+    hg_bulk_t origin_handle = origin->bulk_info.bulk_handle;
+    hg_bulk_t handle = HG_BULK_NULL;
+    bool bound = HG_Bulk_get_addr(origin_handle) != HG_ADDR_NULL;
+    hg_size_t serialize_size =
+        HG_Bulk_get_serialize_size(origin_handle, flags);
+    char *bufs[HG_TEST_BULK_SERIALIZE_COUNT] = {NULL};
+    hg_return_t ret;
+    hg_size_t j;
+    int i;
+
+    /* Every serialization of the handle produces the same form */
+    for (i = 0; i < HG_TEST_BULK_SERIALIZE_COUNT; i++) {
+        bufs[i] = (char *) malloc(serialize_size);
+        HG_TEST_CHECK_ERROR(bufs[i] == NULL, error, ret, HG_NOMEM,
+            "Could not allocate serialize buffer");
+
+        ret = HG_Bulk_serialize(bufs[i], serialize_size, flags, origin_handle);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_serialize() failed (%s)",
+            HG_Error_to_string(ret));
+        HG_TEST_CHECK_ERROR(
+            HG_Bulk_get_serialize_size(origin_handle, flags) != serialize_size,
+            error, ret, HG_FAULT,
+            "Serialize size changed after serialization %d", i);
+        HG_TEST_CHECK_ERROR(i > 0 && memcmp(bufs[i], bufs[0], serialize_size),
+            error, ret, HG_FAULT, "Serialization %d differs from first one",
+            i);
+    }
+
+    /* Each serialized form can be used for transfers */
+    for (i = 0; transfer && i < HG_TEST_BULK_SERIALIZE_COUNT; i++) {
+        struct hg_test_bulk_transfer_args args = {
+            .done = HG_ATOMIC_VAR_INIT(0), .ret = HG_SUCCESS};
+
+        ret = HG_Bulk_deserialize(
+            origin->target_class, &handle, bufs[i], serialize_size);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_deserialize() failed (%s)",
+            HG_Error_to_string(ret));
+        HG_TEST_CHECK_ERROR((HG_Bulk_get_addr(handle) != HG_ADDR_NULL) != bound,
+            error, ret, HG_FAULT,
+            "Address of deserialized handle does not match");
+
+        memset(origin->local_buf, 0, origin->local_size);
+        if (bound)
+            ret = HG_Bulk_bind_transfer(contexts[0], hg_test_bulk_transfer_cb,
+                &args, HG_BULK_PULL, handle, 0, origin->local_handle, 0,
+                origin->local_size, HG_OP_ID_IGNORE);
+        else
+            ret = HG_Bulk_transfer(contexts[0], hg_test_bulk_transfer_cb,
+                &args, HG_BULK_PULL, origin->addr, handle, 0,
+                origin->local_handle, 0, origin->local_size, HG_OP_ID_IGNORE);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "Could not transfer (%s)",
+            HG_Error_to_string(ret));
+
+        ret = hg_test_bulk_wait(contexts, 2, &args);
+        HG_TEST_CHECK_HG_ERROR(error, ret, "hg_test_bulk_wait() failed (%s)",
+            HG_Error_to_string(ret));
+        ret = args.ret;
+        HG_TEST_CHECK_HG_ERROR(error, ret, "Error in bulk callback (%s)",
+            HG_Error_to_string(ret));
+
+        for (j = 0; j < origin->local_size; j++)
+            HG_TEST_CHECK_ERROR(((char *) origin->local_buf)[j] != (char) j,
+                error, ret, HG_FAULT,
+                "Error detected in bulk transfer, buf[%" PRIu64 "] = %d", j,
+                ((char *) origin->local_buf)[j]);
+
+        (void) HG_Bulk_free(handle);
+        handle = HG_BULK_NULL;
+    }
+
+    for (i = 0; i < HG_TEST_BULK_SERIALIZE_COUNT; i++)
+        free(bufs[i]);
+    *serialize_size_p = serialize_size;
+
+    return HG_SUCCESS;
+
+error:
+    if (handle != HG_BULK_NULL)
+        (void) HG_Bulk_free(handle);
+    for (i = 0; i < HG_TEST_BULK_SERIALIZE_COUNT; i++)
+        free(bufs[i]);
+
+    return ret;
+}
+#endif
+
 /*---------------------------------------------------------------------------*/
 int
 main(int argc, char *argv[])
@@ -333,6 +1487,39 @@ main(int argc, char *argv[])
         HG_Error_to_string(hg_ret));
     HG_PASSED();
 
+    /* Embed bulk data into RPC (overflowing if needed) */
+    hg_ret = HG_Registered_set_bulk_eager_threshold(
+        info.hg_class, hg_test_bulk_write_id_g, buf_size);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+        "HG_Registered_set_bulk_eager_threshold() failed (%s)",
+        HG_Error_to_string(hg_ret));
+
+    /* Eager bulk test (size BUFSIZE, offsets 0, 0) */
+    HG_TEST("eager contiguous RPC bulk (size BUFSIZE, offsets 0, 0)");
+    hg_ret = hg_test_bulk_forward(info.handles[0], info.target_addr,
+        hg_test_bulk_write_id_g, hg_test_bulk_forward_cb, bulk_info.bulk_handle,
+        buf_size, 0, 0, info.request);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_forward() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /* Eager bulk test (size BUFSIZE/8, offsets BUFSIZE/2 + 1, BUFSIZE/4) */
+    HG_TEST("eager contiguous RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
+            "BUFSIZE/4)");
+    hg_ret = hg_test_bulk_forward(info.handles[0], info.target_addr,
+        hg_test_bulk_write_id_g, hg_test_bulk_forward_cb, bulk_info.bulk_handle,
+        buf_size / 8, buf_size / 2 + 1, buf_size / 4, info.request);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_forward() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /* Restore class default */
+    hg_ret = HG_Registered_set_bulk_eager_threshold(
+        info.hg_class, hg_test_bulk_write_id_g, 0);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+        "HG_Registered_set_bulk_eager_threshold() failed (%s)",
+        HG_Error_to_string(hg_ret));
+
     /* Binding address info to bulk */
     if (strcmp(HG_Class_get_name(info.hg_class), "bmi") != 0 &&
         strcmp(HG_Class_get_name(info.hg_class), "mpi")) {
@@ -503,6 +1690,103 @@ main(int argc, char *argv[])
     HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_destroy() failed (%s)",
         HG_Error_to_string(hg_ret));
 
+    /**************************************************************************
+     * Offset lookup tests.
+     *************************************************************************/
+
+    HG_TEST("bulk access (256 segments of 0 to 3 bytes, all offsets)");
+    hg_ret = hg_test_bulk_access(info.hg_class);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_access() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+#ifdef NA_HAS_SM
+    /**************************************************************************
+     * Chunked bulk tests.
+     *************************************************************************/
+
+    HG_TEST("chunked bulk (size BUFSIZE, window 1)");
+    hg_ret = hg_test_bulk_chunk(
+        buf_size, buf_size / HG_TEST_BULK_CHUNK_COUNT, 1, false);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_chunk() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    HG_TEST("chunked bulk (size BUFSIZE, window 4)");
+    hg_ret = hg_test_bulk_chunk(
+        buf_size, buf_size / HG_TEST_BULK_CHUNK_COUNT, 4, false);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_chunk() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    HG_TEST("chunked bulk cancelation (size BUFSIZE, window 4)");
+    hg_ret = hg_test_bulk_chunk(
+        buf_size, buf_size / HG_TEST_BULK_CHUNK_COUNT, 4, true);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_chunk() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /**************************************************************************
+     * Striped bulk tests.
+     *************************************************************************/
+
+    HG_TEST("striped bulk (size BUFSIZE, 4 contexts)");
+    hg_ret = hg_test_bulk_striped(buf_size, HG_TEST_BULK_STRIPE_CONTEXTS);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+        "hg_test_bulk_striped() failed (%s)", HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /**************************************************************************
+     * Multi-origin tests.
+     *************************************************************************/
+
+    HG_TEST("multi-origin bulk gather (size BUFSIZE, 4 origins)");
+    hg_ret = hg_test_bulk_multi(buf_size);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_multi() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /**************************************************************************
+     * Self bulk tests.
+     *************************************************************************/
+
+    HG_TEST("self bulk access and non-temporal copy (size BUFSIZE)");
+    hg_ret = hg_test_bulk_self(buf_size);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_self() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /**************************************************************************
+     * Shared memory tests.
+     *************************************************************************/
+
+    HG_TEST("shared bulk push and pull (size BUFSIZE)");
+    hg_ret = hg_test_bulk_shared(buf_size);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_bulk_shared() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /**************************************************************************
+     * Registration cache tests.
+     *************************************************************************/
+
+    HG_TEST("bulk registration cache (size BUFSIZE)");
+    hg_ret = hg_test_bulk_reg_cache(buf_size);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+        "hg_test_bulk_reg_cache() failed (%s)", HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /**************************************************************************
+     * Serialization tests.
+     *************************************************************************/
+
+    HG_TEST("repeated bulk serialization (size BUFSIZE)");
+    hg_ret = hg_test_bulk_serialize(info.hg_class, buf_size);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+        "hg_test_bulk_serialize() failed (%s)", HG_Error_to_string(hg_ret));
+    HG_PASSED();
+#endif
+
 cleanup:
     hg_unit_cleanup(&info);
 
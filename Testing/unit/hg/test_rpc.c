@@ -7,6 +7,8 @@
 
 #include "mercury_unit.h"
 
+#include "mercury_time.h"
+
 /****************/
 /* Local Macros */
 /****************/
@@ -14,6 +16,25 @@
 /* Wait timeout in ms */
 #define HG_TEST_WAIT_TIMEOUT (HG_TEST_TIMEOUT * 1000)
 
+/* Number of RPCs forwarded from each context */
+#define HG_TEST_CONTEXT_RPC_COUNT (1000)
+
+/* Number of RPCs in flight on each context */
+#define HG_TEST_CONTEXT_RPC_INFLIGHT (32)
+
+/* Multi-recv buffers and requests posted by multi-recv target, RPCs held by
+ * target in each round and number of rounds (more RPCs are sent overall than
+ * the target buffers can hold at once) */
+#define HG_TEST_MULTI_RECV_OP_MAX    (2)
+#define HG_TEST_MULTI_RECV_POST_INIT (4)
+#define HG_TEST_MULTI_RECV_RPC_COUNT (24)
+#define HG_TEST_MULTI_RECV_ROUNDS    (3)
+
+/* Number of RPCs waited on while another thread polls, timeout of each wait
+ * in ms (responses are delayed by a few ms only) */
+#define HG_TEST_POLL_RPC_COUNT    (16)
+#define HG_TEST_POLL_WAIT_TIMEOUT (1000)
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -40,6 +61,32 @@ struct forward_no_req_cb_args {
     hg_return_t ret;
 };
 
+struct hg_test_context_args {
+    int32_t cookie_base;    /* First cookie used by context */
+    int32_t forward_count;  /* Number of RPCs forwarded */
+    int32_t complete_count; /* Number of RPCs completed */
+    hg_return_t ret;        /* First error */
+};
+
+struct hg_test_context_rpc {
+    struct hg_test_context_args *args; /* Context args */
+    hg_handle_t handle;                /* RPC handle */
+    int32_t cookie;                    /* Cookie of RPC in flight */
+};
+
+struct hg_test_nocopy_in {
+    hg_uint32_t seq;  /* Sequence number of RPC */
+    hg_uint32_t size; /* Size of payload */
+    void *data;       /* Payload */
+};
+
+struct hg_test_nocopy_args {
+    hg_handle_t handles[HG_TEST_MULTI_RECV_RPC_COUNT]; /* Handles held */
+    unsigned int recv_count;                          /* RPCs received */
+    unsigned int sent_count;                          /* RPCs sent */
+    hg_return_t ret;                                  /* First error */
+};
+
 struct hg_test_multi_thread {
     struct hg_unit_info *info;
     hg_thread_t thread;
@@ -47,6 +94,12 @@ struct hg_test_multi_thread {
     hg_return_t ret;
 };
 
+struct hg_test_poll_thread {
+    hg_context_t *context; /* Context polled */
+    hg_thread_t thread;    /* Polling thread */
+    hg_return_t ret;       /* Result of poll */
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -87,7 +140,8 @@ static hg_return_t
 hg_test_rpc_multi_cb(const struct hg_cb_info *callback_info);
 
 static hg_return_t
-hg_test_rpc_launch_threads(struct hg_unit_info *info, hg_thread_func_t func);
+hg_test_rpc_launch_threads(struct hg_unit_info *info, hg_thread_func_t func,
+    unsigned int thread_count);
 
 static HG_THREAD_RETURN_TYPE
 hg_test_rpc_multi_thread(void *arg);
@@ -104,6 +158,15 @@ hg_test_rpc_no_req_cb(const struct hg_cb_info *callback_info);
 static HG_THREAD_RETURN_TYPE
 hg_test_rpc_multi_progress_create(void *arg);
 
+static HG_THREAD_RETURN_TYPE
+hg_test_rpc_multi_context(void *arg);
+
+static hg_return_t
+hg_test_rpc_multi_context_forward(struct hg_test_context_rpc *rpc);
+
+static hg_return_t
+hg_test_rpc_multi_context_cb(const struct hg_cb_info *callback_info);
+
 static hg_return_t
 hg_test_rpc_no_req_create(
     hg_context_t *context, hg_addr_t addr, hg_cb_t callback);
@@ -111,6 +174,37 @@ hg_test_rpc_no_req_create(
 static hg_return_t
 hg_test_rpc_no_req_create_cb(const struct hg_cb_info *callback_info);
 
+static hg_return_t
+hg_test_rpc_trigger_batch(
+    hg_context_t *context, hg_handle_t handle, hg_cb_t callback);
+
+static hg_return_t
+hg_test_rpc_poll_wait(
+    hg_context_t *context, hg_handle_t handle, hg_cb_t callback);
+
+static HG_THREAD_RETURN_TYPE
+hg_test_rpc_poll_thread(void *arg);
+
+static hg_return_t
+hg_proc_hg_test_nocopy_in_t(hg_proc_t proc, void *data);
+
+static hg_return_t
+hg_test_rpc_multi_recv_nocopy(struct hg_unit_info *info);
+
+static hg_return_t
+hg_test_rpc_multi_recv_nocopy_progress(hg_context_t *origin_context,
+    hg_context_t *target_context, struct hg_test_nocopy_args *args);
+
+static hg_return_t
+hg_test_rpc_multi_recv_nocopy_check(
+    struct hg_test_nocopy_args *args, unsigned int round, hg_uint32_t size);
+
+static hg_return_t
+hg_test_rpc_nocopy_cb(hg_handle_t handle);
+
+static hg_return_t
+hg_test_rpc_nocopy_forward_cb(const struct hg_cb_info *callback_info);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -118,6 +212,7 @@ hg_test_rpc_no_req_create_cb(const struct hg_cb_info *callback_info);
 extern hg_id_t hg_test_rpc_null_id_g;
 extern hg_id_t hg_test_rpc_open_id_g;
 extern hg_id_t hg_test_rpc_open_id_no_resp_g;
+extern hg_id_t hg_test_rpc_open_id_no_copy_g;
 extern hg_id_t hg_test_overflow_id_g;
 extern hg_id_t hg_test_cancel_rpc_id_g;
 
@@ -553,20 +648,19 @@ done:
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_test_rpc_launch_threads(struct hg_unit_info *info, hg_thread_func_t func)
+hg_test_rpc_launch_threads(struct hg_unit_info *info, hg_thread_func_t func,
+    unsigned int thread_count)
 {
     struct hg_test_multi_thread *thread_infos;
     unsigned int i;
     hg_return_t ret;
     int rc;
 
-    thread_infos =
-        malloc(info->hg_test_info.thread_count * sizeof(*thread_infos));
+    thread_infos = malloc(thread_count * sizeof(*thread_infos));
     HG_TEST_CHECK_ERROR(thread_infos == NULL, error, ret, HG_NOMEM,
-        "Could not allocate thread array (%u)",
-        info->hg_test_info.thread_count);
+        "Could not allocate thread array (%u)", thread_count);
 
-    for (i = 0; i < info->hg_test_info.thread_count; i++) {
+    for (i = 0; i < thread_count; i++) {
         thread_infos[i].info = info;
         thread_infos[i].thread_id = i;
 
@@ -575,12 +669,12 @@ hg_test_rpc_launch_threads(struct hg_unit_info *info, hg_thread_func_t func)
             rc != 0, error, ret, HG_NOMEM, "hg_thread_create() failed");
     }
 
-    for (i = 0; i < info->hg_test_info.thread_count; i++) {
+    for (i = 0; i < thread_count; i++) {
         rc = hg_thread_join(thread_infos[i].thread);
         HG_TEST_CHECK_ERROR(
             rc != 0, error, ret, HG_FAULT, "hg_thread_join() failed");
     }
-    for (i = 0; i < info->hg_test_info.thread_count; i++)
+    for (i = 0; i < thread_count; i++)
         HG_TEST_CHECK_ERROR(thread_infos[i].ret != HG_SUCCESS, error, ret,
             thread_infos[i].ret, "Error from thread %u (%s)",
             thread_infos->thread_id, HG_Error_to_string(thread_infos[i].ret));
@@ -690,6 +784,159 @@ done:
     return tret;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_test_rpc_multi_context(void *arg)
+{
+    struct hg_test_multi_thread *thread_arg =
+        (struct hg_test_multi_thread *) arg;
+    struct hg_unit_info *info = thread_arg->info;
+    hg_thread_ret_t tret = (hg_thread_ret_t) 0;
+    hg_context_t *context = info->context;
+    struct hg_test_context_rpc rpcs[HG_TEST_CONTEXT_RPC_INFLIGHT];
+    struct hg_test_context_args args = {.cookie_base =
+            (int32_t) thread_arg->thread_id * HG_TEST_CONTEXT_RPC_COUNT,
+        .forward_count = 0,
+        .complete_count = 0,
+        .ret = HG_SUCCESS};
+    hg_time_t t1, t2;
+    hg_return_t ret;
+    int i;
+
+    /* Each thread forwards from its own context */
+    if (thread_arg->thread_id > 0)
+        context = info->secondary_contexts[thread_arg->thread_id - 1];
+    for (i = 0; i < HG_TEST_CONTEXT_RPC_INFLIGHT; i++)
+        rpcs[i] = (struct hg_test_context_rpc){
+            .args = &args, .handle = HG_HANDLE_NULL, .cookie = 0};
+    for (i = 0; i < HG_TEST_CONTEXT_RPC_INFLIGHT; i++) {
+        ret = HG_Create(context, info->target_addr, hg_test_rpc_open_id_g,
+            &rpcs[i].handle);
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+    }
+
+    /* Keep several RPCs in flight so that responses are only matched to the
+     * right request if no two in-flight requests share the same tag */
+    hg_time_get_current(&t1);
+    for (i = 0; i < HG_TEST_CONTEXT_RPC_INFLIGHT; i++) {
+        ret = hg_test_rpc_multi_context_forward(&rpcs[i]);
+        HG_TEST_CHECK_HG_ERROR(done, ret,
+            "hg_test_rpc_multi_context_forward() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    do {
+        unsigned int actual_count = 0;
+
+        do {
+            ret = HG_Trigger(context, 0, 100, &actual_count);
+        } while ((ret == HG_SUCCESS) && actual_count);
+        HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT, done,
+            "HG_Trigger() failed (%s)", HG_Error_to_string(ret));
+
+        if (args.complete_count == args.forward_count)
+            break;
+
+        ret = HG_Progress(context, 100);
+    } while (ret == HG_SUCCESS || ret == HG_TIMEOUT);
+    HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT, done,
+        "HG_Progress() failed (%s)", HG_Error_to_string(ret));
+    hg_time_get_current(&t2);
+
+    ret = args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "Error in HG callback (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(args.complete_count != HG_TEST_CONTEXT_RPC_COUNT, done,
+        ret, HG_FAULT, "Completed %" PRId32 " RPCs, expected %d",
+        args.complete_count, HG_TEST_CONTEXT_RPC_COUNT);
+
+    HG_TEST_LOG_DEBUG("Context %u forwarded %d RPCs at %.2f RPC/s",
+        thread_arg->thread_id, HG_TEST_CONTEXT_RPC_COUNT,
+        (double) HG_TEST_CONTEXT_RPC_COUNT /
+            hg_time_to_double(hg_time_subtract(t2, t1)));
+
+done:
+    for (i = 0; i < HG_TEST_CONTEXT_RPC_INFLIGHT; i++)
+        if (rpcs[i].handle != HG_HANDLE_NULL)
+            (void) HG_Destroy(rpcs[i].handle);
+    thread_arg->ret = ret;
+
+    hg_thread_exit(tret);
+    return tret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_multi_context_forward(struct hg_test_context_rpc *rpc)
+{
+    struct hg_test_context_args *args = rpc->args;
+    rpc_open_in_t in_struct = {.path = HG_TEST_RPC_PATH};
+    hg_return_t ret;
+
+    /* Each RPC carries a unique cookie that is echoed back as event ID,
+     * responses are delayed by the target so that they complete out of order */
+    rpc->cookie = args->cookie_base + args->forward_count;
+    in_struct.handle.cookie =
+        (hg_uint64_t) rpc->cookie | HG_TEST_RPC_COOKIE_DELAY;
+
+    ret = HG_Forward(
+        rpc->handle, hg_test_rpc_multi_context_cb, rpc, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+    args->forward_count++;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_multi_context_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_test_context_rpc *rpc =
+        (struct hg_test_context_rpc *) callback_info->arg;
+    struct hg_test_context_args *args = rpc->args;
+    rpc_open_out_t out_struct;
+    int32_t event_id;
+    hg_return_t ret = callback_info->ret;
+
+    args->complete_count++;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "Error in HG callback (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Get_output(rpc->handle, &out_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Get_output() failed (%s)", HG_Error_to_string(ret));
+    event_id = out_struct.event_id;
+
+    ret = HG_Free_output(rpc->handle, &out_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Free_output() failed (%s)", HG_Error_to_string(ret));
+
+    /* A response matched to the wrong request means that two in-flight
+     * requests were sent with the same tag */
+    HG_TEST_CHECK_ERROR(event_id != rpc->cookie, done, ret, HG_FAULT,
+        "Response cookie (%" PRId32 ") does not match request cookie (%" PRId32
+        ")",
+        event_id, rpc->cookie);
+
+    if (args->forward_count < HG_TEST_CONTEXT_RPC_COUNT) {
+        ret = hg_test_rpc_multi_context_forward(rpc);
+        HG_TEST_CHECK_HG_ERROR(done, ret,
+            "hg_test_rpc_multi_context_forward() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+done:
+    if (ret != HG_SUCCESS && args->ret == HG_SUCCESS)
+        args->ret = ret;
+
+    return HG_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_rpc_no_req(hg_context_t *context, hg_handle_t handle, hg_cb_t callback)
@@ -735,6 +982,507 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_trigger_batch(
+    hg_context_t *context, hg_handle_t handle, hg_cb_t callback)
+{
+    hg_return_t ret;
+    rpc_handle_t rpc_open_handle = {.cookie = 100};
+    struct forward_no_req_cb_args forward_cb_args = {
+        .done = HG_ATOMIC_VAR_INIT(0),
+        .rpc_handle = &rpc_open_handle,
+        .ret = HG_SUCCESS};
+    rpc_open_in_t in_struct = {
+        .handle = rpc_open_handle, .path = HG_TEST_RPC_PATH};
+
+    ret = HG_Forward(handle, callback, &forward_cb_args, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+    do {
+        struct hg_cb_info cb_infos[16];
+        unsigned int actual_count = 0, i;
+
+        /* Dispatch callbacks ourselves */
+        do {
+            ret = HG_Trigger_batch(context, 0, 16, cb_infos, &actual_count);
+            for (i = 0; i < actual_count; i++)
+                (void) callback(&cb_infos[i]);
+            HG_Trigger_batch_release(cb_infos, actual_count);
+        } while ((ret == HG_SUCCESS) && actual_count);
+        HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT, error,
+            "HG_Trigger_batch() failed (%s)", HG_Error_to_string(ret));
+
+        if (hg_atomic_get32(&forward_cb_args.done))
+            break;
+
+        ret = HG_Progress(context, 0);
+    } while (ret == HG_SUCCESS || ret == HG_TIMEOUT);
+    HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT, error,
+        "HG_Progress() failed (%s)", HG_Error_to_string(ret));
+
+    ret = forward_cb_args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "Error in HG callback (%s)", HG_Error_to_string(ret));
+
+    return HG_SUCCESS;
+
+error:
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_poll_wait(
+    hg_context_t *context, hg_handle_t handle, hg_cb_t callback)
+{
+    hg_context_t *poll_context;
+    hg_return_t ret;
+    int i;
+
+    /* Progress is serialized on a context, poll from another context so
+     * that both threads progress the same NA class concurrently */
+    poll_context = HG_Context_create(HG_Context_get_class(context));
+    HG_TEST_CHECK_ERROR(poll_context == NULL, error, ret, HG_FAULT,
+        "HG_Context_create() failed");
+
+    for (i = 0; i < HG_TEST_POLL_RPC_COUNT; i++) {
+        /* Response is delayed so that the poll happens while we block */
+        rpc_handle_t rpc_open_handle = {
+            .cookie = HG_TEST_RPC_COOKIE_DELAY | 0x3};
+        struct forward_no_req_cb_args forward_cb_args = {
+            .done = HG_ATOMIC_VAR_INIT(0),
+            .rpc_handle = &rpc_open_handle,
+            .ret = HG_SUCCESS};
+        rpc_open_in_t in_struct = {
+            .handle = rpc_open_handle, .path = HG_TEST_RPC_PATH};
+        struct hg_test_poll_thread poll_thread = {
+            .context = poll_context, .ret = HG_SUCCESS};
+        int rc;
+
+        ret = HG_Forward(handle, callback, &forward_cb_args, &in_struct);
+        HG_TEST_CHECK_HG_ERROR(
+            destroy, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+        rc = hg_thread_create(
+            &poll_thread.thread, hg_test_rpc_poll_thread, &poll_thread);
+        HG_TEST_CHECK_ERROR(
+            rc != 0, destroy, ret, HG_NOMEM, "hg_thread_create() failed");
+
+        do {
+            unsigned int actual_count = 0;
+
+            do {
+                ret = HG_Trigger(context, 0, 100, &actual_count);
+            } while ((ret == HG_SUCCESS) && actual_count);
+            HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT,
+                join, "HG_Trigger() failed (%s)", HG_Error_to_string(ret));
+
+            if (hg_atomic_get32(&forward_cb_args.done)) {
+                ret = HG_SUCCESS;
+                break;
+            }
+
+            /* Response must wake us up even if the other thread polled */
+            ret = HG_Progress(context, HG_TEST_POLL_WAIT_TIMEOUT);
+        } while (ret == HG_SUCCESS);
+        HG_TEST_CHECK_HG_ERROR(
+            join, ret, "HG_Progress() failed (%s)", HG_Error_to_string(ret));
+
+join:
+        rc = hg_thread_join(poll_thread.thread);
+        HG_TEST_CHECK_ERROR(
+            rc != 0, destroy, ret, HG_FAULT, "hg_thread_join() failed");
+        if (ret != HG_SUCCESS)
+            goto destroy;
+        ret = poll_thread.ret;
+        HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT,
+            destroy, "HG_Progress() failed (%s)", HG_Error_to_string(ret));
+
+        ret = forward_cb_args.ret;
+        HG_TEST_CHECK_HG_ERROR(destroy, ret, "Error in HG callback (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    ret = HG_Context_destroy(poll_context);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Context_destroy() failed (%s)",
+        HG_Error_to_string(ret));
+
+    return HG_SUCCESS;
+
+destroy:
+    (void) HG_Context_destroy(poll_context);
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_test_rpc_poll_thread(void *arg)
+{
+    struct hg_test_poll_thread *poll_thread =
+        (struct hg_test_poll_thread *) arg;
+    hg_thread_ret_t tret = (hg_thread_ret_t) 0;
+
+    /* Poll once while the main thread is blocked */
+    hg_time_sleep(hg_time_from_ms(1));
+    poll_thread->ret = HG_Progress(poll_thread->context, 0);
+
+    hg_thread_exit(tret);
+    return tret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_proc_hg_test_nocopy_in_t(hg_proc_t proc, void *data)
+{
+    struct hg_test_nocopy_in *struct_data = (struct hg_test_nocopy_in *) data;
+    hg_return_t ret;
+
+    ret = hg_proc_uint32_t(proc, &struct_data->seq);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    ret = hg_proc_uint32_t(proc, &struct_data->size);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    /* Payload is decoded into buffer provided by caller */
+    if (hg_proc_get_op(proc) != HG_FREE && struct_data->size > 0)
+        ret = hg_proc_raw(proc, struct_data->data, struct_data->size);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_multi_recv_nocopy(struct hg_unit_info *info)
+{
+    struct hg_init_info hg_init_info = HG_INIT_INFO_INITIALIZER;
+    struct hg_test_nocopy_args args;
+    struct hg_test_nocopy_in in_struct;
+    hg_handle_t handles[HG_TEST_MULTI_RECV_RPC_COUNT] = {HG_HANDLE_NULL};
+    na_class_t *na_class = NULL;
+    hg_class_t *hg_class = NULL;
+    hg_context_t *context = NULL;
+    hg_addr_t self_addr = HG_ADDR_NULL, target_addr = HG_ADDR_NULL;
+    char info_string[256], addr_string[256];
+    hg_size_t addr_string_size = sizeof(addr_string);
+    hg_id_t id = 0;
+    hg_uint32_t size;
+    char *data = NULL;
+#ifdef HG_HAS_DEBUG
+    struct hg_diag_counters counters;
+    uint64_t nocopy_count;
+#endif
+    unsigned int i, j, round;
+    hg_return_t ret;
+    int rc;
+
+    memset(&args, 0, sizeof(args));
+
+    /* Target requires its own class with few multi-recv buffers */
+    rc = snprintf(info_string, sizeof(info_string), "%s+%s",
+        HG_Class_get_name(info->hg_class),
+        HG_Class_get_protocol(info->hg_class));
+    HG_TEST_CHECK_ERROR(rc < 0 || rc >= (int) sizeof(info_string), error, ret,
+        HG_OVERFLOW, "snprintf() failed, rc: %d", rc);
+
+    na_class = NA_Initialize(info_string, true);
+    HG_TEST_CHECK_ERROR(na_class == NULL, error, ret, HG_NA_ERROR,
+        "NA_Initialize() failed for %s", info_string);
+
+    /* Nothing to check if multi-recv is not supported */
+    if (!NA_Has_opt_feature(na_class, NA_OPT_MULTI_RECV)) {
+        NA_Finalize(na_class);
+        return HG_SUCCESS;
+    }
+
+    hg_init_info.na_class = na_class;
+    hg_init_info.request_post_init = HG_TEST_MULTI_RECV_POST_INIT;
+    hg_init_info.multi_recv_op_max = HG_TEST_MULTI_RECV_OP_MAX;
+    hg_init_info.multi_recv_copy_threshold = HG_TEST_MULTI_RECV_OP_MAX;
+    hg_class = HG_Init_opt2(info_string, HG_TRUE,
+        HG_VERSION(HG_VERSION_MAJOR, HG_VERSION_MINOR), &hg_init_info);
+    HG_TEST_CHECK_ERROR(hg_class == NULL, error, ret, HG_FAULT,
+        "HG_Init_opt2() failed for multi-recv class");
+
+    context = HG_Context_create(hg_class);
+    HG_TEST_CHECK_ERROR(context == NULL, error, ret, HG_FAULT,
+        "HG_Context_create() failed");
+
+    /* Target holds on to handles and their input, IDs match on both sides */
+    id = HG_Register_name(hg_class, "hg_test_rpc_nocopy",
+        hg_proc_hg_test_nocopy_in_t, NULL, hg_test_rpc_nocopy_cb);
+    HG_TEST_CHECK_ERROR(
+        id == 0, error, ret, HG_FAULT, "HG_Register_name() failed");
+    ret = HG_Register_data(hg_class, id, &args, NULL);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Register_data() failed (%s)", HG_Error_to_string(ret));
+    ret = HG_Registered_disable_response(hg_class, id, HG_TRUE);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "HG_Registered_disable_response() failed (%s)",
+        HG_Error_to_string(ret));
+    ret = HG_Registered_disable_input_copy(hg_class, id, HG_TRUE);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "HG_Registered_disable_input_copy() failed (%s)",
+        HG_Error_to_string(ret));
+
+    id = HG_Register_name(info->hg_class, "hg_test_rpc_nocopy",
+        hg_proc_hg_test_nocopy_in_t, NULL, NULL);
+    HG_TEST_CHECK_ERROR(
+        id == 0, error, ret, HG_FAULT, "HG_Register_name() failed");
+    ret = HG_Registered_disable_response(info->hg_class, id, HG_TRUE);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "HG_Registered_disable_response() failed (%s)",
+        HG_Error_to_string(ret));
+
+    ret = HG_Addr_self(hg_class, &self_addr);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Addr_self() failed (%s)", HG_Error_to_string(ret));
+
+    ret =
+        HG_Addr_to_string(hg_class, addr_string, &addr_string_size, self_addr);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Addr_to_string() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Addr_lookup2(info->hg_class, addr_string, &target_addr);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Addr_lookup2() failed (%s)", HG_Error_to_string(ret));
+
+    for (i = 0; i < HG_TEST_MULTI_RECV_RPC_COUNT; i++) {
+        ret = HG_Create(info->context, target_addr, id, &handles[i]);
+        HG_TEST_CHECK_HG_ERROR(
+            error, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+    }
+
+    /* Each request takes about half of an unexpected message so that
+     * buffers get consumed after a few requests */
+    size = (hg_uint32_t) (HG_Class_get_input_eager_size(info->hg_class) / 2);
+    data = (char *) malloc(size);
+    HG_TEST_CHECK_ERROR(
+        data == NULL, error, ret, HG_NOMEM, "Could not allocate payload");
+
+#ifdef HG_HAS_DEBUG
+    ret = HG_Class_get_counters(hg_class, &counters);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Class_get_counters() failed (%s)",
+        HG_Error_to_string(ret));
+    nocopy_count = counters.rpc_multi_recv_nocopy_count;
+#endif
+
+    for (round = 0; round < HG_TEST_MULTI_RECV_ROUNDS; round++) {
+        args.recv_count = 0;
+        args.sent_count = 0;
+
+        for (i = 0; i < HG_TEST_MULTI_RECV_RPC_COUNT; i++) {
+            in_struct.seq = round * HG_TEST_MULTI_RECV_RPC_COUNT + i;
+            in_struct.size = size;
+            in_struct.data = data;
+            for (j = 0; j < size; j++)
+                data[j] = (char) (in_struct.seq * 7 + j);
+
+            ret = HG_Forward(
+                handles[i], hg_test_rpc_nocopy_forward_cb, &args, &in_struct);
+            HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Forward() failed (%s)",
+                HG_Error_to_string(ret));
+        }
+
+        ret = hg_test_rpc_multi_recv_nocopy_progress(
+            info->context, context, &args);
+        HG_TEST_CHECK_HG_ERROR(error, ret,
+            "hg_test_rpc_multi_recv_nocopy_progress() failed (%s)",
+            HG_Error_to_string(ret));
+
+        /* Payloads must still be intact, buffers that were consumed can only
+         * be reposted once handles release their input */
+        ret = hg_test_rpc_multi_recv_nocopy_check(&args, round, size);
+        HG_TEST_CHECK_HG_ERROR(error, ret,
+            "hg_test_rpc_multi_recv_nocopy_check() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+#ifdef HG_HAS_DEBUG
+    ret = HG_Class_get_counters(hg_class, &counters);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Class_get_counters() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(counters.rpc_multi_recv_nocopy_count <= nocopy_count,
+        error, ret, HG_FAULT,
+        "rpc_multi_recv_nocopy_count did not increase (%" PRIu64 ")",
+        counters.rpc_multi_recv_nocopy_count);
+#endif
+
+    for (i = 0; i < HG_TEST_MULTI_RECV_RPC_COUNT; i++)
+        (void) HG_Destroy(handles[i]);
+    free(data);
+    (void) HG_Deregister(info->hg_class, id);
+    (void) HG_Addr_free(info->hg_class, target_addr);
+    (void) HG_Addr_free(hg_class, self_addr);
+    (void) HG_Context_destroy(context);
+    (void) HG_Finalize(hg_class);
+    (void) NA_Finalize(na_class);
+
+    return HG_SUCCESS;
+
+error:
+    for (i = 0; i < args.recv_count; i++)
+        (void) HG_Destroy(args.handles[i]);
+    for (i = 0; i < HG_TEST_MULTI_RECV_RPC_COUNT; i++)
+        if (handles[i] != HG_HANDLE_NULL)
+            (void) HG_Destroy(handles[i]);
+    free(data);
+    if (id != 0)
+        (void) HG_Deregister(info->hg_class, id);
+    if (target_addr != HG_ADDR_NULL)
+        (void) HG_Addr_free(info->hg_class, target_addr);
+    if (self_addr != HG_ADDR_NULL)
+        (void) HG_Addr_free(hg_class, self_addr);
+    if (context != NULL)
+        (void) HG_Context_destroy(context);
+    if (hg_class != NULL)
+        (void) HG_Finalize(hg_class);
+    if (na_class != NULL)
+        (void) NA_Finalize(na_class);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_multi_recv_nocopy_progress(hg_context_t *origin_context,
+    hg_context_t *target_context, struct hg_test_nocopy_args *args)
+{
+    hg_time_t deadline, now = hg_time_from_ms(0);
+    hg_return_t ret;
+
+    hg_time_get_current_ms(&now);
+    deadline = hg_time_add(now, hg_time_from_ms(HG_TEST_WAIT_TIMEOUT));
+
+    while (args->recv_count < HG_TEST_MULTI_RECV_RPC_COUNT ||
+           args->sent_count < HG_TEST_MULTI_RECV_RPC_COUNT) {
+        hg_context_t *contexts[2] = {origin_context, target_context};
+        unsigned int i;
+
+        for (i = 0; i < 2; i++) {
+            unsigned int actual_count = 0;
+
+            do {
+                ret = HG_Trigger(contexts[i], 0, 1, &actual_count);
+            } while ((ret == HG_SUCCESS) && actual_count);
+            HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT,
+                error, "HG_Trigger() failed (%s)", HG_Error_to_string(ret));
+
+            ret = HG_Progress(contexts[i], 0);
+            HG_TEST_CHECK_ERROR_NORET(ret != HG_SUCCESS && ret != HG_TIMEOUT,
+                error, "HG_Progress() failed (%s)", HG_Error_to_string(ret));
+        }
+
+        ret = args->ret;
+        HG_TEST_CHECK_HG_ERROR(
+            error, ret, "Error in HG callback (%s)", HG_Error_to_string(ret));
+
+        hg_time_get_current_ms(&now);
+        HG_TEST_CHECK_ERROR(hg_time_less(deadline, now), error, ret,
+            HG_TIMEOUT, "Received %u RPCs out of %d", args->recv_count,
+            HG_TEST_MULTI_RECV_RPC_COUNT);
+    }
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_multi_recv_nocopy_check(
+    struct hg_test_nocopy_args *args, unsigned int round, hg_uint32_t size)
+{
+    struct hg_test_nocopy_in in_struct;
+    char *data = NULL;
+    unsigned int i, j;
+    hg_return_t ret;
+
+    data = (char *) malloc(size);
+    HG_TEST_CHECK_ERROR(
+        data == NULL, error, ret, HG_NOMEM, "Could not allocate payload");
+
+    for (i = 0; i < args->recv_count; i++) {
+        in_struct.seq = 0;
+        in_struct.size = 0;
+        in_struct.data = data;
+
+        ret = HG_Get_input(args->handles[i], &in_struct);
+        HG_TEST_CHECK_HG_ERROR(
+            error, ret, "HG_Get_input() failed (%s)", HG_Error_to_string(ret));
+
+        HG_TEST_CHECK_ERROR(
+            in_struct.seq / HG_TEST_MULTI_RECV_RPC_COUNT != round ||
+                in_struct.size != size,
+            free, ret, HG_FAULT,
+            "Unexpected RPC (seq=%" PRIu32 ", size=%" PRIu32 ")",
+            in_struct.seq, in_struct.size);
+        for (j = 0; j < size; j++)
+            HG_TEST_CHECK_ERROR(data[j] != (char) (in_struct.seq * 7 + j), free,
+                ret, HG_FAULT,
+                "Error detected in payload of RPC %" PRIu32 ", data[%u] = %d",
+                in_struct.seq, j, data[j]);
+
+        ret = HG_Free_input(args->handles[i], &in_struct);
+        HG_TEST_CHECK_HG_ERROR(
+            error, ret, "HG_Free_input() failed (%s)", HG_Error_to_string(ret));
+    }
+
+    /* Release input so that buffers can be reposted */
+    for (i = 0; i < args->recv_count; i++)
+        (void) HG_Destroy(args->handles[i]);
+    args->recv_count = 0;
+    free(data);
+
+    return HG_SUCCESS;
+
+free:
+    (void) HG_Free_input(args->handles[i], &in_struct);
+error:
+    free(data);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_nocopy_cb(hg_handle_t handle)
+{
+    const struct hg_info *hg_info = HG_Get_info(handle);
+    struct hg_test_nocopy_args *args = (struct hg_test_nocopy_args *)
+        HG_Registered_data(hg_info->hg_class, hg_info->id);
+
+    /* Handle and its input are released once all RPCs are received */
+    if (args->recv_count == HG_TEST_MULTI_RECV_RPC_COUNT) {
+        HG_TEST_LOG_ERROR("Received too many RPCs");
+        args->ret = HG_OVERFLOW;
+        return HG_Destroy(handle);
+    }
+    args->handles[args->recv_count++] = handle;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_nocopy_forward_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_test_nocopy_args *args =
+        (struct hg_test_nocopy_args *) callback_info->arg;
+
+    if (callback_info->ret != HG_SUCCESS && args->ret == HG_SUCCESS)
+        args->ret = callback_info->ret;
+    args->sent_count++;
+
+    return HG_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_rpc_no_req_create(
@@ -993,6 +1741,23 @@ main(int argc, char *argv[])
         HG_Error_to_string(hg_ret));
     HG_PASSED();
 
+    /* RPC test with no response and no input copy */
+    HG_TEST("RPC without response and input copy");
+    if (info.hg_test_info.na_test_info.self_send) {
+        hg_ret = HG_Create(info.context, info.target_addr,
+            hg_test_rpc_open_id_no_copy_g, &handle);
+        HG_TEST_CHECK_HG_ERROR(error, hg_ret, "HG_Create() failed (%s)",
+            HG_Error_to_string(hg_ret));
+    } else
+        handle = info.handles[0];
+    hg_ret = hg_test_rpc_input(handle, info.target_addr,
+        hg_test_rpc_open_id_no_copy_g, hg_test_rpc_no_output_cb, info.request);
+    if (info.hg_test_info.na_test_info.self_send)
+        HG_Destroy(handle);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret, "hg_test_rpc_input() failed (%s)",
+        HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
     if (!info.hg_test_info.na_test_info.self_send) {
         /* RPC test with invalid ID (not registered on server) */
         inv_id = MERCURY_REGISTER(info.hg_class, "inv_id", void, void, NULL);
@@ -1036,26 +1801,52 @@ main(int argc, char *argv[])
 
     /* RPC test with multiple handles in flight from multiple threads */
     HG_TEST("concurrent multi RPCs");
-    hg_ret = hg_test_rpc_launch_threads(&info, hg_test_rpc_multi_thread);
+    hg_ret = hg_test_rpc_launch_threads(
+        &info, hg_test_rpc_multi_thread, info.hg_test_info.thread_count);
     HG_TEST_CHECK_HG_ERROR(error, hg_ret,
         "hg_test_rpc_launch_threads() failed (%s)", HG_Error_to_string(hg_ret));
     HG_PASSED();
 
     /* RPC test from multiple threads with concurrent progress */
     HG_TEST("concurrent progress");
-    hg_ret = hg_test_rpc_launch_threads(&info, hg_test_rpc_multi_progress);
+    hg_ret = hg_test_rpc_launch_threads(
+        &info, hg_test_rpc_multi_progress, info.hg_test_info.thread_count);
     HG_TEST_CHECK_HG_ERROR(error, hg_ret,
         "hg_test_rpc_launch_threads() failed (%s)", HG_Error_to_string(hg_ret));
     HG_PASSED();
 
     /* RPC test from multiple threads with concurrent progress */
     HG_TEST("concurrent progress w/create");
-    hg_ret =
-        hg_test_rpc_launch_threads(&info, hg_test_rpc_multi_progress_create);
+    hg_ret = hg_test_rpc_launch_threads(&info,
+        hg_test_rpc_multi_progress_create, info.hg_test_info.thread_count);
     HG_TEST_CHECK_HG_ERROR(error, hg_ret,
         "hg_test_rpc_launch_threads() failed (%s)", HG_Error_to_string(hg_ret));
     HG_PASSED();
 
+    /* RPC test with callbacks dispatched from batched trigger */
+    HG_TEST("RPC with batched trigger");
+    hg_ret =
+        HG_Reset(info.handles[0], info.target_addr, hg_test_rpc_open_id_g);
+    HG_TEST_CHECK_HG_ERROR(
+        error, hg_ret, "HG_Reset() failed (%s)", HG_Error_to_string(hg_ret));
+    hg_ret = hg_test_rpc_trigger_batch(
+        info.context, info.handles[0], hg_test_rpc_no_req_cb);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+        "hg_test_rpc_trigger_batch() failed (%s)", HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /* RPC test with one thread blocked in progress while another polls */
+    HG_TEST("RPC with blocking and polling progress");
+    hg_ret =
+        HG_Reset(info.handles[0], info.target_addr, hg_test_rpc_open_id_g);
+    HG_TEST_CHECK_HG_ERROR(
+        error, hg_ret, "HG_Reset() failed (%s)", HG_Error_to_string(hg_ret));
+    hg_ret = hg_test_rpc_poll_wait(
+        info.context, info.handles[0], hg_test_rpc_no_req_cb);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+        "hg_test_rpc_poll_wait() failed (%s)", HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
     /* RPC test with multiple handles to multiple target contexts */
     if (info.hg_test_info.na_test_info.max_contexts) {
         hg_uint8_t i,
@@ -1073,6 +1864,28 @@ main(int argc, char *argv[])
         HG_PASSED();
     }
 
+    /* RPC test with one thread forwarding from each origin context, also
+     * run with a single context to check tags of in-flight RPCs */
+    HG_TEST("concurrent multi context origin RPCs");
+    hg_ret = hg_test_rpc_launch_threads(&info, hg_test_rpc_multi_context,
+        (info.hg_test_info.na_test_info.max_contexts > 1)
+            ? info.hg_test_info.na_test_info.max_contexts
+            : 1);
+    HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+        "hg_test_rpc_launch_threads() failed (%s)", HG_Error_to_string(hg_ret));
+    HG_PASSED();
+
+    /* RPC test with multi-recv buffers held by handles (OFI only) */
+    if (!info.hg_test_info.na_test_info.no_multi_recv &&
+        strcmp(HG_Class_get_name(info.hg_class), "ofi") == 0) {
+        HG_TEST("RPC with multi-recv input not copied");
+        hg_ret = hg_test_rpc_multi_recv_nocopy(&info);
+        HG_TEST_CHECK_HG_ERROR(error, hg_ret,
+            "hg_test_rpc_multi_recv_nocopy() failed (%s)",
+            HG_Error_to_string(hg_ret));
+        HG_PASSED();
+    }
+
     hg_unit_cleanup(&info);
 
     return EXIT_SUCCESS;
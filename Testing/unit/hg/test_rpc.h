@@ -18,6 +18,9 @@ typedef struct {
     hg_uint64_t cookie;
 } rpc_handle_t;
 
+/* Cookie flag used to delay responses by up to 3 ms (low cookie bits) */
+#define HG_TEST_RPC_COOKIE_DELAY (1ULL << 32)
+
 #ifdef HG_HAS_BOOST
 
 /* 1. Generate processor and struct for additional struct types
@@ -0,0 +1,363 @@
+/**
+ * Copyright (c) 2013-2022 UChicago Argonne, LLC and The HDF Group.
+ * Copyright (c) 2022-2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "na_test.h"
+
+#include "mercury_atomic.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Size of shared buffers */
+#define NA_TEST_SM_MEM_SIZE (4096)
+
+/* Number of shared buffers, more than the peer mapping cache can hold */
+#define NA_TEST_SM_MEM_COUNT (20)
+
+/* Offset added to segments so that they exceed shared memory bounds */
+#define NA_TEST_SM_MEM_OOB_OFFSET ((size_t) 1 << 30)
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+struct na_test_sm_mem_info {
+    na_class_t *na_class;   /* NA class */
+    na_context_t *context;  /* NA context */
+    na_addr_t *self_addr;   /* Self address */
+    na_op_id_t *op_id;      /* RMA op ID */
+    void *local_buf;        /* Local buffer */
+    na_mem_handle_t *local; /* Local handle */
+};
+
+struct na_test_sm_mem_buf {
+    void *buf;               /* Shared buffer */
+    void *plugin_data;       /* Plugin data of shared buffer */
+    na_mem_handle_t *handle; /* Handle of shared buffer */
+    na_mem_handle_t *remote; /* Deserialized handle of shared buffer */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static na_return_t
+na_test_sm_mem_buf_create(struct na_test_sm_mem_info *info, char value,
+    size_t oob_offset, struct na_test_sm_mem_buf *mem_buf);
+
+static void
+na_test_sm_mem_buf_destroy(
+    struct na_test_sm_mem_info *info, struct na_test_sm_mem_buf *mem_buf);
+
+static void
+na_test_sm_mem_cb(const struct na_cb_info *na_cb_info);
+
+static na_return_t
+na_test_sm_mem_rma(struct na_test_sm_mem_info *info, na_cb_type_t cb_type,
+    na_mem_handle_t *remote);
+
+static na_return_t
+na_test_sm_mem_check(const void *buf, char value);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_test_sm_mem_buf_create(struct na_test_sm_mem_info *info, char value,
+    size_t oob_offset, struct na_test_sm_mem_buf *mem_buf)
+{
+    void *serialize_buf = NULL;
+    size_t serialize_size;
+    na_return_t ret;
+
+    mem_buf->buf = NA_Mem_alloc(
+        info->na_class, NA_TEST_SM_MEM_SIZE, 0, &mem_buf->plugin_data);
+    NA_TEST_CHECK_ERROR(mem_buf->buf == NULL, error, ret, NA_NOMEM,
+        "NA_Mem_alloc() failed");
+    memset(mem_buf->buf, value, NA_TEST_SM_MEM_SIZE);
+
+    ret = NA_Mem_handle_create(info->na_class, mem_buf->buf,
+        NA_TEST_SM_MEM_SIZE, NA_MEM_READWRITE, &mem_buf->handle);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "NA_Mem_handle_create() failed (%s)",
+        NA_Error_to_string(ret));
+
+    ret = NA_Mem_register(info->na_class, mem_buf->handle, NA_MEM_TYPE_HOST, 0);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "NA_Mem_register() failed (%s)",
+        NA_Error_to_string(ret));
+
+    /* Handle is received as it would be from a peer */
+    serialize_size =
+        NA_Mem_handle_get_serialize_size(info->na_class, mem_buf->handle);
+    serialize_buf = malloc(serialize_size);
+    NA_TEST_CHECK_ERROR(serialize_buf == NULL, error, ret, NA_NOMEM,
+        "Could not allocate serialize buffer");
+
+    ret = NA_Mem_handle_serialize(
+        info->na_class, serialize_buf, serialize_size, mem_buf->handle);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "NA_Mem_handle_serialize() failed (%s)",
+        NA_Error_to_string(ret));
+
+    /* Segments are serialized last, move last one past the allocation */
+    if (oob_offset > 0) {
+        struct iovec iov;
+
+        memcpy(&iov, (char *) serialize_buf + serialize_size - sizeof(iov),
+            sizeof(iov));
+        iov.iov_base = (char *) iov.iov_base + oob_offset;
+        memcpy((char *) serialize_buf + serialize_size - sizeof(iov), &iov,
+            sizeof(iov));
+    }
+
+    ret = NA_Mem_handle_deserialize(
+        info->na_class, &mem_buf->remote, serialize_buf, serialize_size);
+    NA_TEST_CHECK_NA_ERROR(error, ret,
+        "NA_Mem_handle_deserialize() failed (%s)", NA_Error_to_string(ret));
+
+    free(serialize_buf);
+
+    return NA_SUCCESS;
+
+error:
+    free(serialize_buf);
+    na_test_sm_mem_buf_destroy(info, mem_buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_test_sm_mem_buf_destroy(
+    struct na_test_sm_mem_info *info, struct na_test_sm_mem_buf *mem_buf)
+{
+    if (mem_buf->remote != NULL) {
+        NA_Mem_handle_free(info->na_class, mem_buf->remote);
+        mem_buf->remote = NULL;
+    }
+    if (mem_buf->handle != NULL) {
+        (void) NA_Mem_deregister(info->na_class, mem_buf->handle);
+        NA_Mem_handle_free(info->na_class, mem_buf->handle);
+        mem_buf->handle = NULL;
+    }
+    if (mem_buf->buf != NULL) {
+        NA_Mem_free(info->na_class, mem_buf->buf, mem_buf->plugin_data);
+        mem_buf->buf = NULL;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_test_sm_mem_cb(const struct na_cb_info *na_cb_info)
+{
+    hg_atomic_int32_t *done = (hg_atomic_int32_t *) na_cb_info->arg;
+
+    hg_atomic_set32(done, (na_cb_info->ret == NA_SUCCESS) ? 1 : -1);
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_test_sm_mem_rma(struct na_test_sm_mem_info *info, na_cb_type_t cb_type,
+    na_mem_handle_t *remote)
+{
+    hg_atomic_int32_t done = HG_ATOMIC_VAR_INIT(0);
+    na_return_t ret;
+
+    if (cb_type == NA_CB_PUT)
+        ret = NA_Put(info->na_class, info->context, na_test_sm_mem_cb, &done,
+            info->local, 0, remote, 0, NA_TEST_SM_MEM_SIZE, info->self_addr, 0,
+            info->op_id);
+    else
+        ret = NA_Get(info->na_class, info->context, na_test_sm_mem_cb, &done,
+            info->local, 0, remote, 0, NA_TEST_SM_MEM_SIZE, info->self_addr, 0,
+            info->op_id);
+    if (ret != NA_SUCCESS)
+        return ret;
+
+    /* Copies complete immediately, only the callback needs to be triggered */
+    while (hg_atomic_get32(&done) == 0) {
+        unsigned int count = 0;
+
+        ret = NA_Trigger(info->context, 1, &count);
+        NA_TEST_CHECK_ERROR_NORET(ret != NA_SUCCESS && ret != NA_TIMEOUT,
+            error, "NA_Trigger() failed (%s)", NA_Error_to_string(ret));
+        if (count > 0)
+            continue;
+
+        ret = NA_Poll(info->na_class, info->context, &count);
+        NA_TEST_CHECK_NA_ERROR(
+            error, ret, "NA_Poll() failed (%s)", NA_Error_to_string(ret));
+    }
+    NA_TEST_CHECK_ERROR(hg_atomic_get32(&done) < 0, error, ret, NA_FAULT,
+        "Error in RMA callback");
+
+    return NA_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_test_sm_mem_check(const void *buf, char value)
+{
+    size_t i;
+
+    for (i = 0; i < NA_TEST_SM_MEM_SIZE; i++)
+        if (((const char *) buf)[i] != value) {
+            NA_TEST_LOG_ERROR("Error detected in RMA, buf[%zu] = %d", i,
+                ((const char *) buf)[i]);
+            return NA_FAULT;
+        }
+
+    return NA_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(void)
+{
+    struct na_test_sm_mem_info info = {.na_class = NULL};
+    struct na_test_sm_mem_buf mem_bufs[NA_TEST_SM_MEM_COUNT];
+    na_return_t ret;
+    int i;
+
+    memset(mem_bufs, 0, sizeof(mem_bufs));
+
+    info.na_class = NA_Initialize("na+sm", true);
+    NA_TEST_CHECK_ERROR(info.na_class == NULL, error, ret, NA_FAULT,
+        "NA_Initialize() failed");
+
+    info.context = NA_Context_create(info.na_class);
+    NA_TEST_CHECK_ERROR(info.context == NULL, error, ret, NA_FAULT,
+        "NA_Context_create() failed");
+
+    ret = NA_Addr_self(info.na_class, &info.self_addr);
+    NA_TEST_CHECK_NA_ERROR(
+        error, ret, "NA_Addr_self() failed (%s)", NA_Error_to_string(ret));
+
+    info.op_id = NA_Op_create(info.na_class, NA_OP_SINGLE);
+    NA_TEST_CHECK_ERROR(
+        info.op_id == NULL, error, ret, NA_NOMEM, "NA_Op_create() failed");
+
+    info.local_buf = malloc(NA_TEST_SM_MEM_SIZE);
+    NA_TEST_CHECK_ERROR(info.local_buf == NULL, error, ret, NA_NOMEM,
+        "Could not allocate local buffer");
+
+    ret = NA_Mem_handle_create(info.na_class, info.local_buf,
+        NA_TEST_SM_MEM_SIZE, NA_MEM_READWRITE, &info.local);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "NA_Mem_handle_create() failed (%s)",
+        NA_Error_to_string(ret));
+
+    ret = NA_Mem_register(info.na_class, info.local, NA_MEM_TYPE_HOST, 0);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "NA_Mem_register() failed (%s)",
+        NA_Error_to_string(ret));
+
+    /**************************************************************************
+     * Put and get.
+     *************************************************************************/
+
+    NA_TEST("shared memory get and put");
+    ret = na_test_sm_mem_buf_create(&info, 1, 0, &mem_bufs[0]);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "na_test_sm_mem_buf_create() failed");
+
+    memset(info.local_buf, 0, NA_TEST_SM_MEM_SIZE);
+    ret = na_test_sm_mem_rma(&info, NA_CB_GET, mem_bufs[0].remote);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "Get from shared memory failed (%s)",
+        NA_Error_to_string(ret));
+    ret = na_test_sm_mem_check(info.local_buf, 1);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "Get returned wrong data");
+
+    memset(info.local_buf, 2, NA_TEST_SM_MEM_SIZE);
+    ret = na_test_sm_mem_rma(&info, NA_CB_PUT, mem_bufs[0].remote);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "Put to shared memory failed (%s)",
+        NA_Error_to_string(ret));
+    ret = na_test_sm_mem_check(mem_bufs[0].buf, 2);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "Put wrote wrong data");
+    NA_PASSED();
+
+    /**************************************************************************
+     * Mapping cache eviction.
+     *************************************************************************/
+
+    NA_TEST("shared memory mapping eviction");
+    for (i = 1; i < NA_TEST_SM_MEM_COUNT; i++) {
+        ret = na_test_sm_mem_buf_create(&info, (char) i, 0, &mem_bufs[i]);
+        NA_TEST_CHECK_NA_ERROR(
+            error, ret, "na_test_sm_mem_buf_create() failed");
+    }
+
+    /* First mappings are evicted, then mapped again */
+    for (i = 0; i < 2 * NA_TEST_SM_MEM_COUNT; i++) {
+        int j = i % NA_TEST_SM_MEM_COUNT;
+
+        ret = na_test_sm_mem_rma(&info, NA_CB_GET, mem_bufs[j].remote);
+        NA_TEST_CHECK_NA_ERROR(error, ret,
+            "Get from shared memory failed (%s)", NA_Error_to_string(ret));
+        ret = na_test_sm_mem_check(info.local_buf, (char) ((j == 0) ? 2 : j));
+        NA_TEST_CHECK_NA_ERROR(error, ret, "Get returned wrong data");
+    }
+    NA_PASSED();
+
+    /**************************************************************************
+     * Out-of-bounds segments.
+     *************************************************************************/
+
+    NA_TEST("out-of-bounds shared memory segments");
+    na_test_sm_mem_buf_destroy(&info, &mem_bufs[0]);
+    ret = na_test_sm_mem_buf_create(
+        &info, 1, NA_TEST_SM_MEM_OOB_OFFSET, &mem_bufs[0]);
+    NA_TEST_CHECK_NA_ERROR(error, ret, "na_test_sm_mem_buf_create() failed");
+
+    ret = na_test_sm_mem_rma(&info, NA_CB_GET, mem_bufs[0].remote);
+    NA_TEST_CHECK_ERROR(ret != NA_INVALID_ARG, error, ret, NA_FAULT,
+        "Get returned %s, expected %s", NA_Error_to_string(ret),
+        NA_Error_to_string(NA_INVALID_ARG));
+
+    ret = na_test_sm_mem_rma(&info, NA_CB_PUT, mem_bufs[0].remote);
+    NA_TEST_CHECK_ERROR(ret != NA_INVALID_ARG, error, ret, NA_FAULT,
+        "Put returned %s, expected %s", NA_Error_to_string(ret),
+        NA_Error_to_string(NA_INVALID_ARG));
+    NA_PASSED();
+
+    for (i = 0; i < NA_TEST_SM_MEM_COUNT; i++)
+        na_test_sm_mem_buf_destroy(&info, &mem_bufs[i]);
+    (void) NA_Mem_deregister(info.na_class, info.local);
+    NA_Mem_handle_free(info.na_class, info.local);
+    free(info.local_buf);
+    NA_Op_destroy(info.na_class, info.op_id);
+    NA_Addr_free(info.na_class, info.self_addr);
+    (void) NA_Context_destroy(info.na_class, info.context);
+    (void) NA_Finalize(info.na_class);
+
+    return EXIT_SUCCESS;
+
+error:
+    NA_FAILED();
+    for (i = 0; i < NA_TEST_SM_MEM_COUNT; i++)
+        na_test_sm_mem_buf_destroy(&info, &mem_bufs[i]);
+    if (info.local != NULL) {
+        (void) NA_Mem_deregister(info.na_class, info.local);
+        NA_Mem_handle_free(info.na_class, info.local);
+    }
+    free(info.local_buf);
+    if (info.op_id != NULL)
+        NA_Op_destroy(info.na_class, info.op_id);
+    if (info.self_addr != NULL)
+        NA_Addr_free(info.na_class, info.self_addr);
+    if (info.context != NULL)
+        (void) NA_Context_destroy(info.na_class, info.context);
+    if (info.na_class != NULL)
+        (void) NA_Finalize(info.na_class);
+
+    return EXIT_FAILURE;
+}
@@ -25,6 +25,8 @@ main(void)
     struct my_entry my_entry1 = {.value = value1};
     struct my_entry my_entry2 = {.value = value2};
     struct my_entry *my_entry_ptr;
+    void *entries[HG_TEST_QUEUE_SIZE];
+    unsigned int count;
 
     hg_atomic_queue = hg_atomic_queue_alloc(HG_TEST_QUEUE_SIZE);
     if (!hg_atomic_queue) {
@@ -62,6 +64,30 @@ main(void)
         goto done;
     }
 
+    hg_atomic_queue_push(hg_atomic_queue, &my_entry1);
+    hg_atomic_queue_push(hg_atomic_queue, &my_entry2);
+
+    count = hg_atomic_queue_pop_mc_n(hg_atomic_queue, entries, 1);
+    if (count != 1 || entries[0] != &my_entry1) {
+        fprintf(stderr, "Error: could not pop first entry\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    count = hg_atomic_queue_pop_mc_n(
+        hg_atomic_queue, entries, HG_TEST_QUEUE_SIZE);
+    if (count != 1 || entries[0] != &my_entry2) {
+        fprintf(stderr, "Error: could not pop remaining entry\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    if (!hg_atomic_queue_is_empty(hg_atomic_queue)) {
+        fprintf(stderr, "Error: queue should be empty\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
 done:
     hg_atomic_queue_free(hg_atomic_queue);
     return ret;
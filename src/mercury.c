@@ -36,6 +36,9 @@
 #define HG_STRINGIFY(x)       HG_UTIL_STRINGIFY(x)
 #define HG_SUBSYS_NAME_STRING HG_STRINGIFY(HG_SUBSYS_NAME)
 
+/* Max number of callback infos retrieved at once by batched trigger */
+#define HG_TRIGGER_BATCH_MAX (64)
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -46,6 +49,7 @@ struct hg_private_class {
     hg_return_t (*handle_create)(hg_handle_t, void *); /* handle_create */
     void *handle_create_arg;                           /* handle_create arg */
     hg_checksum_level_t checksum_level;                /* Checksum level */
+    hg_size_t bulk_eager_threshold;                    /* Eager bulk size */
     bool bulk_eager;                                   /* Eager bulk proc */
     bool release_input_early;                          /* Release input early */
     bool no_overflow;                                  /* No overflow buffer */
@@ -58,6 +62,7 @@ struct hg_proc_info {
     hg_proc_cb_t out_proc_cb;      /* Output proc callback */
     void *data;                    /* User data */
     void (*free_callback)(void *); /* User data free callback */
+    hg_size_t bulk_eager_threshold; /* Eager bulk size (0 for class) */
 };
 
 /* HG handle */
@@ -202,6 +207,16 @@ hg_core_forward_cb(const struct hg_core_cb_info *callback_info);
 static HG_INLINE hg_return_t
 hg_core_respond_cb(const struct hg_core_cb_info *callback_info);
 
+/**
+ * Convert callback info returned by batched trigger to user callback info.
+ * Internal callbacks are executed directly.
+ *
+ * \return true if user callback info was set
+ */
+static bool
+hg_trigger_batch_info(const struct hg_completion_cb_info *hg_completion_cb_info,
+    struct hg_cb_info *hg_cb_info);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -683,9 +698,21 @@ hg_set_struct(struct hg_private_handle *hg_handle,
 
     /* Attempt to use eager bulk transfers when appropriate */
     if (HG_HANDLE_CLASS(&hg_handle->handle)->bulk_eager &&
-        !HG_Core_addr_is_self(hg_handle->handle.core_handle->info.addr))
+        !HG_Core_addr_is_self(hg_handle->handle.core_handle->info.addr)) {
         proc_flags |= HG_PROC_BULK_EAGER;
 
+        /* Eager threshold may force use of overflow, RPC value takes
+         * precedence over class value */
+        if (!HG_HANDLE_CLASS(&hg_handle->handle)->no_overflow) {
+            hg_size_t threshold = hg_proc_info->bulk_eager_threshold;
+
+            if (threshold == 0)
+                threshold =
+                    HG_HANDLE_CLASS(&hg_handle->handle)->bulk_eager_threshold;
+            hg_proc_set_bulk_eager_threshold(proc, threshold);
+        }
+    }
+
     hg_proc_set_flags(proc, proc_flags);
 
     /* Encode parameters */
@@ -1035,6 +1062,82 @@ hg_core_respond_cb(const struct hg_core_cb_info *callback_info)
     return HG_SUCCESS;
 }
 
+/*---------------------------------------------------------------------------*/
+static bool
+hg_trigger_batch_info(const struct hg_completion_cb_info *hg_completion_cb_info,
+    struct hg_cb_info *hg_cb_info)
+{
+    const struct hg_core_cb_info *hg_core_cb_info =
+        &hg_completion_cb_info->info.core;
+    hg_core_handle_t core_handle = HG_CORE_HANDLE_NULL;
+    bool ret = false;
+
+    if (hg_completion_cb_info->op_type == HG_BULK) {
+        const struct hg_cb_info *hg_bulk_cb_info =
+            &hg_completion_cb_info->info.bulk;
+
+        /* Extra payload transfers are internal, references that were kept for
+         * callback info are otherwise released by HG_Trigger_batch_release() */
+        if (hg_completion_cb_info->callback.bulk == hg_get_extra_payload_cb) {
+            (void) hg_get_extra_payload_cb(hg_bulk_cb_info);
+            (void) HG_Bulk_free(hg_bulk_cb_info->info.bulk.origin_handle);
+            (void) HG_Bulk_free(hg_bulk_cb_info->info.bulk.local_handle);
+        } else {
+            *hg_cb_info = *hg_bulk_cb_info;
+            ret = true;
+        }
+
+        return ret;
+    }
+
+    if (hg_completion_cb_info->callback.core == hg_core_addr_lookup_cb) {
+        struct hg_op_id *hg_op_id = (struct hg_op_id *) hg_core_cb_info->arg;
+
+        *hg_cb_info = (struct hg_cb_info){.arg = hg_op_id->arg,
+            .ret = hg_core_cb_info->ret,
+            .type = hg_op_id->type,
+            .info.lookup.addr = (hg_addr_t) hg_core_cb_info->info.lookup.addr};
+        ret = (hg_op_id->callback != NULL);
+
+        /* NB. OK to free, op ID is not re-used */
+        free(hg_op_id);
+    } else if (hg_completion_cb_info->callback.core == hg_core_forward_cb) {
+        struct hg_private_handle *hg_handle =
+            (struct hg_private_handle *) hg_core_cb_info->arg;
+
+        *hg_cb_info = (struct hg_cb_info){.arg = hg_handle->forward_arg,
+            .ret = hg_core_cb_info->ret,
+            .type = hg_core_cb_info->type,
+            .info.forward.handle = (hg_handle_t) hg_handle};
+        ret = (hg_handle->forward_cb != NULL);
+        core_handle = hg_core_cb_info->info.forward.handle;
+    } else if (hg_completion_cb_info->callback.core == hg_core_respond_cb) {
+        struct hg_private_handle *hg_handle =
+            (struct hg_private_handle *) hg_core_cb_info->arg;
+
+        *hg_cb_info = (struct hg_cb_info){.arg = hg_handle->respond_arg,
+            .ret = hg_core_cb_info->ret,
+            .type = hg_core_cb_info->type,
+            .info.respond.handle = (hg_handle_t) hg_handle};
+        ret = (hg_handle->respond_cb != NULL);
+        core_handle = hg_core_cb_info->info.respond.handle;
+    } else {
+        /* Not a user callback, execute it */
+        (void) hg_completion_cb_info->callback.core(hg_core_cb_info);
+        if (hg_core_cb_info->type == HG_CB_FORWARD)
+            core_handle = hg_core_cb_info->info.forward.handle;
+        else if (hg_core_cb_info->type == HG_CB_RESPOND)
+            core_handle = hg_core_cb_info->info.respond.handle;
+    }
+
+    /* Release reference that was kept for callback info unless it is returned,
+     * in which case it is released by HG_Trigger_batch_release() */
+    if (!ret && core_handle != HG_CORE_HANDLE_NULL)
+        (void) HG_Core_destroy(core_handle);
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Version_get(
@@ -1096,8 +1199,14 @@ HG_Init_opt2(const char *na_info_string, uint8_t na_listen,
             HG_MAJOR(version), HG_MINOR(version));
 
         /* Get init info and overwrite defaults */
-        if (HG_VERSION_GE(version, HG_VERSION(2, 3)))
+        if (HG_VERSION_GE(version, HG_VERSION(2, 5)))
             hg_init_info = *hg_init_info_p;
+        else if (HG_VERSION_GE(version, HG_VERSION(2, 4)))
+            hg_init_info_dup_2_4(&hg_init_info,
+                (const struct hg_init_info_2_4 *) hg_init_info_p);
+        else if (HG_VERSION_GE(version, HG_VERSION(2, 3)))
+            hg_init_info_dup_2_3(&hg_init_info,
+                (const struct hg_init_info_2_3 *) hg_init_info_p);
         else
             hg_init_info_dup_2_2(&hg_init_info,
                 (const struct hg_init_info_2_2 *) hg_init_info_p);
@@ -1105,6 +1214,7 @@ HG_Init_opt2(const char *na_info_string, uint8_t na_listen,
 
     /* Save bulk eager information */
     hg_class->bulk_eager = !hg_init_info.no_bulk_eager;
+    hg_class->bulk_eager_threshold = hg_init_info.bulk_eager_threshold;
 
     /* Save checksum level information */
 #ifdef HG_HAS_CHECKSUMS
@@ -1600,6 +1710,65 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_disable_input_copy(
+    hg_class_t *hg_class, hg_id_t id, uint8_t disable)
+{
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(
+        cls, hg_class == NULL, error, ret, HG_INVALID_ARG, "NULL HG class");
+
+    return HG_Core_registered_disable_input_copy(
+        hg_class->core_class, id, disable);
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_disabled_input_copy(
+    hg_class_t *hg_class, hg_id_t id, uint8_t *disabled_p)
+{
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(
+        cls, hg_class == NULL, error, ret, HG_INVALID_ARG, "NULL HG class");
+
+    return HG_Core_registered_disabled_input_copy(
+        hg_class->core_class, id, disabled_p);
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_set_bulk_eager_threshold(
+    hg_class_t *hg_class, hg_id_t id, hg_size_t threshold)
+{
+    struct hg_proc_info *hg_proc_info = NULL;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(
+        cls, hg_class == NULL, error, ret, HG_INVALID_ARG, "NULL HG class");
+
+    /* Retrieve proc function from function map */
+    hg_proc_info = (struct hg_proc_info *) HG_Core_registered_data(
+        hg_class->core_class, id);
+    HG_CHECK_SUBSYS_ERROR(cls, hg_proc_info == NULL, error, ret, HG_NOENTRY,
+        "Could not get registered data for RPC ID %" PRIu64, id);
+
+    hg_proc_info->bulk_eager_threshold = threshold;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Addr_lookup1(hg_context_t *context, hg_cb_t callback, void *arg,
@@ -2299,3 +2468,78 @@ HG_Trigger(hg_context_t *context, unsigned int timeout, unsigned int max_count,
 done:
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Trigger_batch(hg_context_t *context, unsigned int timeout,
+    unsigned int max_count, struct hg_cb_info *cb_infos,
+    unsigned int *actual_count_p)
+{
+    struct hg_completion_cb_info hg_completion_cb_infos[HG_TRIGGER_BATCH_MAX];
+    unsigned int count = 0;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(
+        poll, context == NULL, done, ret, HG_INVALID_ARG, "NULL HG context");
+    HG_CHECK_SUBSYS_ERROR(poll, max_count > 0 && cb_infos == NULL, done, ret,
+        HG_INVALID_ARG, "NULL callback info array");
+
+    do {
+        unsigned int i, batch_count = 0,
+                        batch_max = (max_count - count < HG_TRIGGER_BATCH_MAX)
+                                        ? max_count - count
+                                        : HG_TRIGGER_BATCH_MAX;
+
+        /* Only wait for the first batch */
+        ret = hg_core_trigger_batch(context->core_context,
+            (count == 0) ? timeout : 0, batch_max, hg_completion_cb_infos,
+            &batch_count);
+        if (ret == HG_TIMEOUT && count > 0)
+            ret = HG_SUCCESS;
+        HG_CHECK_SUBSYS_ERROR_NORET(poll,
+            ret != HG_SUCCESS && ret != HG_TIMEOUT, done,
+            "Could not trigger operations from context (%s)",
+            HG_Error_to_string(ret));
+
+        for (i = 0; i < batch_count; i++)
+            if (hg_trigger_batch_info(
+                    &hg_completion_cb_infos[i], &cb_infos[count]))
+                count++;
+
+        /* Leave if completion queue has been drained */
+        if (ret != HG_SUCCESS || batch_count < batch_max)
+            break;
+    } while (count < max_count);
+
+done:
+    /* Entries returned on error must also be released */
+    if (actual_count_p)
+        *actual_count_p = count;
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+HG_Trigger_batch_release(struct hg_cb_info *cb_infos, unsigned int count)
+{
+    unsigned int i;
+
+    for (i = 0; i < count; i++) {
+        switch (cb_infos[i].type) {
+            case HG_CB_FORWARD:
+                (void) HG_Destroy(cb_infos[i].info.forward.handle);
+                break;
+            case HG_CB_RESPOND:
+                (void) HG_Destroy(cb_infos[i].info.respond.handle);
+                break;
+            case HG_CB_BULK:
+                (void) HG_Bulk_free(cb_infos[i].info.bulk.origin_handle);
+                (void) HG_Bulk_free(cb_infos[i].info.bulk.local_handle);
+                break;
+            case HG_CB_LOOKUP:
+            default:
+                break;
+        }
+    }
+}
@@ -587,6 +587,59 @@ HG_PUBLIC hg_return_t
 HG_Registered_disabled_response(
     hg_class_t *hg_class, hg_id_t id, uint8_t *disabled_p);
 
+/**
+ * Disable copy of input payload for a given RPC ID. When multi-recv is used
+ * and multi_recv_copy_threshold is reached, the input payload of an RPC is
+ * normally copied before the RPC callback is executed so that the multi-recv
+ * buffer it was received in can be reposted. Disabling that copy lets the RPC
+ * callback use the payload in place; the RPC callback must then release it
+ * promptly, either by calling HG_Get_input() with the release_input_early init
+ * info parameter set, HG_Release_input_buf() or HG_Destroy().
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param disable [IN]          boolean (HG_TRUE to disable
+ *                                       HG_FALSE to re-enable)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_disable_input_copy(
+    hg_class_t *hg_class, hg_id_t id, uint8_t disable);
+
+/**
+ * Check if input copy is disabled for a given RPC ID
+ * (i.e., HG_Registered_disable_input_copy() has been called for this RPC ID).
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param disabled_p [OUT]      boolean (HG_TRUE if disabled
+ *                                       HG_FALSE if enabled)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_disabled_input_copy(
+    hg_class_t *hg_class, hg_id_t id, uint8_t *disabled_p);
+
+/**
+ * Set the eager bulk threshold for a given RPC ID. Data of read-only bulk
+ * handles that is at most threshold bytes and that is passed as input or
+ * output of that RPC is always embedded into the RPC message, while larger
+ * data is never embedded. This overrides the bulk_eager_threshold init info
+ * parameter for that RPC, a value of 0 restores the class default. Has no
+ * effect if either no_bulk_eager or no_overflow init info parameter is set.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param threshold [IN]        max size of embedded bulk data
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_set_bulk_eager_threshold(
+    hg_class_t *hg_class, hg_id_t id, hg_size_t threshold);
+
 /**
  * Lookup an addr from a peer address/name. Addresses need to be
  * freed by calling HG_Addr_free(). After completion, user callback is
@@ -1083,6 +1136,42 @@ HG_PUBLIC hg_return_t
 HG_Trigger(hg_context_t *context, unsigned int timeout, unsigned int max_count,
     unsigned int *actual_count_p);
 
+/**
+ * Retrieve at most max_count completed operations without executing their
+ * callbacks. Callback info that would have been passed to the user callback
+ * of each operation (forward, respond, lookup, bulk transfer) is copied to
+ * cb_infos instead, so that the caller can dispatch completions itself.
+ * RPC handlers are still executed as part of this call. If timeout is
+ * non-zero, wait up to timeout before returning.
+ *
+ * \remark Handles referenced from cb_infos (RPC handles of forward and
+ * respond operations, origin and local handles of bulk transfers) are kept
+ * valid until HG_Trigger_batch_release() is called on the returned entries,
+ * which must be done once the caller is done dispatching them.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param timeout [IN]          timeout (in milliseconds)
+ * \param max_count [IN]        maximum number of callback infos returned
+ * \param cb_infos [OUT]        array of at least max_count callback infos
+ * \param actual_count_p [OUT]  actual number of callback infos returned
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Trigger_batch(hg_context_t *context, unsigned int timeout,
+    unsigned int max_count, struct hg_cb_info *cb_infos,
+    unsigned int *actual_count_p);
+
+/**
+ * Release references that were kept on handles for callback infos returned
+ * by HG_Trigger_batch(). Entries must no longer be accessed after this call.
+ *
+ * \param cb_infos [IN/OUT]      array of callback infos
+ * \param count [IN]             number of callback infos returned
+ */
+HG_PUBLIC void
+HG_Trigger_batch_release(struct hg_cb_info *cb_infos, unsigned int count);
+
 /**
  * Retrieve file descriptor from internal wait object when supported.
  * The descriptor can be used by upper layers for manual polling through the
@@ -18,6 +18,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Non-temporal stores for large local copies */
+#if defined(__SSE2__)
+#    include <emmintrin.h>
+#    define HG_BULK_HAS_NT_COPY
+#endif
+
 /****************/
 /* Local Macros */
 /****************/
@@ -25,6 +31,18 @@
 /* Limit for number of segments statically allocated */
 #define HG_BULK_STATIC_MAX (8)
 
+/* Max number of extra NA op IDs kept in a context pool */
+#define HG_BULK_NA_OP_POOL_MAX (4096)
+
+/* Min size of each stripe of a striped transfer */
+#define HG_BULK_STRIPE_MIN (1 << 16)
+
+/* Alignment of non-temporal stores */
+#define HG_BULK_NT_ALIGN (16)
+
+/* Min number of segments for offsets to be looked up in segment end offsets */
+#define HG_BULK_SEGMENT_ENDS_MIN (64)
+
 /* Additional internal bulk flags (can hold up to 8 bits) */
 #define HG_BULK_ALLOC (1 << 4) /* memory is allocated */
 #define HG_BULK_BIND  (1 << 5) /* address is bound to segment */
@@ -82,9 +100,20 @@
     ((x)->desc.info.segment_count > HG_BULK_STATIC_MAX) ? (x)->desc.segments.d \
                                                         : (x)->desc.segments.s
 
-#define HG_BULK_MEM_HANDLES(x, count, flags)                                   \
-    (count > HG_BULK_STATIC_MAX && !(flags & HG_BULK_REGV)) ? (x)->handles.d   \
-                                                            : (x)->handles.s
+/* Get number of NA memory handles (with HG_BULK_REGV, regv_max is set and each
+ * handle covers a group of up to regv_max segments) */
+#define HG_BULK_MEM_HANDLE_COUNT(x)                                            \
+    (((x)->regv_max > 0)                                                       \
+            ? ((x)->desc.info.segment_count + (x)->regv_max - 1) /             \
+                  (x)->regv_max                                                \
+            : (x)->desc.info.segment_count)
+
+#define HG_BULK_MEM_HANDLES(x, count)                                          \
+    ((count) > HG_BULK_STATIC_MAX) ? (x)->handles.d : (x)->handles.s
+
+/* Cached serialized form of handle (forms with and without SM differ) */
+#define HG_BULK_SERIALIZE_BLOB(x, flags)                                       \
+    (&(x)->serialize_blobs[((flags) & HG_BULK_SM) ? 1 : 0])
 
 #define HG_BULK_NA_OP_IDS(x)                                                   \
     ((x)->op_count > HG_BULK_STATIC_MAX) ? (x)->na_op_ids.d : (x)->na_op_ids.s
@@ -175,9 +204,18 @@ struct hg_bulk {
 #endif
     struct hg_bulk_attr attrs;   /* Memory attributes */
     hg_core_addr_t addr;         /* Addr (valid if bound to handle) */
-    void *serialize_ptr;         /* Cached serialization buffer */
-    hg_size_t serialize_size;    /* Cached serialization size */
-    hg_atomic_int32_t ref_count; /* Reference count */
+    na_class_t *alloc_class;     /* Class that allocated shared memory */
+    void *alloc_buf;             /* Memory allocated for shared attr */
+    void *alloc_data;            /* Plugin data of shared memory */
+    struct hg_bulk_segment *regv_segments; /* Ranges covered by NA handles */
+    struct hg_bulk_reg_cache *reg_cache;   /* Registration cache (if used) */
+    void *serialize_ptr;                   /* Cached serialization buffer */
+    hg_size_t serialize_size;              /* Cached serialization size */
+    hg_atomic_int64_t serialize_blobs[2];  /* Serialized forms (no SM, SM) */
+    hg_atomic_int32_t serialize_count;     /* Number of serializations */
+    hg_atomic_int64_t segment_ends;        /* End offsets of segments */
+    hg_atomic_int32_t ref_count;           /* Reference count */
+    uint32_t regv_max; /* Max segments per NA handle (HG_BULK_REGV) */
     uint8_t context_id;          /* Context ID (valid if bound to handle) */
     bool registered;             /* Handle was registered */
 };
@@ -186,6 +224,7 @@ struct hg_bulk {
 typedef struct {
     na_op_id_t *s[HG_BULK_STATIC_MAX]; /* Static array */
     na_op_id_t **d;                    /* Dynamic array */
+    uint32_t d_max;                    /* Dynamic array size */
 } hg_bulk_na_op_id_t;
 
 /* HG Bulk op ID */
@@ -200,6 +239,9 @@ struct hg_bulk_op_id {
 #ifdef NA_HAS_SM
     hg_bulk_na_op_id_t na_sm_op_ids; /* NA SM operations IDs */
 #endif
+    struct hg_bulk_pipeline *pipeline;    /* Chunked transfer state */
+    struct hg_bulk_op_id *parent;         /* Parent op that ID is part of */
+    struct hg_bulk_op_id **stripes;       /* Op IDs of stripes (if parent) */
     hg_core_context_t *core_context;      /* Context */
     na_class_t *na_class;                 /* NA class */
     na_context_t *na_context;             /* NA context */
@@ -208,9 +250,20 @@ struct hg_bulk_op_id {
     hg_atomic_int32_t op_completed_count; /* Number of operations completed */
     hg_atomic_int32_t ref_count;          /* Refcount */
     uint32_t op_count;                    /* Number of ongoing operations */
+    uint32_t stripe_count;                /* Number of stripes posted */
+    uint32_t stripe_max;                  /* Size of stripes array */
     bool reuse;                           /* Re-use op ID once ref_count is 0 */
 };
 
+/* Pool of extra NA op IDs used by multi-segment transfers */
+struct hg_bulk_na_op_pool {
+    na_class_t *na_class;  /* NA class */
+    na_op_id_t **op_ids;   /* Available NA op IDs */
+    hg_thread_spin_t lock; /* Pool lock */
+    uint32_t count;        /* Number of available NA op IDs */
+    uint32_t max;          /* Size of op_ids array */
+};
+
 /* Pool of op IDs */
 struct hg_bulk_op_pool {
     hg_thread_mutex_t extend_mutex;          /* To extend pool */
@@ -218,14 +271,14 @@ struct hg_bulk_op_pool {
     hg_core_context_t *core_context;         /* Context */
     LIST_HEAD(, hg_bulk_op_id) pending_list; /* Pending op IDs */
     hg_thread_spin_t pending_list_lock;      /* Pending list lock */
-    unsigned long count;                     /* Number of op IDs */
-    bool extending;                          /* When extending the pool */
+    struct hg_bulk_na_op_pool na_op_pool;    /* Pool of NA op IDs */
+#ifdef NA_HAS_SM
+    struct hg_bulk_na_op_pool na_sm_op_pool; /* Pool of NA SM op IDs */
+#endif
+    unsigned long count; /* Number of op IDs */
+    bool extending;      /* When extending the pool */
 };
 
-/* Wrapper on top of memcpy */
-typedef void (*hg_bulk_copy_op_t)(void *local_address, hg_size_t local_offset,
-    void *remote_address, hg_size_t remote_offset, hg_size_t data_size);
-
 /* Wrapper on top of NA layer */
 typedef na_return_t (*na_bulk_op_t)(na_class_t *na_class, na_context_t *context,
     na_cb_t callback, void *arg, na_mem_handle_t *local_mem_handle,
@@ -233,6 +286,78 @@ typedef na_return_t (*na_bulk_op_t)(na_class_t *na_class, na_context_t *context,
     na_offset_t remote_offset, size_t data_size, na_addr_t *remote_addr,
     uint8_t remote_id, na_op_id_t *op_id);
 
+/* Chunk pipeline slot (one per NA op ID, passed as NA callback arg) */
+struct hg_bulk_pipeline_slot {
+    struct hg_bulk_op_id *hg_bulk_op_id; /* Op ID that slot belongs to */
+    na_op_id_t *na_op_id;                /* NA op ID re-posted by slot */
+};
+
+/* Chunk pipeline state (kept across re-uses of op ID) */
+struct hg_bulk_pipeline {
+    struct hg_bulk_segment origin_segment; /* Copy of single origin segment */
+    struct hg_bulk_segment local_segment;  /* Copy of single local segment */
+    const struct hg_bulk_segment *origin_segments; /* Origin NA segments */
+    const struct hg_bulk_segment *local_segments;  /* Local NA segments */
+    na_mem_handle_t **origin_mem_handles;          /* Origin NA handles */
+    na_mem_handle_t **local_mem_handles;           /* Local NA handles */
+    na_addr_t *na_origin_addr;                     /* Origin NA address */
+    na_bulk_op_t na_bulk_op;                       /* NA operation */
+    hg_thread_spin_t lock;                         /* Lock for fields below */
+    hg_size_t origin_segment_offset; /* Offset in current origin segment */
+    hg_size_t local_segment_offset;  /* Offset in current local segment */
+    hg_size_t remaining_size;        /* Size left to post */
+    hg_size_t chunk_size;            /* Max size of NA operations */
+    uint32_t origin_segment_index;   /* Current origin segment */
+    uint32_t local_segment_index;    /* Current local segment */
+    uint32_t origin_count;           /* Number of origin NA segments */
+    uint32_t local_count;            /* Number of local NA segments */
+    uint32_t posted_count;           /* Number of chunks posted */
+    uint32_t completed_count;        /* Number of chunks completed */
+    uint32_t slot_max;               /* Number of slots */
+    uint8_t origin_id;               /* Origin context ID */
+    struct hg_bulk_pipeline_slot slots[]; /* Remain last */
+};
+
+/* Serialized form of a bulk handle without embedded data, kept for handles
+ * that are serialized more than once */
+struct hg_bulk_serialize_blob {
+    hg_size_t size; /* Serialized size */
+    char buf[];     /* Serialized handle */
+};
+
+/* Cached NA registration, entries are kept in a treap ordered by key where
+ * each node also records the highest end address of its subtree so that
+ * entries overlapping an address range can be found */
+struct hg_bulk_reg_entry {
+    struct hg_bulk_reg_entry *left;      /* Left subtree */
+    struct hg_bulk_reg_entry *right;     /* Right subtree */
+    struct hg_bulk_reg_entry *next;      /* Next invalidated entry */
+    TAILQ_ENTRY(hg_bulk_reg_entry) list; /* Entry in LRU/detached list */
+    na_class_t *na_class;                /* NA class */
+    na_mem_handle_t *mem_handle;         /* NA mem handle */
+    size_t serialize_size;               /* Cached serialize size */
+    uintptr_t base;                      /* Start address */
+    size_t len;                          /* Size in bytes */
+    uintptr_t max_end;                   /* Max end address in subtree */
+    uint64_t device;                     /* Device ID */
+    unsigned long flags;                 /* Permission flags */
+    enum na_mem_type mem_type;           /* Memory type */
+    uint32_t priority;                   /* Treap priority */
+    unsigned int ref_count;              /* Handles using registration */
+    bool cached;                         /* Entry is in tree */
+};
+
+/* Cache of NA registrations */
+struct hg_bulk_reg_cache {
+    TAILQ_HEAD(, hg_bulk_reg_entry) lru_list;      /* Unused entries */
+    TAILQ_HEAD(, hg_bulk_reg_entry) detached_list; /* Invalidated, in use */
+    hg_thread_mutex_t lock;                        /* Cache lock */
+    hg_core_class_t *core_class;                   /* HG core class */
+    struct hg_bulk_reg_entry *root;                /* Root of tree */
+    size_t size;     /* Bytes registered by entries in tree */
+    size_t max_size; /* Max bytes registered by entries in tree */
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -256,7 +381,8 @@ hg_bulk_free(struct hg_bulk *hg_bulk);
  */
 static hg_return_t
 hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, struct hg_bulk_segment *segments, uint32_t count,
+    na_class_t *na_class, struct hg_bulk_reg_cache *reg_cache,
+    struct hg_bulk_segment *segments, uint32_t count, uint32_t regv_max,
     uint8_t flags, enum na_mem_type mem_type, uint64_t device);
 
 /**
@@ -264,7 +390,22 @@ hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
  */
 static hg_return_t
 hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, uint32_t count, bool registered);
+    na_class_t *na_class, struct hg_bulk_reg_cache *reg_cache,
+    const struct hg_bulk_segment *segments, uint32_t count, uint8_t flags,
+    enum na_mem_type mem_type, uint64_t device, bool registered);
+
+/**
+ * Compute ranges covered by each NA memory handle of a HG_BULK_REGV handle.
+ */
+static hg_return_t
+hg_bulk_create_regv_segments(struct hg_bulk *hg_bulk);
+
+/**
+ * Get segments that NA memory handles map to.
+ */
+static HG_INLINE const struct hg_bulk_segment *
+hg_bulk_get_na_segments(const struct hg_bulk *hg_bulk,
+    struct hg_bulk_segment *regv_segment, uint32_t *count_p);
 
 /**
  * Register single segment.
@@ -290,6 +431,100 @@ static hg_return_t
 hg_bulk_deregister(
     na_class_t *na_class, na_mem_handle_t *mem_handle, bool registered);
 
+/**
+ * Get registration of segment from cache or register segment and add its
+ * registration to cache.
+ */
+static hg_return_t
+hg_bulk_reg_cache_get(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    na_class_t *na_class, const struct hg_bulk_segment *segment,
+    unsigned long flags, enum na_mem_type mem_type, uint64_t device,
+    na_mem_handle_t **mem_handle_p, size_t *serialize_size_p);
+
+/**
+ * Release registration of segment obtained from cache.
+ */
+static hg_return_t
+hg_bulk_reg_cache_release(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    na_class_t *na_class, const struct hg_bulk_segment *segment,
+    unsigned long flags, enum na_mem_type mem_type, uint64_t device,
+    na_mem_handle_t *mem_handle, bool registered);
+
+/**
+ * Remove cached registrations that overlap [start, end). Registrations that
+ * are in use are deregistered once released.
+ */
+static void
+hg_bulk_reg_cache_invalidate(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    uintptr_t start, uintptr_t end);
+
+/**
+ * Deregister and free list of entries removed from cache.
+ */
+static void
+hg_bulk_reg_cache_free_list(struct hg_bulk_reg_entry *entry);
+
+/**
+ * Compare keys of registration entries.
+ */
+static HG_INLINE int
+hg_bulk_reg_entry_cmp(const struct hg_bulk_reg_entry *entry1,
+    const struct hg_bulk_reg_entry *entry2);
+
+/**
+ * Compute priority of registration entry in tree.
+ */
+static HG_INLINE uint32_t
+hg_bulk_reg_entry_priority(const struct hg_bulk_reg_entry *entry);
+
+/**
+ * Find registration entry matching key in tree.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_find(
+    struct hg_bulk_reg_entry *node, const struct hg_bulk_reg_entry *key);
+
+/**
+ * Insert registration entry in tree and return new root.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_insert(
+    struct hg_bulk_reg_entry *node, struct hg_bulk_reg_entry *entry);
+
+/**
+ * Remove registration entry from tree and return new root.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_remove(
+    struct hg_bulk_reg_entry *node, struct hg_bulk_reg_entry *entry);
+
+/**
+ * Add registration entries of tree that overlap [start, end) to list.
+ */
+static void
+hg_bulk_reg_tree_overlap(struct hg_bulk_reg_entry *node, uintptr_t start,
+    uintptr_t end, struct hg_bulk_reg_entry **list_p);
+
+/**
+ * Rotate tree and return new root.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_rotate_left(struct hg_bulk_reg_entry *node);
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_rotate_right(struct hg_bulk_reg_entry *node);
+
+/**
+ * Update max end address of subtree.
+ */
+static HG_INLINE void
+hg_bulk_reg_tree_update(struct hg_bulk_reg_entry *node);
+
+/**
+ * Check if bulk data can be embedded along with descriptor.
+ */
+static HG_INLINE bool
+hg_bulk_eager_supported(const struct hg_bulk *hg_bulk);
+
 /**
  * Get serialize size.
  */
@@ -304,12 +539,38 @@ hg_bulk_get_serialize_size_mem_descs(
     struct hg_bulk_na_mem_desc *na_mem_descs, uint32_t count);
 
 /**
- * Serialize bulk handle.
+ * Serialize bulk handle, copying its cached serialized form when possible.
  */
 static hg_return_t
 hg_bulk_serialize(
     void *buf, hg_size_t buf_size, uint8_t flags, struct hg_bulk *hg_bulk);
 
+/**
+ * Encode bulk handle descriptor.
+ */
+static hg_return_t
+hg_bulk_serialize_desc(
+    void *buf, hg_size_t buf_size, uint8_t flags, struct hg_bulk *hg_bulk);
+
+/**
+ * Get cached serialized form of bulk handle for flags, if any.
+ */
+static HG_INLINE struct hg_bulk_serialize_blob *
+hg_bulk_serialize_blob_get(struct hg_bulk *hg_bulk, uint8_t flags);
+
+/**
+ * Create and cache serialized form of bulk handle for flags.
+ */
+static hg_return_t
+hg_bulk_serialize_blob_create(struct hg_bulk *hg_bulk, uint8_t flags,
+    struct hg_bulk_serialize_blob **blob_p);
+
+/**
+ * Free cached serialized forms of bulk handle.
+ */
+static void
+hg_bulk_serialize_blobs_free(struct hg_bulk *hg_bulk);
+
 /**
  * Serialize NA memory descriptors.
  */
@@ -341,13 +602,20 @@ hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
     uint8_t flags, uint32_t max_count, void **buf_ptrs, hg_size_t *buf_sizes,
     uint32_t *actual_count);
 
+/**
+ * Get end offsets of segments, computed on first use (NULL if handle does not
+ * have enough segments).
+ */
+static const hg_size_t *
+hg_bulk_get_segment_ends(struct hg_bulk *hg_bulk);
+
 /**
  * Get info for bulk transfer.
  */
 static HG_INLINE void
-hg_bulk_offset_translate(const struct hg_bulk_segment *segments, uint32_t count,
-    hg_size_t offset, uint32_t *segment_start_index,
-    hg_size_t *segment_start_offset);
+hg_bulk_offset_translate(const struct hg_bulk_segment *segments,
+    const hg_size_t *segment_ends, uint32_t count, hg_size_t offset,
+    uint32_t *segment_start_index, hg_size_t *segment_start_offset);
 
 /**
  * Create bulk operation ID.
@@ -369,6 +637,34 @@ static hg_return_t
 hg_bulk_op_pool_get(struct hg_bulk_op_pool *hg_bulk_op_pool,
     struct hg_bulk_op_id **hg_bulk_op_id_p);
 
+/**
+ * Initialize pool of NA op IDs.
+ */
+static hg_return_t
+hg_bulk_na_op_pool_init(
+    struct hg_bulk_na_op_pool *hg_bulk_na_op_pool, na_class_t *na_class);
+
+/**
+ * Finalize pool of NA op IDs.
+ */
+static void
+hg_bulk_na_op_pool_finalize(struct hg_bulk_na_op_pool *hg_bulk_na_op_pool);
+
+/**
+ * Retrieve NA op IDs from pool, creating new ones if pool runs out.
+ */
+static hg_return_t
+hg_bulk_na_op_pool_get(struct hg_bulk_na_op_pool *hg_bulk_na_op_pool,
+    na_class_t *na_class, na_op_id_t **na_op_ids, uint32_t count,
+    bool *hit_p);
+
+/**
+ * Release NA op IDs to pool, destroying those that do not fit.
+ */
+static void
+hg_bulk_na_op_pool_release(struct hg_bulk_na_op_pool *hg_bulk_na_op_pool,
+    na_class_t *na_class, na_op_id_t **na_op_ids, uint32_t count);
+
 /**
  * Bulk transfer.
  */
@@ -377,49 +673,98 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
     hg_bulk_op_t op, struct hg_core_addr *origin_addr, uint8_t origin_id,
     struct hg_bulk *hg_bulk_origin, hg_size_t origin_offset,
     struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
-    hg_op_id_t *op_id);
+    struct hg_bulk_op_id *parent, hg_op_id_t *op_id);
+
+/**
+ * Transfer data in stripes over multiple contexts.
+ */
+static hg_return_t
+hg_bulk_transfer_striped(hg_context_t **contexts, unsigned int context_count,
+    hg_cb_t callback, void *arg, hg_bulk_op_t op,
+    struct hg_core_addr *origin_addr, struct hg_bulk *hg_bulk_origin,
+    hg_size_t origin_offset, struct hg_bulk *hg_bulk_local,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id);
+
+/**
+ * Transfer data between multiple origins and a single local handle.
+ */
+static hg_return_t
+hg_bulk_transfer_multi(hg_core_context_t *core_context, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, const struct hg_bulk_origin_desc *origins,
+    uint32_t origin_count, struct hg_bulk *hg_bulk_local,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id);
+
+/**
+ * Get op ID that completes once all of its stripes complete.
+ */
+static hg_return_t
+hg_bulk_parent_get(hg_core_context_t *core_context, uint32_t stripe_count,
+    struct hg_bulk_op_id **hg_bulk_op_id_p);
+
+/**
+ * Post stripe of parent op ID, failure is reported through completion once
+ * other stripes were posted.
+ */
+static hg_return_t
+hg_bulk_parent_post(struct hg_bulk_op_id *parent,
+    hg_core_context_t *core_context, hg_bulk_op_t op,
+    struct hg_core_addr *origin_addr, struct hg_bulk *hg_bulk_origin,
+    hg_size_t origin_offset, struct hg_bulk *hg_bulk_local,
+    hg_size_t local_offset, hg_size_t size);
+
+/**
+ * Account for stripes of parent op ID that were not posted, parent may
+ * complete after that call.
+ */
+static void
+hg_bulk_parent_post_end(struct hg_bulk_op_id *parent, uint32_t stripe_count);
 
 /**
  * Bulk transfer to self.
  */
 static hg_return_t
 hg_bulk_transfer_self(hg_bulk_op_t op,
-    const struct hg_bulk_segment *origin_segments, uint32_t origin_count,
+    const struct hg_bulk_segment *origin_segments,
+    const hg_size_t *origin_segment_ends, uint32_t origin_count,
     hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
-    uint32_t local_count, hg_size_t local_offset, hg_size_t size,
+    const hg_size_t *local_segment_ends, uint32_t local_count,
+    hg_size_t local_offset, hg_size_t size,
     struct hg_bulk_op_id *hg_bulk_op_id);
 
 /**
  * Transfer segments to self (local copy).
  */
 static void
-hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
+hg_bulk_transfer_segments_self(hg_bulk_op_t op, bool nt_copy,
     const struct hg_bulk_segment *origin_segments, uint32_t origin_count,
     hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
     const struct hg_bulk_segment *local_segments, uint32_t local_count,
     hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
     hg_size_t size);
 
+#ifdef HG_BULK_HAS_NT_COPY
 /**
- * Memcpy.
+ * Memcpy using non-temporal stores (caller must issue store fence).
  */
-static HG_INLINE void
-hg_bulk_memcpy_put(void *local_address, hg_size_t local_offset,
-    void *remote_address, hg_size_t remote_offset, hg_size_t data_size)
-{
-    memcpy((char *) remote_address + remote_offset,
-        (const char *) local_address + local_offset, data_size);
-}
+static void
+hg_bulk_memcpy_nt(void *dest, const void *src, hg_size_t size);
+#endif
 
 /**
  * Memcpy.
  */
 static HG_INLINE void
-hg_bulk_memcpy_get(void *local_address, hg_size_t local_offset,
-    void *remote_address, hg_size_t remote_offset, hg_size_t data_size)
+hg_bulk_memcpy(void *dest, const void *src, hg_size_t size, bool nt_copy)
 {
-    memcpy((char *) local_address + local_offset,
-        (const char *) remote_address + remote_offset, data_size);
+#ifdef HG_BULK_HAS_NT_COPY
+    if (nt_copy) {
+        hg_bulk_memcpy_nt(dest, src, size);
+        return;
+    }
+#else
+    (void) nt_copy;
+#endif
+    memcpy(dest, src, (size_t) size);
 }
 
 /**
@@ -428,12 +773,12 @@ hg_bulk_memcpy_get(void *local_address, hg_size_t local_offset,
 static hg_return_t
 hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
     uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
-    uint32_t origin_count, na_mem_handle_t **origin_mem_handles,
-    uint8_t origin_flags, hg_size_t origin_offset,
-    const struct hg_bulk_segment *local_segments, uint32_t local_count,
-    na_mem_handle_t **local_mem_handles, uint8_t local_flags,
-    hg_size_t local_offset, hg_size_t size,
-    struct hg_bulk_op_id *hg_bulk_op_id);
+    const hg_size_t *origin_segment_ends, uint32_t origin_count,
+    na_mem_handle_t **origin_mem_handles, uint8_t origin_flags,
+    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
+    const hg_size_t *local_segment_ends, uint32_t local_count,
+    na_mem_handle_t **local_mem_handles, hg_size_t local_offset,
+    hg_size_t size, struct hg_bulk_op_id *hg_bulk_op_id);
 
 /**
  * Get number of required operations to transfer data.
@@ -444,10 +789,19 @@ hg_bulk_transfer_get_op_count(const struct hg_bulk_segment *origin_segments,
     hg_size_t origin_segment_start_offset,
     const struct hg_bulk_segment *local_segments, uint32_t local_count,
     hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
-    hg_size_t size);
+    hg_size_t size, hg_size_t chunk_size, uint32_t count_max);
+
+/**
+ * Get NA op IDs for op_count operations.
+ */
+static hg_return_t
+hg_bulk_transfer_get_na_op_ids(struct hg_bulk_op_id *hg_bulk_op_id,
+    hg_bulk_na_op_id_t *hg_bulk_na_op_ids, uint8_t origin_flags,
+    na_op_id_t ***na_op_ids_p);
 
 /**
- * Transfer segments.
+ * Transfer segments, the number of NA operations that were posted is returned
+ * in posted_count_p, including on error.
  */
 static hg_return_t
 hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
@@ -459,7 +813,28 @@ hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
     const struct hg_bulk_segment *local_segments, uint32_t local_count,
     na_mem_handle_t **local_mem_handles, hg_size_t local_segment_start_index,
     hg_size_t local_segment_start_offset, hg_size_t size,
-    na_op_id_t *na_op_ids[], uint32_t na_op_count);
+    na_op_id_t *na_op_ids[], uint32_t na_op_count, uint32_t *posted_count_p);
+
+/**
+ * Transfer segments in chunks, keeping at most op_count chunks in flight.
+ */
+static hg_return_t
+hg_bulk_transfer_chunks_na(na_bulk_op_t na_bulk_op, na_addr_t *na_origin_addr,
+    uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
+    uint32_t origin_count, na_mem_handle_t **origin_mem_handles,
+    uint8_t origin_flags, uint32_t origin_segment_start_index,
+    hg_size_t origin_segment_start_offset,
+    const struct hg_bulk_segment *local_segments, uint32_t local_count,
+    na_mem_handle_t **local_mem_handles, uint32_t local_segment_start_index,
+    hg_size_t local_segment_start_offset, hg_size_t size, hg_size_t chunk_size,
+    uint32_t chunk_window, hg_bulk_na_op_id_t *hg_bulk_na_op_ids,
+    struct hg_bulk_op_id *hg_bulk_op_id);
+
+/**
+ * Post next chunk on slot. Returns true if all chunks have completed.
+ */
+static bool
+hg_bulk_pipeline_post(struct hg_bulk_pipeline_slot *slot, bool completed);
 
 /**
  * NA_Put wrapper
@@ -497,6 +872,19 @@ hg_bulk_na_get(na_class_t *na_class, na_context_t *context, na_cb_t callback,
 static void
 hg_bulk_transfer_cb(const struct na_cb_info *callback_info);
 
+/**
+ * Chunk transfer callback.
+ */
+static void
+hg_bulk_transfer_chunk_cb(const struct na_cb_info *callback_info);
+
+/**
+ * Update op ID status from NA return code.
+ */
+static void
+hg_bulk_transfer_set_status(
+    struct hg_bulk_op_id *hg_bulk_op_id, na_return_t na_ret);
+
 /**
  * Complete operation ID.
  */
@@ -504,6 +892,12 @@ static void
 hg_bulk_complete(
     struct hg_bulk_op_id *hg_bulk_op_id, hg_return_t ret, bool self_notify);
 
+/**
+ * Complete stripe of a striped operation.
+ */
+static void
+hg_bulk_stripe_complete(struct hg_bulk_op_id *hg_bulk_op_id, hg_return_t ret);
+
 /**
  * Cancel operation ID.
  */
@@ -554,7 +948,34 @@ hg_bulk_create(hg_core_class_t *core_class, uint32_t count, void **bufs,
         segments = hg_bulk->desc.segments.s;
 
     /* Loop over the list of segments */
-    if (!bufs) {
+    if (!bufs && attrs->shared) {
+        char *buf_ptr;
+        uint32_t i;
+
+        for (i = 0; i < count; i++)
+            hg_bulk->desc.info.len += lens[i];
+
+        /* Allocate one single block of memory that SM peers can map */
+#ifdef NA_HAS_SM
+        hg_bulk->alloc_class = (na_sm_class) ? na_sm_class : na_class;
+#else
+        hg_bulk->alloc_class = na_class;
+#endif
+        hg_bulk->desc.info.flags |= HG_BULK_ALLOC;
+        hg_bulk->alloc_buf = NA_Mem_alloc(hg_bulk->alloc_class,
+            (size_t) hg_bulk->desc.info.len, 0, &hg_bulk->alloc_data);
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk->alloc_buf == NULL, error, ret,
+            HG_NOMEM, "Could not allocate shared memory");
+
+        for (i = 0, buf_ptr = (char *) hg_bulk->alloc_buf; i < count; i++) {
+            if (lens[i] == 0)
+                continue;
+
+            segments[i].base = buf_ptr;
+            segments[i].len = lens[i];
+            buf_ptr += lens[i];
+        }
+    } else if (!bufs) {
         uint32_t i;
 
         /* Allocate buffers internally if only lengths are provided */
@@ -589,13 +1010,17 @@ hg_bulk_create(hg_core_class_t *core_class, uint32_t count, void **bufs,
         size_t max_segments =
             na_class->ops->mem_handle_get_max_segments(na_class);
 
-        /* Will use one single descriptor if supported */
-        if ((max_segments > 1) && (count <= max_segments))
+        /* Will use one single descriptor per group of max_segments if
+         * supported, segments that exceed the limit go to the next group */
+        if (max_segments > 1) {
             hg_bulk->desc.info.flags |= HG_BULK_REGV;
+            hg_bulk->regv_max =
+                (count < max_segments) ? count : (uint32_t) max_segments;
+        }
 
 #ifdef NA_HAS_SM
-        /* Make sure SM can register as many segments */
-        if (na_sm_class) {
+        /* Make sure SM can register segments using the same groups */
+        if (na_sm_class && (hg_bulk->desc.info.flags & HG_BULK_REGV)) {
             size_t max_sm_segments =
                 na_sm_class->ops->mem_handle_get_max_segments(na_sm_class);
 
@@ -603,53 +1028,43 @@ hg_bulk_create(hg_core_class_t *core_class, uint32_t count, void **bufs,
                 !na_sm_class->ops->mem_handle_create_segments, error, ret,
                 HG_OPNOTSUPPORTED,
                 "Registration of segments not supported with SM");
-            HG_CHECK_SUBSYS_ERROR(bulk, count > max_sm_segments, error, ret,
-                HG_OPNOTSUPPORTED,
-                "SM class cannot register %" PRIu32 " segments", count);
+            HG_CHECK_SUBSYS_ERROR(bulk, max_sm_segments == 0, error, ret,
+                HG_OPNOTSUPPORTED, "SM class cannot register segments");
+            if (max_sm_segments < hg_bulk->regv_max)
+                hg_bulk->regv_max = (uint32_t) max_sm_segments;
         }
 #endif
     }
 
-    /* Register using one single descriptor if supported */
-    if (hg_bulk->desc.info.flags & HG_BULK_REGV) {
-        /* Register segments */
-        ret =
-            hg_bulk_register_segments(na_class, (struct na_segment *) segments,
-                count, flags, (enum na_mem_type) attrs->mem_type, attrs->device,
-                &hg_bulk->na_mem_descs.handles.s[0],
-                &hg_bulk->na_mem_descs.serialize_sizes.s[0]);
-        HG_CHECK_SUBSYS_HG_ERROR(
-            bulk, error, ret, "Could not register segments");
+    /* Registrations of segments are cached if enabled, memory that we
+     * allocate is freed with the handle and is never cached */
+    if (!(hg_bulk->desc.info.flags & (HG_BULK_ALLOC | HG_BULK_REGV)))
+        hg_bulk->reg_cache = hg_core_bulk_get_reg_cache(core_class);
+
+    /* Register segments, either individually or by groups */
+    ret = hg_bulk_create_na_mem_descs(&hg_bulk->na_mem_descs, na_class,
+        hg_bulk->reg_cache, segments, count, hg_bulk->regv_max, flags,
+        (enum na_mem_type) attrs->mem_type, attrs->device);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        bulk, error, ret, "Could not create NA mem descriptors");
 
 #ifdef NA_HAS_SM
-        if (na_sm_class) {
-            /* Register segments */
-            ret = hg_bulk_register_segments(na_sm_class,
-                (struct na_segment *) segments, count, flags,
-                (enum na_mem_type) attrs->mem_type, attrs->device,
-                &hg_bulk->na_sm_mem_descs.handles.s[0],
-                &hg_bulk->na_sm_mem_descs.serialize_sizes.s[0]);
-            HG_CHECK_SUBSYS_HG_ERROR(
-                bulk, error, ret, "Could not register segments with SM");
-        }
-#endif
-    } else {
-        /* Register segments individually */
-        ret = hg_bulk_create_na_mem_descs(&hg_bulk->na_mem_descs, na_class,
-            segments, count, flags, (enum na_mem_type) attrs->mem_type,
+    if (na_sm_class) {
+        ret = hg_bulk_create_na_mem_descs(&hg_bulk->na_sm_mem_descs,
+            na_sm_class, hg_bulk->reg_cache, segments, count,
+            hg_bulk->regv_max, flags, (enum na_mem_type) attrs->mem_type,
             attrs->device);
         HG_CHECK_SUBSYS_HG_ERROR(
-            bulk, error, ret, "Could not create NA mem descriptors");
-
-#ifdef NA_HAS_SM
-        if (na_sm_class) {
-            ret = hg_bulk_create_na_mem_descs(&hg_bulk->na_sm_mem_descs,
-                na_sm_class, segments, count, flags,
-                (enum na_mem_type) attrs->mem_type, attrs->device);
-            HG_CHECK_SUBSYS_HG_ERROR(
-                bulk, error, ret, "Could not create NA SM mem descriptors");
-        }
+            bulk, error, ret, "Could not create NA SM mem descriptors");
+    }
 #endif
+
+    /* Keep track of the range covered by each group */
+    if (HG_BULK_MEM_HANDLE_COUNT(hg_bulk) > 1 &&
+        (hg_bulk->desc.info.flags & HG_BULK_REGV)) {
+        ret = hg_bulk_create_regv_segments(hg_bulk);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error, ret, "Could not create REGV segments");
     }
     hg_bulk->registered = true;
     hg_core_bulk_incr(core_class);
@@ -678,42 +1093,32 @@ hg_bulk_free(struct hg_bulk *hg_bulk)
     if (hg_atomic_decr32(&hg_bulk->ref_count))
         return HG_SUCCESS;
 
+    segments = HG_BULK_SEGMENTS(hg_bulk);
+
     /* Deregister segments */
-    if (hg_bulk->desc.info.flags & HG_BULK_REGV ||
-        (hg_bulk->desc.info.segment_count == 1)) {
-        if (hg_bulk->na_mem_descs.handles.s[0] != NULL) {
-            ret = hg_bulk_deregister(hg_bulk->na_class,
-                hg_bulk->na_mem_descs.handles.s[0], hg_bulk->registered);
-            HG_CHECK_SUBSYS_HG_ERROR(
-                bulk, error, ret, "Could not deregister segment");
-        }
+    ret = hg_bulk_free_na_mem_descs(&hg_bulk->na_mem_descs, hg_bulk->na_class,
+        hg_bulk->reg_cache, segments, HG_BULK_MEM_HANDLE_COUNT(hg_bulk),
+        hg_bulk->desc.info.flags & HG_BULK_READWRITE,
+        (enum na_mem_type) hg_bulk->attrs.mem_type, hg_bulk->attrs.device,
+        hg_bulk->registered);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        bulk, error, ret, "Could not free NA mem descriptors");
 
 #ifdef NA_HAS_SM
-        if (hg_bulk->na_sm_mem_descs.handles.s[0] != NULL) {
-            ret = hg_bulk_deregister(hg_bulk->na_sm_class,
-                hg_bulk->na_sm_mem_descs.handles.s[0], hg_bulk->registered);
-            HG_CHECK_SUBSYS_HG_ERROR(
-                bulk, error, ret, "Could not deregister segment with SM");
-        }
-#endif
-    } else {
-        /* Free segments individually */
-        ret =
-            hg_bulk_free_na_mem_descs(&hg_bulk->na_mem_descs, hg_bulk->na_class,
-                hg_bulk->desc.info.segment_count, hg_bulk->registered);
+    if (hg_bulk->na_sm_class) {
+        ret = hg_bulk_free_na_mem_descs(&hg_bulk->na_sm_mem_descs,
+            hg_bulk->na_sm_class, hg_bulk->reg_cache, segments,
+            HG_BULK_MEM_HANDLE_COUNT(hg_bulk),
+            hg_bulk->desc.info.flags & HG_BULK_READWRITE,
+            (enum na_mem_type) hg_bulk->attrs.mem_type, hg_bulk->attrs.device,
+            hg_bulk->registered);
         HG_CHECK_SUBSYS_HG_ERROR(
-            bulk, error, ret, "Could not free NA mem descriptors");
-
-#ifdef NA_HAS_SM
-        if (hg_bulk->na_sm_class) {
-            ret = hg_bulk_free_na_mem_descs(&hg_bulk->na_sm_mem_descs,
-                hg_bulk->na_sm_class, hg_bulk->desc.info.segment_count,
-                hg_bulk->registered);
-            HG_CHECK_SUBSYS_HG_ERROR(
-                bulk, error, ret, "Could not free NA SM mem descriptors");
-        }
-#endif
+            bulk, error, ret, "Could not free NA SM mem descriptors");
     }
+#endif
+    free(hg_bulk->regv_segments);
+    hg_bulk_serialize_blobs_free(hg_bulk);
+    free((void *) (intptr_t) hg_atomic_get64(&hg_bulk->segment_ends));
 
     /* Free addr if any was attached to handle */
     if (hg_bulk->desc.info.flags & HG_BULK_BIND) {
@@ -721,12 +1126,11 @@ hg_bulk_free(struct hg_bulk *hg_bulk)
         HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not free addr");
     }
 
-    segments = (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX)
-                   ? hg_bulk->desc.segments.d
-                   : hg_bulk->desc.segments.s;
-
     /* Free segments if we allocated them */
-    if (hg_bulk->desc.info.flags & HG_BULK_ALLOC) {
+    if (hg_bulk->alloc_buf != NULL) {
+        NA_Mem_free(
+            hg_bulk->alloc_class, hg_bulk->alloc_buf, hg_bulk->alloc_data);
+    } else if (hg_bulk->desc.info.flags & HG_BULK_ALLOC) {
         uint32_t i;
 
         for (i = 0; i < hg_bulk->desc.info.segment_count; i++)
@@ -748,24 +1152,27 @@ error:
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, struct hg_bulk_segment *segments, uint32_t count,
+    na_class_t *na_class, struct hg_bulk_reg_cache *reg_cache,
+    struct hg_bulk_segment *segments, uint32_t count, uint32_t regv_max,
     uint8_t flags, enum na_mem_type mem_type, uint64_t device)
 {
     na_mem_handle_t **na_mem_handles;
     size_t *na_mem_serialize_sizes;
+    uint32_t handle_count =
+        (regv_max > 0) ? (count + regv_max - 1) / regv_max : count;
     hg_return_t ret;
     uint32_t i;
 
-    if (count > HG_BULK_STATIC_MAX) {
+    if (handle_count > HG_BULK_STATIC_MAX) {
         /* Allocate NA memory handles */
-        na_mem_descs->handles.d =
-            (na_mem_handle_t **) calloc(count, sizeof(na_mem_handle_t *));
+        na_mem_descs->handles.d = (na_mem_handle_t **) calloc(
+            handle_count, sizeof(na_mem_handle_t *));
         HG_CHECK_SUBSYS_ERROR(bulk, na_mem_descs->handles.d == NULL, error, ret,
             HG_NOMEM, "Could not allocate mem handle array");
 
         /* Allocate serialize sizes */
         na_mem_descs->serialize_sizes.d =
-            (size_t *) calloc(count, sizeof(size_t));
+            (size_t *) calloc(handle_count, sizeof(size_t));
         HG_CHECK_SUBSYS_ERROR(bulk, na_mem_descs->serialize_sizes.d == NULL,
             error, ret, HG_NOMEM, "Could not allocate serialize sizes array");
 
@@ -776,15 +1183,38 @@ hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
         na_mem_serialize_sizes = na_mem_descs->serialize_sizes.s;
     }
 
+    /* Register groups of segments using one single descriptor */
+    if (regv_max > 0) {
+        for (i = 0; i < handle_count; i++) {
+            uint32_t first = i * regv_max;
+            uint32_t group_count =
+                (count - first < regv_max) ? count - first : regv_max;
+
+            ret = hg_bulk_register_segments(na_class,
+                (struct na_segment *) &segments[first], group_count, flags,
+                mem_type, device, &na_mem_handles[i],
+                &na_mem_serialize_sizes[i]);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                bulk, error, ret, "Could not register segments");
+        }
+
+        return HG_SUCCESS;
+    }
+
     for (i = 0; i < count; i++) {
         /* Skip null segments */
         if (segments[i].base == NULL)
             continue;
 
         /* Register segment */
-        ret = hg_bulk_register(na_class, (void *) segments[i].base,
-            segments[i].len, flags, mem_type, device, &na_mem_handles[i],
-            &na_mem_serialize_sizes[i]);
+        if (reg_cache != NULL)
+            ret = hg_bulk_reg_cache_get(reg_cache, na_class, &segments[i],
+                flags, mem_type, device, &na_mem_handles[i],
+                &na_mem_serialize_sizes[i]);
+        else
+            ret = hg_bulk_register(na_class, (void *) segments[i].base,
+                segments[i].len, flags, mem_type, device, &na_mem_handles[i],
+                &na_mem_serialize_sizes[i]);
         HG_CHECK_SUBSYS_HG_ERROR(
             bulk, error, ret, "Could not register segment");
     }
@@ -798,7 +1228,9 @@ error:
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, uint32_t count, bool registered)
+    na_class_t *na_class, struct hg_bulk_reg_cache *reg_cache,
+    const struct hg_bulk_segment *segments, uint32_t count, uint8_t flags,
+    enum na_mem_type mem_type, uint64_t device, bool registered)
 {
     na_mem_handle_t **na_mem_handles;
     hg_return_t ret;
@@ -816,7 +1248,13 @@ hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
             if (na_mem_handles[i] == NULL)
                 continue;
 
-            ret = hg_bulk_deregister(na_class, na_mem_handles[i], registered);
+            if (reg_cache != NULL)
+                ret = hg_bulk_reg_cache_release(reg_cache, na_class,
+                    &segments[i], flags, mem_type, device, na_mem_handles[i],
+                    registered);
+            else
+                ret = hg_bulk_deregister(
+                    na_class, na_mem_handles[i], registered);
             HG_CHECK_SUBSYS_HG_ERROR(
                 bulk, error, ret, "Could not deregister segment");
         }
@@ -832,22 +1270,20 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_bind(struct hg_bulk *hg_bulk, hg_core_context_t *core_context)
+hg_bulk_create_regv_segments(struct hg_bulk *hg_bulk)
 {
+    const struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
+    uint32_t i;
     hg_return_t ret;
 
-    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk->addr != HG_CORE_ADDR_NULL, error, ret,
-        HG_INVALID_ARG, "Handle is already bound to an existing address");
-
-    /* Retrieve self address */
-    ret = HG_Core_addr_self(hg_bulk->core_class, &hg_bulk->addr);
-    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get self address");
-
-    /* Add context ID */
-    hg_bulk->context_id = HG_Core_context_get_id(core_context);
+    hg_bulk->regv_segments = (struct hg_bulk_segment *) calloc(
+        HG_BULK_MEM_HANDLE_COUNT(hg_bulk), sizeof(struct hg_bulk_segment));
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk->regv_segments == NULL, error, ret,
+        HG_NOMEM, "Could not allocate REGV segment array");
 
-    /* Set flags */
-    hg_bulk->desc.info.flags |= HG_BULK_BIND;
+    /* Base addresses are not used, handles expose virtual offsets */
+    for (i = 0; i < hg_bulk->desc.info.segment_count; i++)
+        hg_bulk->regv_segments[i / hg_bulk->regv_max].len += segments[i].len;
 
     return HG_SUCCESS;
 
@@ -856,14 +1292,63 @@ error:
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_register(na_class_t *na_class, void *base, size_t len,
-    unsigned long flags, enum na_mem_type mem_type, uint64_t device,
-    na_mem_handle_t **mem_handle_p, size_t *serialize_size_p)
+static HG_INLINE const struct hg_bulk_segment *
+hg_bulk_get_na_segments(const struct hg_bulk *hg_bulk,
+    struct hg_bulk_segment *regv_segment, uint32_t *count_p)
 {
-    na_mem_handle_t *mem_handle = NULL;
-    size_t serialize_size = 0;
-    bool registered = false;
+    if (!(hg_bulk->desc.info.flags & HG_BULK_REGV)) {
+        *count_p = hg_bulk->desc.info.segment_count;
+        return HG_BULK_SEGMENTS(hg_bulk);
+    }
+
+    *count_p = HG_BULK_MEM_HANDLE_COUNT(hg_bulk);
+    if (*count_p > 1)
+        return hg_bulk->regv_segments;
+
+    /* Single group covering the entire handle */
+    regv_segment->base = NULL;
+    regv_segment->len = hg_bulk->desc.info.len;
+
+    return regv_segment;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_bind(struct hg_bulk *hg_bulk, hg_core_context_t *core_context)
+{
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk->addr != HG_CORE_ADDR_NULL, error, ret,
+        HG_INVALID_ARG, "Handle is already bound to an existing address");
+
+    /* Retrieve self address */
+    ret = HG_Core_addr_self(hg_bulk->core_class, &hg_bulk->addr);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get self address");
+
+    /* Add context ID */
+    hg_bulk->context_id = HG_Core_context_get_id(core_context);
+
+    /* Set flags */
+    hg_bulk->desc.info.flags |= HG_BULK_BIND;
+
+    /* Serialized forms no longer match descriptor */
+    hg_bulk_serialize_blobs_free(hg_bulk);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_register(na_class_t *na_class, void *base, size_t len,
+    unsigned long flags, enum na_mem_type mem_type, uint64_t device,
+    na_mem_handle_t **mem_handle_p, size_t *serialize_size_p)
+{
+    na_mem_handle_t *mem_handle = NULL;
+    size_t serialize_size = 0;
+    bool registered = false;
     hg_return_t ret;
     na_return_t na_ret;
 
@@ -973,19 +1458,456 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_reg_cache_create(hg_core_class_t *core_class, size_t max_size,
+    struct hg_bulk_reg_cache **hg_bulk_reg_cache_p)
+{
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache;
+    hg_return_t ret;
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Creating registration cache of %zu bytes", max_size);
+
+    hg_bulk_reg_cache =
+        (struct hg_bulk_reg_cache *) calloc(1, sizeof(*hg_bulk_reg_cache));
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_reg_cache == NULL, error, ret,
+        HG_NOMEM, "Could not allocate registration cache");
+
+    TAILQ_INIT(&hg_bulk_reg_cache->lru_list);
+    TAILQ_INIT(&hg_bulk_reg_cache->detached_list);
+    hg_thread_mutex_init(&hg_bulk_reg_cache->lock);
+    hg_bulk_reg_cache->core_class = core_class;
+    hg_bulk_reg_cache->max_size = max_size;
+
+    *hg_bulk_reg_cache_p = hg_bulk_reg_cache;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_reg_cache_destroy(struct hg_bulk_reg_cache *hg_bulk_reg_cache)
+{
+    HG_LOG_SUBSYS_DEBUG(bulk, "Free registration cache (%p)",
+        (void *) hg_bulk_reg_cache);
+
+    /* Handles have been freed so that all entries can be deregistered */
+    hg_bulk_reg_cache_invalidate(hg_bulk_reg_cache, 0, UINTPTR_MAX);
+    HG_CHECK_SUBSYS_WARNING(bulk,
+        !TAILQ_EMPTY(&hg_bulk_reg_cache->detached_list),
+        "Cached registrations are still in use");
+
+    hg_thread_mutex_destroy(&hg_bulk_reg_cache->lock);
+    free(hg_bulk_reg_cache);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_reg_cache_get(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    na_class_t *na_class, const struct hg_bulk_segment *segment,
+    unsigned long flags, enum na_mem_type mem_type, uint64_t device,
+    na_mem_handle_t **mem_handle_p, size_t *serialize_size_p)
+{
+    struct hg_bulk_reg_entry key = {.na_class = na_class,
+        .base = (uintptr_t) segment->base,
+        .len = (size_t) segment->len,
+        .device = device,
+        .flags = flags,
+        .mem_type = mem_type};
+    struct hg_bulk_reg_entry *entry, *evicted = NULL;
+    hg_return_t ret;
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->lock);
+    entry = hg_bulk_reg_tree_find(hg_bulk_reg_cache->root, &key);
+    if (entry != NULL) {
+        /* Entry is no longer unused */
+        if (entry->ref_count++ == 0)
+            TAILQ_REMOVE(&hg_bulk_reg_cache->lru_list, entry, list);
+        *mem_handle_p = entry->mem_handle;
+        *serialize_size_p = entry->serialize_size;
+        hg_thread_mutex_unlock(&hg_bulk_reg_cache->lock);
+
+        hg_core_bulk_reg_cache_hit(hg_bulk_reg_cache->core_class);
+
+        return HG_SUCCESS;
+    }
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->lock);
+
+    hg_core_bulk_reg_cache_miss(hg_bulk_reg_cache->core_class);
+
+    /* Register without holding lock */
+    ret = hg_bulk_register(na_class, segment->base, key.len, flags, mem_type,
+        device, mem_handle_p, serialize_size_p);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not register segment");
+
+    /* Registration is not cached if it cannot fit */
+    if (key.len == 0 || key.len > hg_bulk_reg_cache->max_size)
+        return HG_SUCCESS;
+
+    entry = (struct hg_bulk_reg_entry *) malloc(sizeof(*entry));
+    HG_CHECK_SUBSYS_ERROR(bulk, entry == NULL, error_free, ret, HG_NOMEM,
+        "Could not allocate registration entry");
+    *entry = key;
+    entry->mem_handle = *mem_handle_p;
+    entry->serialize_size = *serialize_size_p;
+    entry->priority = hg_bulk_reg_entry_priority(entry);
+    entry->ref_count = 1;
+    entry->cached = true;
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->lock);
+
+    /* Range may have been registered concurrently, keep existing entry */
+    if (hg_bulk_reg_tree_find(hg_bulk_reg_cache->root, &key) == NULL) {
+        /* Evict unused entries, least recently used first */
+        while (hg_bulk_reg_cache->size + key.len >
+                   hg_bulk_reg_cache->max_size &&
+               !TAILQ_EMPTY(&hg_bulk_reg_cache->lru_list)) {
+            struct hg_bulk_reg_entry *lru_entry =
+                TAILQ_FIRST(&hg_bulk_reg_cache->lru_list);
+
+            TAILQ_REMOVE(&hg_bulk_reg_cache->lru_list, lru_entry, list);
+            hg_bulk_reg_cache->root =
+                hg_bulk_reg_tree_remove(hg_bulk_reg_cache->root, lru_entry);
+            hg_bulk_reg_cache->size -= lru_entry->len;
+            lru_entry->cached = false;
+            lru_entry->next = evicted;
+            evicted = lru_entry;
+        }
+
+        /* Entries in use may still exceed the limit */
+        if (hg_bulk_reg_cache->size + key.len <= hg_bulk_reg_cache->max_size) {
+            hg_bulk_reg_cache->root =
+                hg_bulk_reg_tree_insert(hg_bulk_reg_cache->root, entry);
+            hg_bulk_reg_cache->size += key.len;
+            entry = NULL;
+        }
+    }
+
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->lock);
+
+    /* Not cached, registration is owned by handle */
+    free(entry);
+    hg_bulk_reg_cache_free_list(evicted);
+
+    return HG_SUCCESS;
+
+error_free:
+    (void) hg_bulk_deregister(na_class, *mem_handle_p, true);
+    *mem_handle_p = NULL;
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_reg_cache_release(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    na_class_t *na_class, const struct hg_bulk_segment *segment,
+    unsigned long flags, enum na_mem_type mem_type, uint64_t device,
+    na_mem_handle_t *mem_handle, bool registered)
+{
+    struct hg_bulk_reg_entry key = {.na_class = na_class,
+        .base = (uintptr_t) segment->base,
+        .len = (size_t) segment->len,
+        .device = device,
+        .flags = flags,
+        .mem_type = mem_type};
+    struct hg_bulk_reg_entry *entry;
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->lock);
+
+    entry = hg_bulk_reg_tree_find(hg_bulk_reg_cache->root, &key);
+    if (entry == NULL || entry->mem_handle != mem_handle) {
+        /* Entry may have been invalidated while in use */
+        TAILQ_FOREACH (entry, &hg_bulk_reg_cache->detached_list, list) {
+            if (entry->mem_handle == mem_handle)
+                break;
+        }
+    }
+
+    /* Registration was not cached */
+    if (entry == NULL) {
+        hg_thread_mutex_unlock(&hg_bulk_reg_cache->lock);
+        return hg_bulk_deregister(na_class, mem_handle, registered);
+    }
+
+    /* Registration is still in use */
+    if (--entry->ref_count > 0) {
+        hg_thread_mutex_unlock(&hg_bulk_reg_cache->lock);
+        return HG_SUCCESS;
+    }
+
+    /* Keep registration for later re-use */
+    if (entry->cached) {
+        TAILQ_INSERT_TAIL(&hg_bulk_reg_cache->lru_list, entry, list);
+        hg_thread_mutex_unlock(&hg_bulk_reg_cache->lock);
+        return HG_SUCCESS;
+    }
+
+    TAILQ_REMOVE(&hg_bulk_reg_cache->detached_list, entry, list);
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->lock);
+
+    entry->next = NULL;
+    hg_bulk_reg_cache_free_list(entry);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_cache_invalidate(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    uintptr_t start, uintptr_t end)
+{
+    struct hg_bulk_reg_entry *entry = NULL, *unused = NULL;
+
+    hg_thread_mutex_lock(&hg_bulk_reg_cache->lock);
+
+    hg_bulk_reg_tree_overlap(hg_bulk_reg_cache->root, start, end, &entry);
+    while (entry != NULL) {
+        struct hg_bulk_reg_entry *next = entry->next;
+
+        hg_bulk_reg_cache->root =
+            hg_bulk_reg_tree_remove(hg_bulk_reg_cache->root, entry);
+        hg_bulk_reg_cache->size -= entry->len;
+        entry->cached = false;
+
+        if (entry->ref_count == 0) {
+            TAILQ_REMOVE(&hg_bulk_reg_cache->lru_list, entry, list);
+            entry->next = unused;
+            unused = entry;
+        } else
+            TAILQ_INSERT_TAIL(&hg_bulk_reg_cache->detached_list, entry, list);
+
+        entry = next;
+    }
+
+    hg_thread_mutex_unlock(&hg_bulk_reg_cache->lock);
+
+    hg_bulk_reg_cache_free_list(unused);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_cache_free_list(struct hg_bulk_reg_entry *entry)
+{
+    while (entry != NULL) {
+        struct hg_bulk_reg_entry *next = entry->next;
+
+        (void) hg_bulk_deregister(entry->na_class, entry->mem_handle, true);
+        free(entry);
+        entry = next;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE int
+hg_bulk_reg_entry_cmp(const struct hg_bulk_reg_entry *entry1,
+    const struct hg_bulk_reg_entry *entry2)
+{
+    if (entry1->base != entry2->base)
+        return (entry1->base < entry2->base) ? -1 : 1;
+    if (entry1->len != entry2->len)
+        return (entry1->len < entry2->len) ? -1 : 1;
+    if (entry1->na_class != entry2->na_class)
+        return ((uintptr_t) entry1->na_class < (uintptr_t) entry2->na_class)
+                   ? -1
+                   : 1;
+    if (entry1->flags != entry2->flags)
+        return (entry1->flags < entry2->flags) ? -1 : 1;
+    if (entry1->mem_type != entry2->mem_type)
+        return (entry1->mem_type < entry2->mem_type) ? -1 : 1;
+    if (entry1->device != entry2->device)
+        return (entry1->device < entry2->device) ? -1 : 1;
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE uint32_t
+hg_bulk_reg_entry_priority(const struct hg_bulk_reg_entry *entry)
+{
+    /* Hashing the range keeps the treap balanced on average */
+    uint64_t hash =
+        ((uint64_t) entry->base ^ ((uint64_t) entry->len << 32)) *
+        UINT64_C(0x9e3779b97f4a7c15);
+
+    return (uint32_t) (hash >> 32);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_find(
+    struct hg_bulk_reg_entry *node, const struct hg_bulk_reg_entry *key)
+{
+    while (node != NULL) {
+        int cmp = hg_bulk_reg_entry_cmp(key, node);
+
+        if (cmp == 0)
+            break;
+        node = (cmp < 0) ? node->left : node->right;
+    }
+
+    return node;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_insert(
+    struct hg_bulk_reg_entry *node, struct hg_bulk_reg_entry *entry)
+{
+    if (node == NULL) {
+        entry->left = NULL;
+        entry->right = NULL;
+        hg_bulk_reg_tree_update(entry);
+        return entry;
+    }
+
+    /* Keys are unique, restore heap order on the way up */
+    if (hg_bulk_reg_entry_cmp(entry, node) < 0) {
+        node->left = hg_bulk_reg_tree_insert(node->left, entry);
+        if (node->left->priority > node->priority)
+            return hg_bulk_reg_tree_rotate_right(node);
+    } else {
+        node->right = hg_bulk_reg_tree_insert(node->right, entry);
+        if (node->right->priority > node->priority)
+            return hg_bulk_reg_tree_rotate_left(node);
+    }
+    hg_bulk_reg_tree_update(node);
+
+    return node;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_remove(
+    struct hg_bulk_reg_entry *node, struct hg_bulk_reg_entry *entry)
+{
+    if (node == NULL)
+        return NULL;
+
+    if (node == entry) {
+        /* Rotate entry down until it has at most one child */
+        if (node->left == NULL)
+            return node->right;
+        if (node->right == NULL)
+            return node->left;
+        if (node->left->priority > node->right->priority) {
+            node = hg_bulk_reg_tree_rotate_right(node);
+            node->right = hg_bulk_reg_tree_remove(node->right, entry);
+        } else {
+            node = hg_bulk_reg_tree_rotate_left(node);
+            node->left = hg_bulk_reg_tree_remove(node->left, entry);
+        }
+    } else if (hg_bulk_reg_entry_cmp(entry, node) < 0)
+        node->left = hg_bulk_reg_tree_remove(node->left, entry);
+    else
+        node->right = hg_bulk_reg_tree_remove(node->right, entry);
+    hg_bulk_reg_tree_update(node);
+
+    return node;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_tree_overlap(struct hg_bulk_reg_entry *node, uintptr_t start,
+    uintptr_t end, struct hg_bulk_reg_entry **list_p)
+{
+    /* Skip subtrees that end before start */
+    while (node != NULL && node->max_end > start) {
+        hg_bulk_reg_tree_overlap(node->left, start, end, list_p);
+
+        /* Entries of right subtree start after node */
+        if (node->base >= end)
+            return;
+        if (node->base + node->len > start) {
+            node->next = *list_p;
+            *list_p = node;
+        }
+        node = node->right;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_rotate_left(struct hg_bulk_reg_entry *node)
+{
+    struct hg_bulk_reg_entry *right = node->right;
+
+    node->right = right->left;
+    right->left = node;
+    hg_bulk_reg_tree_update(node);
+    hg_bulk_reg_tree_update(right);
+
+    return right;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_rotate_right(struct hg_bulk_reg_entry *node)
+{
+    struct hg_bulk_reg_entry *left = node->left;
+
+    node->left = left->right;
+    left->right = node;
+    hg_bulk_reg_tree_update(node);
+    hg_bulk_reg_tree_update(left);
+
+    return left;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_bulk_reg_tree_update(struct hg_bulk_reg_entry *node)
+{
+    node->max_end = node->base + node->len;
+    if (node->left != NULL && node->left->max_end > node->max_end)
+        node->max_end = node->left->max_end;
+    if (node->right != NULL && node->right->max_end > node->max_end)
+        node->max_end = node->right->max_end;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE bool
+hg_bulk_eager_supported(const struct hg_bulk *hg_bulk)
+{
+    /* Handle must be read-only, not virtual (i.e., points to local data),
+     * and memory must not be on device */
+    return (hg_bulk->desc.info.flags & HG_BULK_READ_ONLY) &&
+           !(hg_bulk->desc.info.flags & HG_BULK_VIRT) &&
+           (hg_bulk->attrs.mem_type == HG_MEM_TYPE_HOST);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_size_t
 hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, uint8_t flags)
 {
     struct hg_bulk_desc_info *desc_info = &hg_bulk->desc.info;
+    uint32_t handle_count = HG_BULK_MEM_HANDLE_COUNT(hg_bulk);
+    struct hg_bulk_serialize_blob *blob;
     hg_size_t ret = 0;
 
+    /* Descriptor was already serialized, only data size may be added */
+    blob = hg_bulk_serialize_blob_get(hg_bulk, flags);
+    if (blob != NULL) {
+        ret = blob->size;
+        if ((flags & HG_BULK_EAGER) && hg_bulk_eager_supported(hg_bulk))
+            ret += desc_info->len;
+        return ret;
+    }
+
     /* Descriptor info + segments */
     ret = sizeof(*desc_info) +
           desc_info->segment_count * sizeof(struct hg_bulk_segment);
 
+    /* Number of segments per memory handle */
+    if (desc_info->flags & HG_BULK_REGV)
+        ret += sizeof(uint32_t);
+
     /* Memory handles */
-    if ((desc_info->flags & HG_BULK_REGV) || (desc_info->segment_count == 1)) {
+    if (handle_count == 1) {
         /* Only one single memory handle in that case */
         if (hg_bulk->na_mem_descs.handles.s[0] != NULL)
             ret += hg_bulk->na_mem_descs.serialize_sizes.s[0] + sizeof(size_t);
@@ -1000,14 +1922,14 @@ hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, uint8_t flags)
 #endif
     } else {
         ret += hg_bulk_get_serialize_size_mem_descs(
-            &hg_bulk->na_mem_descs, desc_info->segment_count);
+            &hg_bulk->na_mem_descs, handle_count);
 
 #ifdef NA_HAS_SM
         /* Only add SM serialized handles if we're sending over SM, otherwise
          * skip it. */
         if ((flags & HG_BULK_SM) && hg_bulk->na_sm_class)
             ret += hg_bulk_get_serialize_size_mem_descs(
-                &hg_bulk->na_sm_mem_descs, desc_info->segment_count);
+                &hg_bulk->na_sm_mem_descs, handle_count);
 #endif
     }
 
@@ -1024,9 +1946,7 @@ hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, uint8_t flags)
     }
 
     /* Eager mode (in eager mode, the actual data will be copied) */
-    if ((flags & HG_BULK_EAGER) && (desc_info->flags & HG_BULK_READ_ONLY) &&
-        !(desc_info->flags & HG_BULK_VIRT) &&
-        (hg_bulk->attrs.mem_type == HG_MEM_TYPE_HOST))
+    if ((flags & HG_BULK_EAGER) && hg_bulk_eager_supported(hg_bulk))
         ret += desc_info->len;
 
     return ret;
@@ -1064,22 +1984,52 @@ hg_bulk_get_serialize_size_mem_descs(
 static hg_return_t
 hg_bulk_serialize(
     void *buf, hg_size_t buf_size, uint8_t flags, struct hg_bulk *hg_bulk)
+{
+    struct hg_bulk_serialize_blob *blob;
+    hg_return_t ret;
+
+    /* Embedded data may change between serializations */
+    if ((flags & HG_BULK_EAGER) && hg_bulk_eager_supported(hg_bulk))
+        return hg_bulk_serialize_desc(buf, buf_size, flags, hg_bulk);
+
+    blob = hg_bulk_serialize_blob_get(hg_bulk, flags);
+    if (blob == NULL) {
+        /* Do not keep a copy for handles that are serialized only once */
+        if (hg_atomic_incr32(&hg_bulk->serialize_count) < 2)
+            return hg_bulk_serialize_desc(buf, buf_size, flags, hg_bulk);
+
+        ret = hg_bulk_serialize_blob_create(hg_bulk, flags, &blob);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error, ret, "Could not create serialized handle");
+    }
+
+    HG_CHECK_SUBSYS_ERROR(bulk, buf_size < blob->size, error, ret,
+        HG_OVERFLOW, "Buffer size too small (%" PRIu64 ")", buf_size);
+    memcpy(buf, blob->buf, blob->size);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_serialize_desc(
+    void *buf, hg_size_t buf_size, uint8_t flags, struct hg_bulk *hg_bulk)
 {
     struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
     char *buf_ptr = (char *) buf;
     hg_size_t buf_size_left = buf_size;
     struct hg_bulk_desc_info desc_info = hg_bulk->desc.info; /* Copy info */
+    uint32_t handle_count = HG_BULK_MEM_HANDLE_COUNT(hg_bulk);
     hg_return_t ret;
 
     /* Always reset bulk alloc flag (only local) */
     desc_info.flags &= (~HG_BULK_ALLOC & 0xff);
 
-    /* Add eager flag to descriptor if requested and bulk handle is read-only,
-     * is not virtual (i.e., points to local data), and memory is not on device.
-     */
-    if ((flags & HG_BULK_EAGER) && (desc_info.flags & HG_BULK_READ_ONLY) &&
-        !(desc_info.flags & HG_BULK_VIRT) &&
-        (hg_bulk->attrs.mem_type == HG_MEM_TYPE_HOST)) {
+    /* Add eager flag to descriptor if requested and supported */
+    if ((flags & HG_BULK_EAGER) && hg_bulk_eager_supported(hg_bulk)) {
         HG_LOG_SUBSYS_DEBUG(bulk, "HG_BULK_EAGER flag set");
         desc_info.flags |= HG_BULK_EAGER;
     } else
@@ -1106,10 +2056,15 @@ hg_bulk_serialize(
     HG_BULK_ENCODE_ARRAY(error, ret, buf_ptr, buf_size_left, segments,
         struct hg_bulk_segment, desc_info.segment_count);
 
+    /* Number of segments per memory handle */
+    if (desc_info.flags & HG_BULK_REGV)
+        HG_BULK_ENCODE(error, ret, buf_ptr, buf_size_left, &hg_bulk->regv_max,
+            uint32_t);
+
     /* TODO if eager or self flag, skip mem handles ? */
 
     /* Add the NA memory handles */
-    if ((desc_info.flags & HG_BULK_REGV) || (desc_info.segment_count == 1)) {
+    if (handle_count == 1) {
         /* N.B. skip serialize size if no handle */
         if (hg_bulk->na_mem_descs.handles.s[0] != NULL) {
             na_return_t na_ret;
@@ -1149,12 +2104,16 @@ hg_bulk_serialize(
         }
 #endif
     } else {
-        HG_LOG_SUBSYS_DEBUG(bulk, "Serializing %u NA memory handle(s)",
-            desc_info.segment_count);
+        /* Handles of grouped segments are never null */
+        const struct hg_bulk_segment *handle_segments =
+            (desc_info.flags & HG_BULK_REGV) ? NULL : segments;
+
+        HG_LOG_SUBSYS_DEBUG(
+            bulk, "Serializing %u NA memory handle(s)", handle_count);
 
         ret = hg_bulk_serialize_mem_descs(hg_bulk->na_class, &buf_ptr,
-            &buf_size_left, &hg_bulk->na_mem_descs, segments,
-            desc_info.segment_count);
+            &buf_size_left, &hg_bulk->na_mem_descs, handle_segments,
+            handle_count);
         HG_CHECK_SUBSYS_HG_ERROR(
             bulk, error, ret, "Could not serialize NA mem descriptors");
 
@@ -1163,8 +2122,8 @@ hg_bulk_serialize(
          * skip it. */
         if ((desc_info.flags & HG_BULK_SM) && hg_bulk->na_sm_class) {
             ret = hg_bulk_serialize_mem_descs(hg_bulk->na_sm_class, &buf_ptr,
-                &buf_size_left, &hg_bulk->na_sm_mem_descs, segments,
-                desc_info.segment_count);
+                &buf_size_left, &hg_bulk->na_sm_mem_descs, handle_segments,
+                handle_count);
             HG_CHECK_SUBSYS_HG_ERROR(
                 bulk, error, ret, "Could not serialize NA SM mem descriptors");
         }
@@ -1223,6 +2182,66 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE struct hg_bulk_serialize_blob *
+hg_bulk_serialize_blob_get(struct hg_bulk *hg_bulk, uint8_t flags)
+{
+    return (struct hg_bulk_serialize_blob *) (intptr_t) hg_atomic_get64(
+        HG_BULK_SERIALIZE_BLOB(hg_bulk, flags));
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_serialize_blob_create(struct hg_bulk *hg_bulk, uint8_t flags,
+    struct hg_bulk_serialize_blob **blob_p)
+{
+    hg_atomic_int64_t *blob_ptr = HG_BULK_SERIALIZE_BLOB(hg_bulk, flags);
+    struct hg_bulk_serialize_blob *blob;
+    hg_size_t size;
+    hg_return_t ret;
+
+    /* Data is never embedded into cached form */
+    flags &= (~HG_BULK_EAGER & 0xff);
+    size = hg_bulk_get_serialize_size(hg_bulk, flags);
+
+    blob = (struct hg_bulk_serialize_blob *) malloc(sizeof(*blob) + size);
+    HG_CHECK_SUBSYS_ERROR(bulk, blob == NULL, error, ret, HG_NOMEM,
+        "Could not allocate serialized handle");
+    blob->size = size;
+
+    ret = hg_bulk_serialize_desc(blob->buf, size, flags, hg_bulk);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        bulk, error_free, ret, "Could not serialize handle");
+
+    /* Another thread may have cached it concurrently */
+    if (!hg_atomic_cas64(blob_ptr, 0, (int64_t) (intptr_t) blob)) {
+        free(blob);
+        blob = (struct hg_bulk_serialize_blob *) (intptr_t) hg_atomic_get64(
+            blob_ptr);
+    }
+
+    *blob_p = blob;
+
+    return HG_SUCCESS;
+
+error_free:
+    free(blob);
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_serialize_blobs_free(struct hg_bulk *hg_bulk)
+{
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        free((void *) (intptr_t) hg_atomic_get64(&hg_bulk->serialize_blobs[i]));
+        hg_atomic_set64(&hg_bulk->serialize_blobs[i], 0);
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_serialize_mem_descs(na_class_t *na_class, char **buf_p,
@@ -1250,7 +2269,7 @@ hg_bulk_serialize_mem_descs(na_class_t *na_class, char **buf_p,
         na_return_t na_ret;
 
         /* Skip null segments */
-        if (segments[i].base == NULL)
+        if (segments && segments[i].base == NULL)
             continue;
 
         na_ret = NA_Mem_handle_serialize(
@@ -1278,6 +2297,7 @@ hg_bulk_deserialize(hg_core_class_t *core_class, struct hg_bulk **hg_bulk_p,
     struct hg_bulk_segment *segments;
     const char *buf_ptr = (const char *) buf;
     hg_size_t buf_size_left = buf_size;
+    uint32_t handle_count;
     hg_return_t ret;
 
     hg_bulk = (struct hg_bulk *) calloc(1, sizeof(*hg_bulk));
@@ -1322,9 +2342,17 @@ hg_bulk_deserialize(hg_core_class_t *core_class, struct hg_bulk **hg_bulk_p,
     HG_BULK_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left, segments,
         struct hg_bulk_segment, hg_bulk->desc.info.segment_count);
 
+    /* Number of segments per memory handle */
+    if (hg_bulk->desc.info.flags & HG_BULK_REGV) {
+        HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left, &hg_bulk->regv_max,
+            uint32_t);
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk->regv_max == 0, error, ret,
+            HG_PROTOCOL_ERROR, "Invalid number of segments per handle");
+    }
+    handle_count = HG_BULK_MEM_HANDLE_COUNT(hg_bulk);
+
     /* Get the NA memory handles */
-    if (hg_bulk->desc.info.flags & HG_BULK_REGV ||
-        (hg_bulk->desc.info.segment_count == 1)) {
+    if (handle_count == 1) {
         /* Always deserialize handle if HG_BULK_REGV is set */
         if ((segments[0].base != NULL) ||
             (hg_bulk->desc.info.flags & HG_BULK_REGV)) {
@@ -1363,12 +2391,16 @@ hg_bulk_deserialize(hg_core_class_t *core_class, struct hg_bulk **hg_bulk_p,
 #endif
         }
     } else {
-        HG_LOG_SUBSYS_DEBUG(bulk, "Deserializing %u NA memory handle(s)",
-            hg_bulk->desc.info.segment_count);
+        /* Handles of grouped segments are never null */
+        const struct hg_bulk_segment *handle_segments =
+            (hg_bulk->desc.info.flags & HG_BULK_REGV) ? NULL : segments;
+
+        HG_LOG_SUBSYS_DEBUG(
+            bulk, "Deserializing %u NA memory handle(s)", handle_count);
 
         ret = hg_bulk_deserialize_mem_descs(hg_bulk->na_class, &buf_ptr,
-            &buf_size_left, &hg_bulk->na_mem_descs, segments,
-            hg_bulk->desc.info.segment_count);
+            &buf_size_left, &hg_bulk->na_mem_descs, handle_segments,
+            handle_count);
         HG_CHECK_SUBSYS_HG_ERROR(
             bulk, error, ret, "Could not deserialize NA mem descriptors");
 
@@ -1376,12 +2408,19 @@ hg_bulk_deserialize(hg_core_class_t *core_class, struct hg_bulk **hg_bulk_p,
         /* Only deserialize handles if we were sending over SM */
         if (hg_bulk->desc.info.flags & HG_BULK_SM) {
             ret = hg_bulk_deserialize_mem_descs(hg_bulk->na_sm_class, &buf_ptr,
-                &buf_size_left, &hg_bulk->na_sm_mem_descs, segments,
-                hg_bulk->desc.info.segment_count);
+                &buf_size_left, &hg_bulk->na_sm_mem_descs, handle_segments,
+                handle_count);
             HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret,
                 "Could not deserialize NA SM mem descriptors");
         }
 #endif
+
+        /* Keep track of the range covered by each group */
+        if (hg_bulk->desc.info.flags & HG_BULK_REGV) {
+            ret = hg_bulk_create_regv_segments(hg_bulk);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                bulk, error, ret, "Could not create REGV segments");
+        }
     }
 
     /* Address information */
@@ -1484,7 +2523,7 @@ hg_bulk_deserialize_mem_descs(na_class_t *na_class, const char **buf_p,
         na_return_t na_ret;
 
         /* Skip null segments */
-        if (segments[i].base == NULL)
+        if (segments && segments[i].base == NULL)
             continue;
 
         na_ret = NA_Mem_handle_deserialize(
@@ -1541,8 +2580,9 @@ hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
     /* TODO use flags */
     (void) flags;
 
-    hg_bulk_offset_translate(segments, hg_bulk->desc.info.segment_count, offset,
-        &segment_index, &segment_offset);
+    hg_bulk_offset_translate(segments, hg_bulk_get_segment_ends(hg_bulk),
+        hg_bulk->desc.info.segment_count, offset, &segment_index,
+        &segment_offset);
 
     while ((remaining_size > 0) && (count < max_count)) {
         void *base;
@@ -1578,15 +2618,73 @@ hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
         *actual_count = count;
 }
 
+/*---------------------------------------------------------------------------*/
+static const hg_size_t *
+hg_bulk_get_segment_ends(struct hg_bulk *hg_bulk)
+{
+    const struct hg_bulk_segment *segments;
+    uint32_t i, count = hg_bulk->desc.info.segment_count;
+    hg_size_t *segment_ends, end = 0;
+
+    /* Walking few segments is cheaper */
+    if (count < HG_BULK_SEGMENT_ENDS_MIN)
+        return NULL;
+
+    segment_ends = (hg_size_t *) (intptr_t) hg_atomic_get64(
+        &hg_bulk->segment_ends);
+    if (segment_ends != NULL)
+        return segment_ends;
+
+    /* Offsets are walked if memory cannot be allocated */
+    segment_ends = (hg_size_t *) malloc(count * sizeof(*segment_ends));
+    if (segment_ends == NULL)
+        return NULL;
+
+    segments = HG_BULK_SEGMENTS(hg_bulk);
+    for (i = 0; i < count; i++) {
+        end += segments[i].len;
+        segment_ends[i] = end;
+    }
+
+    /* Another thread may have computed them concurrently */
+    if (!hg_atomic_cas64(
+            &hg_bulk->segment_ends, 0, (int64_t) (intptr_t) segment_ends)) {
+        free(segment_ends);
+        segment_ends = (hg_size_t *) (intptr_t) hg_atomic_get64(
+            &hg_bulk->segment_ends);
+    }
+
+    return segment_ends;
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE void
-hg_bulk_offset_translate(const struct hg_bulk_segment *segments, uint32_t count,
-    hg_size_t offset, uint32_t *segment_start_index,
-    hg_size_t *segment_start_offset)
+hg_bulk_offset_translate(const struct hg_bulk_segment *segments,
+    const hg_size_t *segment_ends, uint32_t count, hg_size_t offset,
+    uint32_t *segment_start_index, hg_size_t *segment_start_offset)
 {
     uint32_t i, new_segment_start_index = 0;
     hg_size_t new_segment_offset = offset, next_offset = 0;
 
+    /* Binary search first segment that ends after offset */
+    if (segment_ends != NULL && offset < segment_ends[count - 1]) {
+        uint32_t low = 0, high = count - 1;
+
+        while (low < high) {
+            uint32_t mid = low + (high - low) / 2;
+
+            if (offset < segment_ends[mid])
+                high = mid;
+            else
+                low = mid + 1;
+        }
+
+        *segment_start_index = low;
+        *segment_start_offset =
+            offset - (segment_ends[low] - segments[low].len);
+        return;
+    }
+
     /* Get start index and handle offset */
     for (i = 0; i < count; i++) {
         next_offset += segments[i].len;
@@ -1683,31 +2781,33 @@ hg_bulk_op_destroy(struct hg_bulk_op_id *hg_bulk_op_id)
     if (hg_atomic_decr32(&hg_bulk_op_id->ref_count))
         return; /* Cannot free yet */
 
+    /* Release references kept on stripes */
+    for (i = 0; i < hg_bulk_op_id->stripe_count; i++)
+        hg_bulk_op_destroy(hg_bulk_op_id->stripes[i]);
+    hg_bulk_op_id->stripe_count = 0;
+
     /* We may have used extra op IDs if this NA class was used */
     if (hg_bulk_op_id->na_class &&
         hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
+        struct hg_bulk_na_op_pool *hg_bulk_na_op_pool = NULL;
         na_op_id_t **na_op_ids = NULL;
 #ifdef NA_HAS_SM
         if (hg_bulk_op_id->na_class ==
-            hg_bulk_op_id->core_context->core_class->na_sm_class)
+            hg_bulk_op_id->core_context->core_class->na_sm_class) {
             na_op_ids = hg_bulk_op_id->na_sm_op_ids.d;
-        else
+            if (hg_bulk_op_id->op_pool)
+                hg_bulk_na_op_pool = &hg_bulk_op_id->op_pool->na_sm_op_pool;
+        } else
 #endif
+        {
             na_op_ids = hg_bulk_op_id->na_op_ids.d;
-
-        if (na_op_ids) {
-            for (i = 0; i < hg_bulk_op_id->op_count; i++) {
-                if (na_op_ids[i] == NULL)
-                    continue;
-
-                NA_Op_destroy(hg_bulk_op_id->na_class, na_op_ids[i]);
-            }
-            free(na_op_ids);
-            hg_bulk_op_id->na_op_ids.d = NULL;
-#ifdef NA_HAS_SM
-            hg_bulk_op_id->na_sm_op_ids.d = NULL;
-#endif
+            if (hg_bulk_op_id->op_pool)
+                hg_bulk_na_op_pool = &hg_bulk_op_id->op_pool->na_op_pool;
         }
+
+        if (na_op_ids)
+            hg_bulk_na_op_pool_release(hg_bulk_na_op_pool,
+                hg_bulk_op_id->na_class, na_op_ids, hg_bulk_op_id->op_count);
     }
 
     /* Repost handle if we were listening, otherwise destroy it */
@@ -1729,6 +2829,16 @@ hg_bulk_op_destroy(struct hg_bulk_op_id *hg_bulk_op_id)
         HG_LOG_SUBSYS_DEBUG(
             bulk, "Freeing bulk op ID (%p)", (void *) hg_bulk_op_id);
 
+        free(hg_bulk_op_id->na_op_ids.d);
+#ifdef NA_HAS_SM
+        free(hg_bulk_op_id->na_sm_op_ids.d);
+#endif
+        free(hg_bulk_op_id->stripes);
+        if (hg_bulk_op_id->pipeline) {
+            hg_thread_spin_destroy(&hg_bulk_op_id->pipeline->lock);
+            free(hg_bulk_op_id->pipeline);
+        }
+
         for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
             if (hg_bulk_op_id->na_op_ids.s[i] == NULL)
                 continue;
@@ -1775,6 +2885,19 @@ hg_bulk_op_pool_create(hg_core_context_t *core_context, unsigned int init_count,
     hg_bulk_op_pool->count = init_count;
     hg_bulk_op_pool->extending = false;
 
+    ret = hg_bulk_na_op_pool_init(
+        &hg_bulk_op_pool->na_op_pool, core_context->core_class->na_class);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        bulk, error, ret, "Could not initialize pool of NA op IDs");
+#ifdef NA_HAS_SM
+    if (core_context->core_class->na_sm_class) {
+        ret = hg_bulk_na_op_pool_init(&hg_bulk_op_pool->na_sm_op_pool,
+            core_context->core_class->na_sm_class);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error, ret, "Could not initialize pool of NA SM op IDs");
+    }
+#endif
+
     for (i = 0; i < init_count; i++) {
         struct hg_bulk_op_id *hg_bulk_op_id = NULL;
 
@@ -1832,6 +2955,11 @@ hg_bulk_op_pool_destroy(struct hg_bulk_op_pool *hg_bulk_op_pool)
     }
     hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
 
+    hg_bulk_na_op_pool_finalize(&hg_bulk_op_pool->na_op_pool);
+#ifdef NA_HAS_SM
+    hg_bulk_na_op_pool_finalize(&hg_bulk_op_pool->na_sm_op_pool);
+#endif
+
     hg_thread_mutex_destroy(&hg_bulk_op_pool->extend_mutex);
     hg_thread_cond_destroy(&hg_bulk_op_pool->extend_cond);
     hg_thread_spin_destroy(&hg_bulk_op_pool->pending_list_lock);
@@ -1906,22 +3034,137 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_na_op_pool_init(
+    struct hg_bulk_na_op_pool *hg_bulk_na_op_pool, na_class_t *na_class)
+{
+    hg_return_t ret;
+
+    /* Array grows on release up to HG_BULK_NA_OP_POOL_MAX */
+    hg_bulk_na_op_pool->op_ids = (na_op_id_t **) malloc(
+        HG_BULK_STATIC_MAX * sizeof(*hg_bulk_na_op_pool->op_ids));
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_na_op_pool->op_ids == NULL, error, ret,
+        HG_NOMEM, "Could not allocate array of NA op IDs");
+
+    hg_bulk_na_op_pool->na_class = na_class;
+    hg_bulk_na_op_pool->count = 0;
+    hg_bulk_na_op_pool->max = HG_BULK_STATIC_MAX;
+    hg_thread_spin_init(&hg_bulk_na_op_pool->lock);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_na_op_pool_finalize(struct hg_bulk_na_op_pool *hg_bulk_na_op_pool)
+{
+    uint32_t i;
+
+    if (hg_bulk_na_op_pool->op_ids == NULL)
+        return;
+
+    for (i = 0; i < hg_bulk_na_op_pool->count; i++)
+        NA_Op_destroy(
+            hg_bulk_na_op_pool->na_class, hg_bulk_na_op_pool->op_ids[i]);
+    free(hg_bulk_na_op_pool->op_ids);
+    hg_bulk_na_op_pool->op_ids = NULL;
+    hg_bulk_na_op_pool->count = 0;
+    hg_thread_spin_destroy(&hg_bulk_na_op_pool->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_na_op_pool_get(struct hg_bulk_na_op_pool *hg_bulk_na_op_pool,
+    na_class_t *na_class, na_op_id_t **na_op_ids, uint32_t count, bool *hit_p)
+{
+    uint32_t i = 0;
+    hg_return_t ret;
+
+    if (hg_bulk_na_op_pool != NULL) {
+        hg_thread_spin_lock(&hg_bulk_na_op_pool->lock);
+        for (; i < count && hg_bulk_na_op_pool->count > 0; i++)
+            na_op_ids[i] =
+                hg_bulk_na_op_pool->op_ids[--hg_bulk_na_op_pool->count];
+        hg_thread_spin_unlock(&hg_bulk_na_op_pool->lock);
+    }
+    *hit_p = (i == count);
+
+    for (; i < count; i++) {
+        na_op_ids[i] = NA_Op_create(na_class, 0);
+        HG_CHECK_SUBSYS_ERROR(bulk, na_op_ids[i] == NULL, error, ret,
+            HG_NA_ERROR, "Could not create NA op ID");
+    }
+
+    return HG_SUCCESS;
+
+error:
+    hg_bulk_na_op_pool_release(hg_bulk_na_op_pool, na_class, na_op_ids, i);
+    memset(na_op_ids, 0, count * sizeof(*na_op_ids));
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_na_op_pool_release(struct hg_bulk_na_op_pool *hg_bulk_na_op_pool,
+    na_class_t *na_class, na_op_id_t **na_op_ids, uint32_t count)
+{
+    uint32_t i = 0;
+
+    if (hg_bulk_na_op_pool != NULL) {
+        hg_thread_spin_lock(&hg_bulk_na_op_pool->lock);
+        if (hg_bulk_na_op_pool->count + count > hg_bulk_na_op_pool->max &&
+            hg_bulk_na_op_pool->max < HG_BULK_NA_OP_POOL_MAX) {
+            uint32_t new_max = HG_BULK_MIN(
+                hg_bulk_na_op_pool->count + count, HG_BULK_NA_OP_POOL_MAX);
+            na_op_id_t **new_op_ids = (na_op_id_t **) realloc(
+                hg_bulk_na_op_pool->op_ids, new_max * sizeof(*new_op_ids));
+
+            if (new_op_ids != NULL) {
+                hg_bulk_na_op_pool->op_ids = new_op_ids;
+                hg_bulk_na_op_pool->max = new_max;
+            }
+        }
+        for (; i < count && hg_bulk_na_op_pool->count < hg_bulk_na_op_pool->max;
+             i++) {
+            if (na_op_ids[i] == NULL)
+                continue;
+            hg_bulk_na_op_pool->op_ids[hg_bulk_na_op_pool->count++] =
+                na_op_ids[i];
+            na_op_ids[i] = NULL;
+        }
+        hg_thread_spin_unlock(&hg_bulk_na_op_pool->lock);
+    }
+
+    /* Destroy NA op IDs that do not fit */
+    for (; i < count; i++) {
+        if (na_op_ids[i] == NULL)
+            continue;
+        NA_Op_destroy(na_class, na_op_ids[i]);
+        na_op_ids[i] = NULL;
+    }
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
     hg_bulk_op_t op, struct hg_core_addr *origin_addr, uint8_t origin_id,
     struct hg_bulk *hg_bulk_origin, hg_size_t origin_offset,
     struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
-    hg_op_id_t *op_id)
+    struct hg_bulk_op_id *parent, hg_op_id_t *op_id)
 {
     const struct hg_bulk_segment *origin_segments =
         HG_BULK_SEGMENTS(hg_bulk_origin);
     const struct hg_bulk_segment *local_segments =
         HG_BULK_SEGMENTS(hg_bulk_local);
+    const hg_size_t *origin_segment_ends = NULL, *local_segment_ends = NULL;
     uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
              local_count = hg_bulk_local->desc.info.segment_count;
     uint8_t origin_flags = hg_bulk_origin->desc.info.flags;
-    uint8_t local_flags = hg_bulk_local->desc.info.flags;
     struct hg_bulk_op_id *hg_bulk_op_id = NULL;
     struct hg_bulk_op_pool *hg_bulk_op_pool =
         hg_core_context_get_bulk_op_pool(core_context);
@@ -1959,6 +3202,12 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
     hg_bulk_op_id->callback_info.info.bulk.op = op;
     hg_bulk_op_id->callback_info.info.bulk.size = size;
 
+    /* Stripes complete through their parent, which keeps a reference to them
+     * until it is released */
+    hg_bulk_op_id->parent = parent;
+    if (parent)
+        hg_atomic_incr32(&hg_bulk_op_id->ref_count);
+
     /* Reset status */
     hg_atomic_set32(&hg_bulk_op_id->status, 0);
     hg_atomic_set32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS);
@@ -1975,14 +3224,21 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
         hg_bulk_op_id->na_class = NULL;
         hg_bulk_op_id->na_context = NULL;
 
+        /* Offsets of handles with many segments are looked up */
+        if (origin_offset > 0)
+            origin_segment_ends = hg_bulk_get_segment_ends(hg_bulk_origin);
+        if (local_offset > 0)
+            local_segment_ends = hg_bulk_get_segment_ends(hg_bulk_local);
+
         /* When doing eager transfers, use self code path to copy data locally
          */
-        ret = hg_bulk_transfer_self(op, origin_segments, origin_count,
-            origin_offset, local_segments, local_count, local_offset, size,
-            hg_bulk_op_id);
+        ret = hg_bulk_transfer_self(op, origin_segments, origin_segment_ends,
+            origin_count, origin_offset, local_segments, local_segment_ends,
+            local_count, local_offset, size, hg_bulk_op_id);
     } else {
         struct hg_bulk_na_mem_desc *origin_mem_descs, *local_mem_descs;
         na_mem_handle_t **origin_mem_handles, **local_mem_handles;
+        struct hg_bulk_segment origin_regv_segment, local_regv_segment;
         na_addr_t *na_origin_addr = NULL;
 
 #ifdef NA_HAS_SM
@@ -2009,23 +3265,227 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
         }
 #endif
 
+        /* Segments that were registered together are transferred using one
+         * NA operation per NA memory handle */
+        origin_segments = hg_bulk_get_na_segments(
+            hg_bulk_origin, &origin_regv_segment, &origin_count);
+        local_segments = hg_bulk_get_na_segments(
+            hg_bulk_local, &local_regv_segment, &local_count);
+
         origin_mem_handles =
-            HG_BULK_MEM_HANDLES(origin_mem_descs, origin_count, origin_flags);
-        local_mem_handles =
-            HG_BULK_MEM_HANDLES(local_mem_descs, local_count, local_flags);
+            HG_BULK_MEM_HANDLES(origin_mem_descs, origin_count);
+        local_mem_handles = HG_BULK_MEM_HANDLES(local_mem_descs, local_count);
+
+        /* Groups of registered segments are few and are walked instead */
+        if (origin_offset > 0 && !(origin_flags & HG_BULK_REGV))
+            origin_segment_ends = hg_bulk_get_segment_ends(hg_bulk_origin);
+        if (local_offset > 0 &&
+            !(hg_bulk_local->desc.info.flags & HG_BULK_REGV))
+            local_segment_ends = hg_bulk_get_segment_ends(hg_bulk_local);
 
         ret = hg_bulk_transfer_na(op, na_origin_addr, origin_id,
-            origin_segments, origin_count, origin_mem_handles, origin_flags,
-            origin_offset, local_segments, local_count, local_mem_handles,
-            local_flags, local_offset, size, hg_bulk_op_id);
+            origin_segments, origin_segment_ends, origin_count,
+            origin_mem_handles, origin_flags, origin_offset, local_segments,
+            local_segment_ends, local_count, local_mem_handles, local_offset,
+            size, hg_bulk_op_id);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error_transfer, ret, "Could not transfer data through NA");
+    }
+
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+    return HG_SUCCESS;
+
+error_transfer:
+    /* Nothing was posted, release references taken on handles */
+    hg_atomic_decr32(&hg_bulk_origin->ref_count);
+    hg_atomic_decr32(&hg_bulk_local->ref_count);
+    if (parent)
+        hg_atomic_decr32(&hg_bulk_op_id->ref_count);
+error:
+    if (hg_bulk_op_id)
+        hg_bulk_op_destroy(hg_bulk_op_id);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_striped(hg_context_t **contexts, unsigned int context_count,
+    hg_cb_t callback, void *arg, hg_bulk_op_t op,
+    struct hg_core_addr *origin_addr, struct hg_bulk *hg_bulk_origin,
+    hg_size_t origin_offset, struct hg_bulk *hg_bulk_local,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    hg_size_t stripe_size;
+    uint32_t stripe_count, i;
+    hg_return_t ret;
+
+    /* Split transfer evenly but do not make stripes too small */
+    stripe_size = (size + context_count - 1) / context_count;
+    if (stripe_size < HG_BULK_STRIPE_MIN)
+        stripe_size = HG_BULK_STRIPE_MIN;
+    stripe_count = (uint32_t) ((size + stripe_size - 1) / stripe_size);
+
+    /* Operation completes on first context */
+    ret = hg_bulk_parent_get(
+        contexts[0]->core_context, stripe_count, &hg_bulk_op_id);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get bulk op ID");
+
+    hg_bulk_op_id->callback = callback;
+    hg_bulk_op_id->callback_info.arg = arg;
+    hg_bulk_op_id->callback_info.info.bulk.origin_handle = hg_bulk_origin;
+    hg_atomic_incr32(&hg_bulk_origin->ref_count);
+    hg_bulk_op_id->callback_info.info.bulk.local_handle = hg_bulk_local;
+    hg_atomic_incr32(&hg_bulk_local->ref_count);
+    hg_bulk_op_id->callback_info.info.bulk.op = op;
+    hg_bulk_op_id->callback_info.info.bulk.size = size;
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Transferring data in %u stripe(s) of %" PRIu64 " bytes", stripe_count,
+        stripe_size);
+
+    for (i = 0; i < stripe_count; i++) {
+        hg_size_t stripe_offset = i * stripe_size;
+
+        ret = hg_bulk_parent_post(hg_bulk_op_id, contexts[i]->core_context, op,
+            origin_addr, hg_bulk_origin, origin_offset + stripe_offset,
+            hg_bulk_local, local_offset + stripe_offset,
+            HG_BULK_MIN(stripe_size, size - stripe_offset));
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error_transfer, ret, "Could not transfer stripe");
+        if (hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_ERRORED)
+            break;
+    }
+
+    /* Account for stripes that were not posted and for extra operation */
+    hg_bulk_parent_post_end(hg_bulk_op_id, stripe_count);
+
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+    return HG_SUCCESS;
+
+error_transfer:
+    /* Nothing was posted, release references taken on handles */
+    hg_atomic_decr32(&hg_bulk_origin->ref_count);
+    hg_atomic_decr32(&hg_bulk_local->ref_count);
+    hg_bulk_op_destroy(hg_bulk_op_id);
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_multi(hg_core_context_t *core_context, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, const struct hg_bulk_origin_desc *origins,
+    uint32_t origin_count, struct hg_bulk *hg_bulk_local,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    uint32_t i;
+    hg_return_t ret;
+
+    ret = hg_bulk_parent_get(core_context, origin_count, &hg_bulk_op_id);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get bulk op ID");
+
+    /* There is no single origin handle to report */
+    hg_bulk_op_id->callback = callback;
+    hg_bulk_op_id->callback_info.arg = arg;
+    hg_bulk_op_id->callback_info.info.bulk.origin_handle = HG_BULK_NULL;
+    hg_bulk_op_id->callback_info.info.bulk.local_handle = hg_bulk_local;
+    hg_atomic_incr32(&hg_bulk_local->ref_count);
+    hg_bulk_op_id->callback_info.info.bulk.op = op;
+    hg_bulk_op_id->callback_info.info.bulk.size = size;
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Transferring %" PRIu64 " bytes from/to %u origin(s)", size,
+        origin_count);
+
+    /* Post all transfers back-to-back, data is packed in local handle */
+    for (i = 0; i < origin_count; i++) {
+        if (origins[i].size > 0) {
+            ret = hg_bulk_parent_post(hg_bulk_op_id, core_context, op,
+                (struct hg_core_addr *) origins[i].addr,
+                (struct hg_bulk *) origins[i].handle, origins[i].offset,
+                hg_bulk_local, local_offset, origins[i].size);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                bulk, error_transfer, ret, "Could not transfer from origin");
+            if (hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_ERRORED)
+                break;
+        }
+        local_offset += origins[i].size;
     }
 
+    /* Account for transfers that were not posted and for extra operation */
+    hg_bulk_parent_post_end(hg_bulk_op_id, origin_count);
+
     /* Assign op_id */
     if (op_id && op_id != HG_OP_ID_IGNORE)
         *op_id = (hg_op_id_t) hg_bulk_op_id;
 
     return HG_SUCCESS;
 
+error_transfer:
+    /* Nothing was posted, release reference taken on handle */
+    hg_atomic_decr32(&hg_bulk_local->ref_count);
+    hg_bulk_op_destroy(hg_bulk_op_id);
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_parent_get(hg_core_context_t *core_context, uint32_t stripe_count,
+    struct hg_bulk_op_id **hg_bulk_op_id_p)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    struct hg_bulk_op_pool *hg_bulk_op_pool =
+        hg_core_context_get_bulk_op_pool(core_context);
+    hg_return_t ret;
+
+    if (hg_bulk_op_pool) {
+        ret = hg_bulk_op_pool_get(hg_bulk_op_pool, &hg_bulk_op_id);
+        HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get bulk op ID");
+    } else {
+        ret = hg_bulk_op_create(core_context, &hg_bulk_op_id);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            bulk, error, ret, "Could not create bulk op ID");
+    }
+
+    /* Keep stripes array across re-uses of op ID */
+    if (hg_bulk_op_id->stripe_max < stripe_count) {
+        free(hg_bulk_op_id->stripes);
+        hg_bulk_op_id->stripe_max = 0;
+        hg_bulk_op_id->stripes = (struct hg_bulk_op_id **) malloc(
+            stripe_count * sizeof(*hg_bulk_op_id->stripes));
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_op_id->stripes == NULL, error, ret,
+            HG_NOMEM, "Could not allocate array of stripes");
+        hg_bulk_op_id->stripe_max = stripe_count;
+    }
+
+    hg_bulk_op_id->parent = NULL;
+    hg_bulk_op_id->na_class = NULL;
+    hg_bulk_op_id->na_context = NULL;
+    hg_bulk_op_id->stripe_count = 0;
+
+    /* Reset status */
+    hg_atomic_set32(&hg_bulk_op_id->status, 0);
+    hg_atomic_set32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS);
+
+    /* Count one extra operation so that the bulk operation cannot complete
+     * before all stripes have been posted */
+    hg_bulk_op_id->op_count = stripe_count + 1;
+    hg_atomic_set32(&hg_bulk_op_id->op_completed_count, 0);
+
+    *hg_bulk_op_id_p = hg_bulk_op_id;
+
+    return HG_SUCCESS;
+
 error:
     if (hg_bulk_op_id)
         hg_bulk_op_destroy(hg_bulk_op_id);
@@ -2033,49 +3493,97 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_parent_post(struct hg_bulk_op_id *parent,
+    hg_core_context_t *core_context, hg_bulk_op_t op,
+    struct hg_core_addr *origin_addr, struct hg_bulk *hg_bulk_origin,
+    hg_size_t origin_offset, struct hg_bulk *hg_bulk_local,
+    hg_size_t local_offset, hg_size_t size)
+{
+    hg_op_id_t stripe_op_id = HG_OP_ID_NULL;
+    hg_return_t ret;
+
+    ret = hg_bulk_transfer(core_context, NULL, NULL, op, origin_addr, 0,
+        hg_bulk_origin, origin_offset, hg_bulk_local, local_offset, size,
+        parent, &stripe_op_id);
+    if (ret != HG_SUCCESS) {
+        /* Nothing was posted yet, let caller report error */
+        if (parent->stripe_count == 0)
+            return ret;
+
+        /* Stripes were posted, report error through completion */
+        hg_atomic_or32(&parent->status, HG_BULK_OP_ERRORED);
+        hg_atomic_cas32(
+            &parent->ret_status, (int32_t) HG_SUCCESS, (int32_t) ret);
+        return HG_SUCCESS;
+    }
+
+    parent->stripes[parent->stripe_count++] =
+        (struct hg_bulk_op_id *) stripe_op_id;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_parent_post_end(struct hg_bulk_op_id *parent, uint32_t stripe_count)
+{
+    uint32_t i;
+
+    for (i = parent->stripe_count; i <= stripe_count; i++)
+        if ((uint32_t) hg_atomic_incr32(&parent->op_completed_count) ==
+            parent->op_count)
+            hg_bulk_complete(parent,
+                (hg_return_t) hg_atomic_get32(&parent->ret_status), true);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_transfer_self(hg_bulk_op_t op,
-    const struct hg_bulk_segment *origin_segments, uint32_t origin_count,
+    const struct hg_bulk_segment *origin_segments,
+    const hg_size_t *origin_segment_ends, uint32_t origin_count,
     hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
-    uint32_t local_count, hg_size_t local_offset, hg_size_t size,
+    const hg_size_t *local_segment_ends, uint32_t local_count,
+    hg_size_t local_offset, hg_size_t size,
     struct hg_bulk_op_id *hg_bulk_op_id)
 {
     uint32_t origin_segment_start_index = 0, local_segment_start_index = 0;
     hg_size_t origin_segment_start_offset = 0, local_segment_start_offset = 0;
-    hg_bulk_copy_op_t copy_op;
+    size_t nt_copy_threshold = hg_core_bulk_get_nt_copy_threshold(
+        hg_bulk_op_id->core_context->core_class);
+    bool nt_copy = (nt_copy_threshold > 0) && (size >= nt_copy_threshold);
     hg_return_t ret;
 
-    switch (op) {
-        case HG_BULK_PUSH:
-            copy_op = hg_bulk_memcpy_put;
-            break;
-        case HG_BULK_PULL:
-            copy_op = hg_bulk_memcpy_get;
-            break;
-        default:
-            HG_GOTO_SUBSYS_ERROR(
-                bulk, error, ret, HG_INVALID_ARG, "Unknown bulk operation");
-    }
+    HG_CHECK_SUBSYS_ERROR(bulk, op != HG_BULK_PUSH && op != HG_BULK_PULL,
+        error, ret, HG_INVALID_ARG, "Unknown bulk operation");
 
     HG_LOG_SUBSYS_DEBUG(bulk, "Transferring data through self");
 
     /* Translate origin offset */
     if (origin_offset > 0)
-        hg_bulk_offset_translate(origin_segments, origin_count, origin_offset,
-            &origin_segment_start_index, &origin_segment_start_offset);
+        hg_bulk_offset_translate(origin_segments, origin_segment_ends,
+            origin_count, origin_offset, &origin_segment_start_index,
+            &origin_segment_start_offset);
 
     /* Translate local offset */
     if (local_offset > 0)
-        hg_bulk_offset_translate(local_segments, local_count, local_offset,
-            &local_segment_start_index, &local_segment_start_offset);
+        hg_bulk_offset_translate(local_segments, local_segment_ends,
+            local_count, local_offset, &local_segment_start_index,
+            &local_segment_start_offset);
 
     /* Do actual transfer */
-    hg_bulk_transfer_segments_self(copy_op, origin_segments, origin_count,
+    hg_bulk_transfer_segments_self(op, nt_copy, origin_segments, origin_count,
         origin_segment_start_index, origin_segment_start_offset, local_segments,
         local_count, local_segment_start_index, local_segment_start_offset,
         size);
 
+#ifdef HG_BULK_HAS_NT_COPY
+    /* Make non-temporal stores visible before completion */
+    if (nt_copy)
+        _mm_sfence();
+#endif
+
     /* Complete immediately */
     hg_bulk_complete(hg_bulk_op_id, HG_SUCCESS, true);
 
@@ -2087,7 +3595,7 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static void
-hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
+hg_bulk_transfer_segments_self(hg_bulk_op_t op, bool nt_copy,
     const struct hg_bulk_segment *origin_segments, uint32_t origin_count,
     hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
     const struct hg_bulk_segment *local_segments, uint32_t local_count,
@@ -2102,6 +3610,13 @@ hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
 
     while (remaining_size > 0 && origin_segment_index < origin_count &&
            local_segment_index < local_count) {
+        char *origin_address =
+            (char *) origin_segments[origin_segment_index].base +
+            origin_segment_offset;
+        char *local_address =
+            (char *) local_segments[local_segment_index].base +
+            local_segment_offset;
+
         /* Can only transfer smallest size */
         hg_size_t transfer_size = HG_BULK_MIN(
             (origin_segments[origin_segment_index].len - origin_segment_offset),
@@ -2111,9 +3626,12 @@ hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
         transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
 
         /* Copy segment */
-        copy_op(local_segments[local_segment_index].base, local_segment_offset,
-            origin_segments[origin_segment_index].base, origin_segment_offset,
-            transfer_size);
+        if (op == HG_BULK_PUSH)
+            hg_bulk_memcpy(
+                origin_address, local_address, transfer_size, nt_copy);
+        else
+            hg_bulk_memcpy(
+                local_address, origin_address, transfer_size, nt_copy);
 
         /* Decrease remaining size from the size of data we transferred
          * and exit if everything has been transferred */
@@ -2138,18 +3656,58 @@ hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
     }
 }
 
+#ifdef HG_BULK_HAS_NT_COPY
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_memcpy_nt(void *dest, const void *src, hg_size_t size)
+{
+    char *dest_ptr = (char *) dest;
+    const char *src_ptr = (const char *) src;
+    hg_size_t head_size =
+        (hg_size_t) ((0 - (uintptr_t) dest_ptr) & (HG_BULK_NT_ALIGN - 1));
+
+    /* Copy unaligned head so that destination is aligned */
+    head_size = HG_BULK_MIN(head_size, size);
+    memcpy(dest_ptr, src_ptr, (size_t) head_size);
+    dest_ptr += head_size;
+    src_ptr += head_size;
+    size -= head_size;
+
+    /* Stream one cache line at a time, source may not be aligned */
+    for (; size >= 4 * HG_BULK_NT_ALIGN; size -= 4 * HG_BULK_NT_ALIGN) {
+        __m128i xmm0 = _mm_loadu_si128((const __m128i *) src_ptr);
+        __m128i xmm1 = _mm_loadu_si128((const __m128i *) (src_ptr + 16));
+        __m128i xmm2 = _mm_loadu_si128((const __m128i *) (src_ptr + 32));
+        __m128i xmm3 = _mm_loadu_si128((const __m128i *) (src_ptr + 48));
+
+        _mm_stream_si128((__m128i *) dest_ptr, xmm0);
+        _mm_stream_si128((__m128i *) (dest_ptr + 16), xmm1);
+        _mm_stream_si128((__m128i *) (dest_ptr + 32), xmm2);
+        _mm_stream_si128((__m128i *) (dest_ptr + 48), xmm3);
+        dest_ptr += 4 * HG_BULK_NT_ALIGN;
+        src_ptr += 4 * HG_BULK_NT_ALIGN;
+    }
+
+    /* Copy remaining tail */
+    memcpy(dest_ptr, src_ptr, (size_t) size);
+}
+#endif
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
     uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
-    uint32_t origin_count, na_mem_handle_t **origin_mem_handles,
-    uint8_t origin_flags, hg_size_t origin_offset,
-    const struct hg_bulk_segment *local_segments, uint32_t local_count,
-    na_mem_handle_t **local_mem_handles, uint8_t local_flags,
-    hg_size_t local_offset, hg_size_t size, struct hg_bulk_op_id *hg_bulk_op_id)
+    const hg_size_t *origin_segment_ends, uint32_t origin_count,
+    na_mem_handle_t **origin_mem_handles, uint8_t origin_flags,
+    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
+    const hg_size_t *local_segment_ends, uint32_t local_count,
+    na_mem_handle_t **local_mem_handles, hg_size_t local_offset,
+    hg_size_t size, struct hg_bulk_op_id *hg_bulk_op_id)
 {
     hg_bulk_na_op_id_t *hg_bulk_na_op_ids;
     na_bulk_op_t na_bulk_op;
+    hg_size_t chunk_size;
+    uint32_t chunk_window;
     hg_return_t ret;
 
     /* Map op to NA op */
@@ -2173,8 +3731,13 @@ hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
 #endif
         hg_bulk_na_op_ids = &hg_bulk_op_id->na_op_ids;
 
-    if (((origin_flags & HG_BULK_REGV) || origin_count == 1) &&
-        ((local_flags & HG_BULK_REGV) || local_count == 1)) {
+    /* Transfers that do not exceed chunk size are not split */
+    hg_core_bulk_get_chunk_info(
+        hg_bulk_op_id->core_context->core_class, &chunk_size, &chunk_window);
+    if (size <= chunk_size)
+        chunk_size = 0;
+
+    if (chunk_size == 0 && origin_count == 1 && local_count == 1) {
         na_return_t na_ret;
 
         HG_LOG_SUBSYS_DEBUG(
@@ -2192,23 +3755,40 @@ hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
         hg_size_t origin_segment_start_offset = 0,
                   local_segment_start_offset = 0;
         na_op_id_t **na_op_ids;
+        uint32_t posted_count = 0;
 
         /* Translate bulk_offset */
         if (origin_offset > 0)
-            hg_bulk_offset_translate(origin_segments, origin_count,
-                origin_offset, &origin_segment_start_index,
+            hg_bulk_offset_translate(origin_segments, origin_segment_ends,
+                origin_count, origin_offset, &origin_segment_start_index,
                 &origin_segment_start_offset);
 
         /* Translate block offset */
         if (local_offset > 0)
-            hg_bulk_offset_translate(local_segments, local_count, local_offset,
-                &local_segment_start_index, &local_segment_start_offset);
+            hg_bulk_offset_translate(local_segments, local_segment_ends,
+                local_count, local_offset, &local_segment_start_index,
+                &local_segment_start_offset);
+
+        if (chunk_size > 0) {
+            ret = hg_bulk_transfer_chunks_na(na_bulk_op, na_origin_addr,
+                origin_id, origin_segments, origin_count, origin_mem_handles,
+                origin_flags, origin_segment_start_index,
+                origin_segment_start_offset, local_segments, local_count,
+                local_mem_handles, local_segment_start_index,
+                local_segment_start_offset, size, chunk_size, chunk_window,
+                hg_bulk_na_op_ids, hg_bulk_op_id);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                bulk, error, ret, "Could not transfer data chunks");
+
+            return HG_SUCCESS;
+        }
 
         /* Determine number of NA operations that will be needed */
         hg_bulk_op_id->op_count = hg_bulk_transfer_get_op_count(origin_segments,
             origin_count, origin_segment_start_index,
             origin_segment_start_offset, local_segments, local_count,
-            local_segment_start_index, local_segment_start_offset, size);
+            local_segment_start_index, local_segment_start_offset, size, 0,
+            UINT32_MAX);
         HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_op_id->op_count == 0, error, ret,
             HG_INVALID_ARG, "Could not get bulk op_count");
 
@@ -2216,27 +3796,9 @@ hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
             "Transferring data through NA in %u operation(s)",
             hg_bulk_op_id->op_count);
 
-        /* Create extra operation IDs if the number of operations exceeds
-         * the number of pre-allocated op IDs */
-        if (hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
-            unsigned int i;
-
-            /* Allocate memory for NA operation IDs */
-            hg_bulk_na_op_ids->d =
-                malloc(sizeof(na_op_id_t *) * hg_bulk_op_id->op_count);
-            HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_na_op_ids->d == NULL, error,
-                ret, HG_NOMEM, "Could not allocate memory for op_ids");
-
-            for (i = 0; i < hg_bulk_op_id->op_count; i++) {
-                hg_bulk_na_op_ids->d[i] =
-                    NA_Op_create(hg_bulk_op_id->na_class, 0);
-                HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_na_op_ids->d[i] == NULL,
-                    error, ret, HG_NA_ERROR, "Could not create NA op ID");
-            }
-
-            na_op_ids = hg_bulk_na_op_ids->d;
-        } else
-            na_op_ids = hg_bulk_na_op_ids->s;
+        ret = hg_bulk_transfer_get_na_op_ids(
+            hg_bulk_op_id, hg_bulk_na_op_ids, origin_flags, &na_op_ids);
+        HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get NA op IDs");
 
         /* Do actual transfer */
         ret = hg_bulk_transfer_segments_na(hg_bulk_op_id->na_class,
@@ -2246,7 +3808,26 @@ hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t *na_origin_addr,
             origin_segment_start_offset, local_segments, local_count,
             local_mem_handles, local_segment_start_index,
             local_segment_start_offset, size, na_op_ids,
-            hg_bulk_op_id->op_count);
+            hg_bulk_op_id->op_count, &posted_count);
+        if (ret != HG_SUCCESS && posted_count > 0) {
+            uint32_t i;
+
+            /* Operations were posted, report error through completion once
+             * they complete and account for the ones that were not posted */
+            hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+            hg_atomic_cas32(
+                &hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS, (int32_t) ret);
+            for (i = posted_count; i < hg_bulk_op_id->op_count; i++)
+                if ((uint32_t) hg_atomic_incr32(
+                        &hg_bulk_op_id->op_completed_count) ==
+                    hg_bulk_op_id->op_count)
+                    hg_bulk_complete(hg_bulk_op_id,
+                        (hg_return_t) hg_atomic_get32(
+                            &hg_bulk_op_id->ret_status),
+                        true);
+
+            return HG_SUCCESS;
+        }
         HG_CHECK_SUBSYS_HG_ERROR(
             bulk, error, ret, "Could not transfer data segments");
     }
@@ -2264,7 +3845,7 @@ hg_bulk_transfer_get_op_count(const struct hg_bulk_segment *origin_segments,
     hg_size_t origin_segment_start_offset,
     const struct hg_bulk_segment *local_segments, uint32_t local_count,
     hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
-    hg_size_t size)
+    hg_size_t size, hg_size_t chunk_size, uint32_t count_max)
 {
     hg_size_t origin_segment_index = origin_segment_start_index;
     hg_size_t local_segment_index = local_segment_start_index;
@@ -2283,8 +3864,16 @@ hg_bulk_transfer_get_op_count(const struct hg_bulk_segment *origin_segments,
         /* Remaining size may be smaller */
         transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
 
-        /* Increment op count */
-        count++;
+        /* Increment op count, each chunk requires a separate operation */
+        if (chunk_size > 0) {
+            hg_size_t chunk_count =
+                (transfer_size + chunk_size - 1) / chunk_size;
+
+            if (chunk_count >= (hg_size_t) (count_max - count))
+                return count_max;
+            count += (uint32_t) chunk_count;
+        } else if (++count == count_max)
+            return count_max;
 
         /* Decrease remaining size from the size of data we transferred
          * and exit if everything has been transferred */
@@ -2308,7 +3897,59 @@ hg_bulk_transfer_get_op_count(const struct hg_bulk_segment *origin_segments,
         }
     }
 
-    return count;
+    return count;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_get_na_op_ids(struct hg_bulk_op_id *hg_bulk_op_id,
+    hg_bulk_na_op_id_t *hg_bulk_na_op_ids, uint8_t origin_flags,
+    na_op_id_t ***na_op_ids_p)
+{
+    hg_return_t ret;
+
+    /* Use extra operation IDs from context pool if the number of
+     * operations exceeds the number of pre-allocated op IDs */
+    if (hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
+        struct hg_bulk_na_op_pool *hg_bulk_na_op_pool = NULL;
+        bool hit;
+
+        /* Keep NA operation IDs array across re-uses of op ID */
+        if (hg_bulk_na_op_ids->d_max < hg_bulk_op_id->op_count) {
+            free(hg_bulk_na_op_ids->d);
+            hg_bulk_na_op_ids->d_max = 0;
+            hg_bulk_na_op_ids->d =
+                malloc(sizeof(na_op_id_t *) * hg_bulk_op_id->op_count);
+            HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_na_op_ids->d == NULL, error,
+                ret, HG_NOMEM, "Could not allocate memory for op_ids");
+            hg_bulk_na_op_ids->d_max = hg_bulk_op_id->op_count;
+        }
+
+        if (hg_bulk_op_id->op_pool) {
+#ifdef NA_HAS_SM
+            if (origin_flags & HG_BULK_SM)
+                hg_bulk_na_op_pool = &hg_bulk_op_id->op_pool->na_sm_op_pool;
+            else
+#endif
+                hg_bulk_na_op_pool = &hg_bulk_op_id->op_pool->na_op_pool;
+        }
+
+        ret = hg_bulk_na_op_pool_get(hg_bulk_na_op_pool,
+            hg_bulk_op_id->na_class, hg_bulk_na_op_ids->d,
+            hg_bulk_op_id->op_count, &hit);
+        HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get NA op IDs");
+        if (hit)
+            hg_core_bulk_na_op_pool_hit(
+                hg_bulk_op_id->core_context->core_class);
+
+        *na_op_ids_p = hg_bulk_na_op_ids->d;
+    } else
+        *na_op_ids_p = hg_bulk_na_op_ids->s;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2322,7 +3963,7 @@ hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
     const struct hg_bulk_segment *local_segments, uint32_t local_count,
     na_mem_handle_t **local_mem_handles, hg_size_t local_segment_start_index,
     hg_size_t local_segment_start_offset, hg_size_t size,
-    na_op_id_t *na_op_ids[], uint32_t na_op_count)
+    na_op_id_t *na_op_ids[], uint32_t na_op_count, uint32_t *posted_count_p)
 {
     hg_size_t origin_segment_index = origin_segment_start_index;
     hg_size_t local_segment_index = local_segment_start_index;
@@ -2351,7 +3992,7 @@ hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
             (hg_return_t) na_ret, "Could not transfer data (%s)",
             NA_Error_to_string(na_ret));
 
-        count++;
+        *posted_count_p = ++count;
 
         /* Decrease remaining size from the size of data we transferred
          * and exit if everything has been transferred */
@@ -2385,6 +4026,199 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_chunks_na(na_bulk_op_t na_bulk_op, na_addr_t *na_origin_addr,
+    uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
+    uint32_t origin_count, na_mem_handle_t **origin_mem_handles,
+    uint8_t origin_flags, uint32_t origin_segment_start_index,
+    hg_size_t origin_segment_start_offset,
+    const struct hg_bulk_segment *local_segments, uint32_t local_count,
+    na_mem_handle_t **local_mem_handles, uint32_t local_segment_start_index,
+    hg_size_t local_segment_start_offset, hg_size_t size, hg_size_t chunk_size,
+    uint32_t chunk_window, hg_bulk_na_op_id_t *hg_bulk_na_op_ids,
+    struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_pipeline *pipeline = hg_bulk_op_id->pipeline;
+    na_op_id_t **na_op_ids;
+    hg_return_t ret;
+    uint32_t i;
+    bool done;
+
+    /* Pipeline state is allocated once and kept across re-uses of op ID */
+    if (pipeline == NULL) {
+        pipeline = (struct hg_bulk_pipeline *) malloc(sizeof(*pipeline) +
+            chunk_window * sizeof(struct hg_bulk_pipeline_slot));
+        HG_CHECK_SUBSYS_ERROR(bulk, pipeline == NULL, error, ret, HG_NOMEM,
+            "Could not allocate bulk pipeline");
+        hg_thread_spin_init(&pipeline->lock);
+        pipeline->slot_max = chunk_window;
+        hg_bulk_op_id->pipeline = pipeline;
+    }
+
+    /* Only keep as many chunks in flight as needed */
+    hg_bulk_op_id->op_count = hg_bulk_transfer_get_op_count(origin_segments,
+        origin_count, origin_segment_start_index, origin_segment_start_offset,
+        local_segments, local_count, local_segment_start_index,
+        local_segment_start_offset, size, chunk_size, pipeline->slot_max);
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_op_id->op_count == 0, error, ret,
+        HG_INVALID_ARG, "Could not get bulk op_count");
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Transferring data through NA in chunks of %" PRIu64
+        " bytes (%u in flight)",
+        chunk_size, hg_bulk_op_id->op_count);
+
+    ret = hg_bulk_transfer_get_na_op_ids(
+        hg_bulk_op_id, hg_bulk_na_op_ids, origin_flags, &na_op_ids);
+    HG_CHECK_SUBSYS_HG_ERROR(bulk, error, ret, "Could not get NA op IDs");
+
+    /* Single segments may be on the stack of caller, keep a copy */
+    if (origin_count == 1) {
+        pipeline->origin_segment = origin_segments[0];
+        origin_segments = &pipeline->origin_segment;
+    }
+    if (local_count == 1) {
+        pipeline->local_segment = local_segments[0];
+        local_segments = &pipeline->local_segment;
+    }
+    pipeline->origin_segments = origin_segments;
+    pipeline->local_segments = local_segments;
+    pipeline->origin_mem_handles = origin_mem_handles;
+    pipeline->local_mem_handles = local_mem_handles;
+    pipeline->na_origin_addr = na_origin_addr;
+    pipeline->na_bulk_op = na_bulk_op;
+    pipeline->origin_segment_offset = origin_segment_start_offset;
+    pipeline->local_segment_offset = local_segment_start_offset;
+    pipeline->remaining_size = size;
+    pipeline->chunk_size = chunk_size;
+    pipeline->origin_segment_index = origin_segment_start_index;
+    pipeline->local_segment_index = local_segment_start_index;
+    pipeline->origin_count = origin_count;
+    pipeline->local_count = local_count;
+    pipeline->completed_count = 0;
+    pipeline->origin_id = origin_id;
+
+    /* Count one extra operation so that the bulk operation cannot complete
+     * before all slots have been posted */
+    pipeline->posted_count = 1;
+
+    for (i = 0; i < hg_bulk_op_id->op_count; i++) {
+        pipeline->slots[i].hg_bulk_op_id = hg_bulk_op_id;
+        pipeline->slots[i].na_op_id = na_op_ids[i];
+
+        (void) hg_bulk_pipeline_post(&pipeline->slots[i], false);
+
+        /* Stop posting on error, nothing was posted if first chunk failed */
+        ret = (hg_return_t) hg_atomic_get32(&hg_bulk_op_id->ret_status);
+        HG_CHECK_SUBSYS_ERROR_NORET(
+            bulk, ret != HG_SUCCESS && i == 0, error, "Could not post chunk");
+        if (ret != HG_SUCCESS)
+            break;
+    }
+
+    /* Errors are reported through completion once posted chunks complete */
+    hg_thread_spin_lock(&pipeline->lock);
+    done = (++pipeline->completed_count == pipeline->posted_count);
+    hg_thread_spin_unlock(&pipeline->lock);
+    if (done)
+        hg_bulk_complete(hg_bulk_op_id,
+            (hg_return_t) hg_atomic_get32(&hg_bulk_op_id->ret_status), true);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static bool
+hg_bulk_pipeline_post(struct hg_bulk_pipeline_slot *slot, bool completed)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = slot->hg_bulk_op_id;
+    struct hg_bulk_pipeline *pipeline = hg_bulk_op_id->pipeline;
+    uint32_t origin_segment_index = 0, local_segment_index = 0;
+    hg_size_t origin_segment_offset = 0, local_segment_offset = 0;
+    hg_size_t transfer_size = 0;
+    na_return_t na_ret;
+    bool done;
+
+    hg_thread_spin_lock(&pipeline->lock);
+    if (completed)
+        pipeline->completed_count++;
+
+    /* Take next chunk unless operation was canceled or errored */
+    if (pipeline->remaining_size > 0 &&
+        pipeline->origin_segment_index < pipeline->origin_count &&
+        pipeline->local_segment_index < pipeline->local_count &&
+        hg_atomic_get32(&hg_bulk_op_id->ret_status) == HG_SUCCESS &&
+        !(hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_CANCELED)) {
+        origin_segment_index = pipeline->origin_segment_index;
+        origin_segment_offset = pipeline->origin_segment_offset;
+        local_segment_index = pipeline->local_segment_index;
+        local_segment_offset = pipeline->local_segment_offset;
+
+        /* Can only transfer smallest size */
+        transfer_size = HG_BULK_MIN(
+            (pipeline->origin_segments[origin_segment_index].len -
+                origin_segment_offset),
+            (pipeline->local_segments[local_segment_index].len -
+                local_segment_offset));
+        transfer_size = HG_BULK_MIN(pipeline->remaining_size, transfer_size);
+        transfer_size = HG_BULK_MIN(pipeline->chunk_size, transfer_size);
+
+        pipeline->remaining_size -= transfer_size;
+        pipeline->origin_segment_offset += transfer_size;
+        pipeline->local_segment_offset += transfer_size;
+
+        /* Change segment if new offset exceeds segment size */
+        if (pipeline->origin_segment_offset >=
+            pipeline->origin_segments[origin_segment_index].len) {
+            pipeline->origin_segment_index++;
+            pipeline->origin_segment_offset = 0;
+        }
+        if (pipeline->local_segment_offset >=
+            pipeline->local_segments[local_segment_index].len) {
+            pipeline->local_segment_index++;
+            pipeline->local_segment_offset = 0;
+        }
+        pipeline->posted_count++;
+    }
+    done = (pipeline->completed_count == pipeline->posted_count);
+    hg_thread_spin_unlock(&pipeline->lock);
+
+    if (transfer_size == 0)
+        return done;
+
+    na_ret = pipeline->na_bulk_op(hg_bulk_op_id->na_class,
+        hg_bulk_op_id->na_context, hg_bulk_transfer_chunk_cb, slot,
+        pipeline->local_mem_handles[local_segment_index], local_segment_offset,
+        pipeline->origin_mem_handles[origin_segment_index],
+        origin_segment_offset, transfer_size, pipeline->na_origin_addr,
+        pipeline->origin_id, slot->na_op_id);
+    if (na_ret != NA_SUCCESS) {
+        HG_LOG_SUBSYS_ERROR(
+            bulk, "Could not transfer data (%s)", NA_Error_to_string(na_ret));
+
+        /* Mark handle as errored and keep first non-success ret status */
+        hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+        hg_atomic_cas32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS,
+            (int32_t) na_ret);
+
+        /* Chunk will never complete, account for it here */
+        hg_thread_spin_lock(&pipeline->lock);
+        done = (++pipeline->completed_count == pipeline->posted_count);
+        hg_thread_spin_unlock(&pipeline->lock);
+
+        return done;
+    }
+
+    /* Op ID must no longer be accessed as it may complete at any time. A
+     * chunk posted while canceling runs to completion but no other chunk will
+     * be posted after it. */
+    return false;
+}
+
 /*---------------------------------------------------------------------------*/
 static void
 hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
@@ -2392,9 +4226,48 @@ hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
     struct hg_bulk_op_id *hg_bulk_op_id =
         (struct hg_bulk_op_id *) callback_info->arg;
 
-    if (callback_info->ret == NA_SUCCESS) {
+    hg_bulk_transfer_set_status(hg_bulk_op_id, callback_info->ret);
+
+    /* When all NA transfers that correspond to the bulk operation complete,
+     * complete the bulk operation. */
+    if ((uint32_t) hg_atomic_incr32(&hg_bulk_op_id->op_completed_count) ==
+        hg_bulk_op_id->op_count) {
+        hg_bulk_complete(hg_bulk_op_id,
+            (hg_return_t) hg_atomic_get32(&hg_bulk_op_id->ret_status), false);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_transfer_chunk_cb(const struct na_cb_info *callback_info)
+{
+    struct hg_bulk_pipeline_slot *slot =
+        (struct hg_bulk_pipeline_slot *) callback_info->arg;
+    struct hg_bulk_op_id *hg_bulk_op_id = slot->hg_bulk_op_id;
+
+    hg_bulk_transfer_set_status(hg_bulk_op_id, callback_info->ret);
+
+    /* Re-use NA op ID for next chunk, complete the bulk operation once the
+     * last chunk completes */
+    if (hg_bulk_pipeline_post(slot, true)) {
+        /* Chunks that were not posted because of a cancelation */
+        if (hg_bulk_op_id->pipeline->remaining_size > 0)
+            hg_atomic_cas32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS,
+                (int32_t) HG_CANCELED);
+
+        hg_bulk_complete(hg_bulk_op_id,
+            (hg_return_t) hg_atomic_get32(&hg_bulk_op_id->ret_status), false);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_transfer_set_status(
+    struct hg_bulk_op_id *hg_bulk_op_id, na_return_t na_ret)
+{
+    if (na_ret == NA_SUCCESS) {
         /* Nothing */
-    } else if (callback_info->ret == NA_CANCELED) {
+    } else if (na_ret == NA_CANCELED) {
         HG_CHECK_SUBSYS_WARNING(bulk,
             hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_COMPLETED,
             "Operation was completed");
@@ -2409,17 +4282,9 @@ hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
 
         /* Keep first non-success ret status */
         hg_atomic_cas32(&hg_bulk_op_id->ret_status, (int32_t) HG_SUCCESS,
-            (int32_t) callback_info->ret);
-        HG_LOG_ERROR("NA callback returned error (%s)",
-            NA_Error_to_string(callback_info->ret));
-    }
-
-    /* When all NA transfers that correspond to the bulk operation complete,
-     * complete the bulk operation. */
-    if ((uint32_t) hg_atomic_incr32(&hg_bulk_op_id->op_completed_count) ==
-        hg_bulk_op_id->op_count) {
-        hg_bulk_complete(hg_bulk_op_id,
-            (hg_return_t) hg_atomic_get32(&hg_bulk_op_id->ret_status), false);
+            (int32_t) na_ret);
+        HG_LOG_ERROR(
+            "NA callback returned error (%s)", NA_Error_to_string(na_ret));
     }
 }
 
@@ -2431,6 +4296,12 @@ hg_bulk_complete(
     /* Mark op id as completed */
     hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
 
+    /* Stripes are not placed into the completion queue */
+    if (hg_bulk_op_id->parent) {
+        hg_bulk_stripe_complete(hg_bulk_op_id, ret);
+        return;
+    }
+
     /* Forward status to callback */
     hg_bulk_op_id->callback_info.ret = ret;
 
@@ -2441,6 +4312,32 @@ hg_bulk_complete(
         &hg_bulk_op_id->hg_completion_entry, self_notify);
 }
 
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_stripe_complete(struct hg_bulk_op_id *hg_bulk_op_id, hg_return_t ret)
+{
+    struct hg_bulk_op_id *parent = hg_bulk_op_id->parent;
+
+    /* Keep first non-success ret status */
+    if (ret != HG_SUCCESS) {
+        if (ret != HG_CANCELED)
+            hg_atomic_or32(&parent->status, HG_BULK_OP_ERRORED);
+        hg_atomic_cas32(
+            &parent->ret_status, (int32_t) HG_SUCCESS, (int32_t) ret);
+    }
+
+    /* Release handles, op ID is kept until parent is released */
+    (void) hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.origin_handle);
+    (void) hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.local_handle);
+    hg_bulk_op_destroy(hg_bulk_op_id);
+
+    /* Parent may complete on a different context, always notify */
+    if ((uint32_t) hg_atomic_incr32(&parent->op_completed_count) ==
+        parent->op_count)
+        hg_bulk_complete(parent,
+            (hg_return_t) hg_atomic_get32(&parent->ret_status), true);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_bulk_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
@@ -2461,6 +4358,17 @@ hg_bulk_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
         HG_BULK_OP_CANCELED)
         return HG_SUCCESS;
 
+    /* Cancel stripes, operation completes once all stripes complete */
+    if (hg_bulk_op_id->stripe_count > 0) {
+        for (i = 0; i < hg_bulk_op_id->stripe_count; i++) {
+            ret = hg_bulk_cancel(hg_bulk_op_id->stripes[i]);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                bulk, error, ret, "Could not cancel stripe");
+        }
+
+        return HG_SUCCESS;
+    }
+
 #ifdef NA_HAS_SM
     if (hg_bulk_op_id->na_class ==
         hg_bulk_op_id->core_context->core_class->na_sm_class)
@@ -2485,20 +4393,39 @@ error:
 }
 
 /*---------------------------------------------------------------------------*/
-void
-hg_bulk_trigger_entry(struct hg_bulk_op_id *hg_bulk_op_id)
+bool
+hg_bulk_trigger_entry(
+    struct hg_bulk_op_id *hg_bulk_op_id, struct hg_completion_cb_info *cb_info_p)
 {
+    bool ret = false;
+
     /* Execute callback */
-    if (hg_bulk_op_id->callback)
-        hg_bulk_op_id->callback(&hg_bulk_op_id->callback_info);
+    if (hg_bulk_op_id->callback) {
+        if (cb_info_p == NULL)
+            hg_bulk_op_id->callback(&hg_bulk_op_id->callback_info);
+        else {
+            /* Defer callback execution to caller */
+            cb_info_p->callback.bulk = hg_bulk_op_id->callback;
+            cb_info_p->info.bulk = hg_bulk_op_id->callback_info;
+            cb_info_p->op_type = HG_BULK;
+            ret = true;
+        }
+    }
 
-    /* Decrement ref_count */
-    (void) hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.origin_handle);
-    (void) hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.local_handle);
+    /* Decrement ref_count, references are released by caller once callback
+     * info has been processed */
+    if (!ret) {
+        (void) hg_bulk_free(
+            hg_bulk_op_id->callback_info.info.bulk.origin_handle);
+        (void) hg_bulk_free(
+            hg_bulk_op_id->callback_info.info.bulk.local_handle);
+    }
 
     /* Release bulk op ID (can be released after callback execution since
      * op IDs are managed internally) */
     hg_bulk_op_destroy(hg_bulk_op_id);
+
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2569,6 +4496,11 @@ HG_Bulk_create_attr(hg_class_t *hg_class, uint32_t count, void **buf_ptrs,
             HG_GOTO_SUBSYS_ERROR(
                 bulk, error, ret, HG_INVALID_ARG, "Unrecognized handle flag");
     }
+    HG_CHECK_SUBSYS_ERROR(bulk, attrs->shared && buf_ptrs != NULL, error, ret,
+        HG_INVALID_ARG, "Shared attribute can only be used to allocate memory");
+    HG_CHECK_SUBSYS_ERROR(bulk,
+        attrs->shared && attrs->mem_type != HG_MEM_TYPE_HOST, error, ret,
+        HG_INVALID_ARG, "Shared attribute requires host memory");
 
     HG_LOG_SUBSYS_DEBUG(
         bulk, "Creating new bulk handle with %u segment(s)", count);
@@ -2623,6 +4555,35 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_cache_invalidate(hg_class_t *hg_class, void *base, hg_size_t len)
+{
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(
+        bulk, hg_class == NULL, error, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_SUBSYS_ERROR(bulk, len > UINTPTR_MAX - (uintptr_t) base, error,
+        ret, HG_OVERFLOW, "Invalid memory range");
+
+    hg_bulk_reg_cache = hg_core_bulk_get_reg_cache(hg_class->core_class);
+    if (hg_bulk_reg_cache == NULL || len == 0)
+        return HG_SUCCESS;
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Invalidating cached registrations of range [%p, %p)", base,
+        (void *) ((char *) base + len));
+
+    hg_bulk_reg_cache_invalidate(hg_bulk_reg_cache, (uintptr_t) base,
+        (uintptr_t) base + (uintptr_t) len);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Bulk_bind(hg_bulk_t handle, hg_context_t *context)
@@ -2698,6 +4659,63 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_access_origin(hg_addr_t origin_addr, hg_bulk_t origin_handle,
+    hg_size_t offset, hg_size_t size, uint8_t flags, uint32_t max_count,
+    void **buf_ptrs, hg_size_t *buf_sizes, uint32_t *actual_count)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    uint8_t origin_flags;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_origin == NULL, error, ret,
+        HG_INVALID_ARG, "NULL origin handle passed");
+    HG_CHECK_SUBSYS_ERROR(bulk, origin_addr == HG_ADDR_NULL, error, ret,
+        HG_INVALID_ARG, "NULL origin addr");
+    HG_CHECK_SUBSYS_ERROR(bulk,
+        (offset + size) > hg_bulk_origin->desc.info.len, error, ret,
+        HG_INVALID_ARG,
+        "Exceeding size of memory exposed by origin handle (%" PRIu64
+        " + %" PRIu64 " > %" PRIu64 ")",
+        offset, size, hg_bulk_origin->desc.info.len);
+
+    /* Requested access must be permitted by origin */
+    origin_flags = hg_bulk_origin->desc.info.flags;
+    HG_CHECK_SUBSYS_ERROR(bulk,
+        !(flags & HG_BULK_READWRITE) ||
+            (flags & HG_BULK_READWRITE & ~origin_flags),
+        error, ret, HG_PERMISSION,
+        "Invalid permission flags for access (origin=0x%x, requested=0x%x)",
+        origin_flags, flags);
+
+    /* Segments of origin can only be aliased if they point to host memory
+     * of this process, eager data is a local copy that can only be read */
+    if (hg_bulk_origin->attrs.mem_type != HG_MEM_TYPE_HOST ||
+        !(HG_Core_addr_is_self((hg_core_addr_t) origin_addr) ||
+            ((origin_flags & HG_BULK_EAGER) &&
+                !(flags & HG_BULK_WRITE_ONLY)))) {
+        HG_LOG_SUBSYS_DEBUG(bulk,
+            "Memory of bulk handle (%p) cannot be accessed from origin",
+            (void *) origin_handle);
+        return HG_OPNOTSUPPORTED;
+    }
+
+    if (!size || !max_count)
+        return HG_SUCCESS;
+
+    HG_LOG_SUBSYS_DEBUG(
+        bulk, "Accessing origin bulk handle (%p)", (void *) origin_handle);
+
+    hg_bulk_access(hg_bulk_origin, offset, size, flags, max_count, buf_ptrs,
+        buf_sizes, actual_count);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_size_t
 HG_Bulk_get_serialize_size(hg_bulk_t handle, unsigned long flags)
@@ -2822,7 +4840,7 @@ HG_Bulk_transfer(hg_context_t *context, hg_cb_t callback, void *arg,
     /* Do bulk transfer */
     ret = hg_bulk_transfer(context->core_context, callback, arg, op,
         (hg_core_addr_t) origin_addr, 0, hg_bulk_origin, origin_offset,
-        hg_bulk_local, local_offset, size, op_id);
+        hg_bulk_local, local_offset, size, NULL, op_id);
     HG_CHECK_SUBSYS_HG_ERROR(
         bulk, error, ret, "Could not start transfer of bulk data");
 
@@ -2881,7 +4899,7 @@ HG_Bulk_bind_transfer(hg_context_t *context, hg_cb_t callback, void *arg,
     /* Do bulk transfer */
     ret = hg_bulk_transfer(context->core_context, callback, arg, op,
         hg_bulk_origin->addr, hg_bulk_origin->context_id, hg_bulk_origin,
-        origin_offset, hg_bulk_local, local_offset, size, op_id);
+        origin_offset, hg_bulk_local, local_offset, size, NULL, op_id);
     HG_CHECK_SUBSYS_HG_ERROR(
         bulk, error, ret, "Could not start transfer of bulk data");
 
@@ -2944,7 +4962,7 @@ HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
     /* Do bulk transfer */
     ret = hg_bulk_transfer(context->core_context, callback, arg, op,
         (hg_core_addr_t) origin_addr, origin_id, hg_bulk_origin, origin_offset,
-        hg_bulk_local, local_offset, size, op_id);
+        hg_bulk_local, local_offset, size, NULL, op_id);
     HG_CHECK_SUBSYS_HG_ERROR(
         bulk, error, ret, "Could not start transfer of bulk data");
 
@@ -2954,6 +4972,154 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_transfer_striped(hg_context_t **contexts, unsigned int context_count,
+    hg_cb_t callback, void *arg, hg_bulk_op_t op, hg_addr_t origin_addr,
+    hg_bulk_t origin_handle, hg_size_t origin_offset, hg_bulk_t local_handle,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    hg_return_t ret;
+    unsigned int i;
+
+    HG_CHECK_SUBSYS_ERROR(bulk, contexts == NULL || context_count == 0, error,
+        ret, HG_INVALID_ARG, "NULL HG contexts");
+    for (i = 0; i < context_count; i++) {
+        HG_CHECK_SUBSYS_ERROR(bulk, contexts[i] == NULL, error, ret,
+            HG_INVALID_ARG, "NULL HG context");
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            contexts[i]->core_context->core_class !=
+                contexts[0]->core_context->core_class,
+            error, ret, HG_INVALID_ARG,
+            "Contexts passed belong to different classes");
+    }
+
+    /* Origin handle sanity checks */
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_origin == NULL, error, ret,
+        HG_INVALID_ARG, "NULL origin handle passed");
+    HG_CHECK_SUBSYS_ERROR(bulk,
+        (origin_offset + size) > hg_bulk_origin->desc.info.len, error, ret,
+        HG_INVALID_ARG,
+        "Exceeding size of memory exposed by origin handle (%" PRIu64
+        " + %" PRIu64 " > %" PRIu64 ")",
+        origin_offset, size, hg_bulk_origin->desc.info.len);
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_origin->addr != HG_CORE_ADDR_NULL,
+        error, ret, HG_INVALID_ARG,
+        "Address information embedded into origin_handle, use "
+        "HG_Bulk_bind_transfer() instead");
+
+    /* Origin addr check */
+    HG_CHECK_SUBSYS_ERROR(bulk, origin_addr == HG_ADDR_NULL, error, ret,
+        HG_INVALID_ARG, "NULL origin addr");
+
+    /* Local handle sanity checks */
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_local == NULL, error, ret,
+        HG_INVALID_ARG, "NULL local handle passed");
+    HG_CHECK_SUBSYS_ERROR(bulk,
+        (local_offset + size) > hg_bulk_local->desc.info.len, error, ret,
+        HG_INVALID_ARG,
+        "Exceeding size of memory exposed by local handle (%" PRIu64
+        " + %" PRIu64 " > %" PRIu64 ")",
+        local_offset, size, hg_bulk_local->desc.info.len);
+
+    /* Check permission flags */
+    HG_BULK_CHECK_FLAGS(op, hg_bulk_origin->desc.info.flags,
+        hg_bulk_local->desc.info.flags, error, ret);
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Transferring data between bulk handle (%p) and bulk handle (%p) "
+        "over %u context(s)",
+        (void *) hg_bulk_origin, (void *) hg_bulk_local, context_count);
+
+    /* Do bulk transfer */
+    ret = hg_bulk_transfer_striped(contexts, context_count, callback, arg, op,
+        (hg_core_addr_t) origin_addr, hg_bulk_origin, origin_offset,
+        hg_bulk_local, local_offset, size, op_id);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        bulk, error, ret, "Could not start striped transfer of bulk data");
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_transfer_multi(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, const struct hg_bulk_origin_desc *origins,
+    uint32_t origin_count, hg_bulk_t local_handle, hg_size_t local_offset,
+    hg_op_id_t *op_id)
+{
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    hg_size_t size = 0;
+    hg_return_t ret;
+    uint32_t i;
+
+    HG_CHECK_SUBSYS_ERROR(
+        bulk, context == NULL, error, ret, HG_INVALID_ARG, "NULL HG context");
+    HG_CHECK_SUBSYS_ERROR(bulk, origins == NULL || origin_count == 0, error,
+        ret, HG_INVALID_ARG, "NULL origins");
+
+    /* Local handle sanity checks */
+    HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_local == NULL, error, ret,
+        HG_INVALID_ARG, "NULL local handle passed");
+
+    /* Origin sanity checks */
+    for (i = 0; i < origin_count; i++) {
+        const struct hg_bulk *hg_bulk_origin =
+            (const struct hg_bulk *) origins[i].handle;
+
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_origin == NULL, error, ret,
+            HG_INVALID_ARG, "NULL origin handle passed (origin %" PRIu32 ")",
+            i);
+        HG_CHECK_SUBSYS_ERROR(bulk,
+            (origins[i].offset + origins[i].size) >
+                hg_bulk_origin->desc.info.len,
+            error, ret, HG_INVALID_ARG,
+            "Exceeding size of memory exposed by origin handle (%" PRIu64
+            " + %" PRIu64 " > %" PRIu64 ")",
+            origins[i].offset, origins[i].size, hg_bulk_origin->desc.info.len);
+        HG_CHECK_SUBSYS_ERROR(bulk, hg_bulk_origin->addr != HG_CORE_ADDR_NULL,
+            error, ret, HG_INVALID_ARG,
+            "Address information embedded into origin handle, use "
+            "HG_Bulk_bind_transfer() instead");
+        HG_CHECK_SUBSYS_ERROR(bulk, origins[i].addr == HG_ADDR_NULL, error,
+            ret, HG_INVALID_ARG, "NULL origin addr (origin %" PRIu32 ")", i);
+
+        /* Check permission flags */
+        HG_BULK_CHECK_FLAGS(op, hg_bulk_origin->desc.info.flags,
+            hg_bulk_local->desc.info.flags, error, ret);
+
+        size += origins[i].size;
+    }
+
+    HG_CHECK_SUBSYS_ERROR(bulk,
+        (local_offset + size) > hg_bulk_local->desc.info.len, error, ret,
+        HG_INVALID_ARG,
+        "Exceeding size of memory exposed by local handle (%" PRIu64
+        " + %" PRIu64 " > %" PRIu64 ")",
+        local_offset, size, hg_bulk_local->desc.info.len);
+
+    HG_LOG_SUBSYS_DEBUG(bulk,
+        "Transferring data between %" PRIu32
+        " origin(s) and bulk handle (%p)",
+        origin_count, (void *) hg_bulk_local);
+
+    /* Do bulk transfer */
+    ret = hg_bulk_transfer_multi(context->core_context, callback, arg, op,
+        origins, origin_count, hg_bulk_local, local_offset, size, op_id);
+    HG_CHECK_SUBSYS_HG_ERROR(
+        bulk, error, ret, "Could not start multi-origin transfer of bulk data");
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Bulk_cancel(hg_op_id_t op_id)
@@ -14,6 +14,14 @@
 /* Public Type and Struct Definition */
 /*************************************/
 
+/* Origin of a multi-origin transfer (see HG_Bulk_transfer_multi()) */
+struct hg_bulk_origin_desc {
+    hg_addr_t addr;   /* Abstract address of origin */
+    hg_bulk_t handle; /* Abstract bulk handle of origin */
+    hg_size_t offset; /* Offset within origin handle */
+    hg_size_t size;   /* Size of data to be transferred */
+};
+
 /*****************/
 /* Public Macros */
 /*****************/
@@ -70,7 +78,9 @@ HG_Bulk_create(hg_class_t *hg_class, uint32_t count, void **buf_ptrs,
  *                                - HG_BULK_READWRITE
  *                                - HG_BULK_READ_ONLY
  *                                - HG_BULK_WRITE_ONLY
- * \param attrs [IN]            bulk attributes
+ * \param attrs [IN]            bulk attributes, shared may be set when
+ *                              buf_ptrs is NULL to allocate host memory that
+ *                              local peers can directly map (na+sm only)
  * \param handle [OUT]          pointer to returned abstract bulk handle
  *
  * \return HG_SUCCESS or corresponding HG error code
@@ -100,6 +110,24 @@ HG_Bulk_free(hg_bulk_t handle);
 HG_PUBLIC hg_return_t
 HG_Bulk_ref_incr(hg_bulk_t handle);
 
+/**
+ * Invalidate cached registrations of memory within the range [base,
+ * base + len). When the class was initialized with a non-zero
+ * bulk_reg_cache_size, this must be called before memory that was used to
+ * create bulk handles is unmapped or freed, as registrations may otherwise be
+ * re-used for new memory mapped at the same address. Registrations of handles
+ * that are still in use are released once these handles are freed.
+ * Has no effect if registrations are not cached.
+ *
+ * \param hg_class [IN]          pointer to HG class
+ * \param base [IN]              start address of memory range
+ * \param len [IN]               size of memory range in bytes
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_cache_invalidate(hg_class_t *hg_class, void *base, hg_size_t len);
+
 /**
  * Bind an existing bulk handle to a local HG context and associate its local
  * address. This function can be used to forward and share a bulk handle
@@ -173,6 +201,38 @@ HG_Bulk_access(hg_bulk_t handle, hg_size_t offset, hg_size_t size,
     uint8_t flags, uint32_t max_count, void **buf_ptrs, hg_size_t *buf_sizes,
     uint32_t *actual_count);
 
+/**
+ * Access memory segments of an origin bulk handle, as HG_Bulk_access() does,
+ * so that data can be used in place instead of being transferred with
+ * HG_Bulk_transfer(). This is only possible if segments point to memory of
+ * the calling process, i.e., if origin_addr is self, which is the case for
+ * RPCs forwarded to self, or if data was embedded into the RPC as eager data,
+ * in which case access can only be read-only. HG_OPNOTSUPPORTED is returned
+ * otherwise and data must then be transferred.
+ * \remark Pointers returned alias the memory of the origin, which must only
+ * be accessed while the origin expects a transfer to take place (e.g., until
+ * the RPC is responded to), and writes are directly visible to the origin.
+ *
+ * \param origin_addr [IN]       abstract address of origin
+ * \param origin_handle [IN]     abstract bulk handle
+ * \param offset [IN]            bulk offset
+ * \param size [IN]              bulk size
+ * \param flags [IN]             permission flag:
+ *                                 - HG_BULK_READWRITE
+ *                                 - HG_BULK_READ_ONLY
+ *                                 - HG_BULK_WRITE_ONLY
+ * \param max_count [IN]         maximum number of segments to be returned
+ * \param buf_ptrs [IN/OUT]      array of buffer pointers
+ * \param buf_sizes [IN/OUT]     array of buffer sizes
+ * \param actual_count [OUT]     actual number of segments returned
+ *
+ * \return HG_SUCCESS, HG_OPNOTSUPPORTED or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_access_origin(hg_addr_t origin_addr, hg_bulk_t origin_handle,
+    hg_size_t offset, hg_size_t size, uint8_t flags, uint32_t max_count,
+    void **buf_ptrs, hg_size_t *buf_sizes, uint32_t *actual_count);
+
 /**
  * Get total size of data abstracted by bulk handle.
  *
@@ -326,6 +386,70 @@ HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
     hg_bulk_t origin_handle, hg_size_t origin_offset, hg_bulk_t local_handle,
     hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id);
 
+/**
+ * Transfer data to/from origin using abstract bulk handles and explicit origin
+ * address information, splitting the transfer into stripes that are issued
+ * over multiple contexts of the same class. This allows a single transfer to
+ * make use of the NA resources of each context (e.g., separate endpoints or
+ * network interfaces) concurrently. Progress must be made on all the contexts
+ * that are passed. After all stripes complete, user callback is placed into
+ * the completion queue of the first context and can be triggered using
+ * HG_Trigger(). Canceling the returned operation ID cancels all stripes.
+ *
+ * \param contexts [IN]         array of pointers to HG contexts
+ * \param context_count [IN]    number of contexts
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param op [IN]               transfer operation:
+ *                                  - HG_BULK_PUSH
+ *                                  - HG_BULK_PULL
+ * \param origin_addr [IN]      abstract address of origin
+ * \param origin_handle [IN]    abstract bulk handle
+ * \param origin_offset [IN]    offset
+ * \param local_handle [IN]     abstract bulk handle
+ * \param local_offset [IN]     offset
+ * \param size [IN]             size of data to be transferred
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_transfer_striped(hg_context_t **contexts, unsigned int context_count,
+    hg_cb_t callback, void *arg, hg_bulk_op_t op, hg_addr_t origin_addr,
+    hg_bulk_t origin_handle, hg_size_t origin_offset, hg_bulk_t local_handle,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id);
+
+/**
+ * Transfer data between multiple origins and a single local handle using
+ * explicit origin address information (e.g., to gather data from multiple
+ * peers into one buffer or to scatter one buffer to multiple peers). Data of
+ * each origin is packed in order into the local handle, starting at
+ * local_offset. Transfers are all posted at once and user callback is placed
+ * into the completion queue once all of them complete. Callback info does not
+ * report any origin handle (i.e., origin_handle is HG_BULK_NULL) and size is
+ * the total size transferred. Canceling the returned operation ID cancels all
+ * transfers.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param op [IN]               transfer operation:
+ *                                  - HG_BULK_PUSH
+ *                                  - HG_BULK_PULL
+ * \param origins [IN]          array of origin descriptors
+ * \param origin_count [IN]     number of origins
+ * \param local_handle [IN]     abstract bulk handle
+ * \param local_offset [IN]     offset
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_transfer_multi(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, const struct hg_bulk_origin_desc *origins,
+    uint32_t origin_count, hg_bulk_t local_handle, hg_size_t local_offset,
+    hg_op_id_t *op_id);
+
 /**
  * Cancel an ongoing operation.
  *
@@ -11,7 +11,6 @@
 #include "mercury_atomic_queue.h"
 #include "mercury_error.h"
 #include "mercury_event.h"
-#include "mercury_hash_table.h"
 #include "mercury_mem.h"
 #include "mercury_param.h"
 #include "mercury_poll.h"
@@ -40,19 +39,63 @@
 /* Size of comletion queue used for holding completed requests */
 #define HG_CORE_ATOMIC_QUEUE_SIZE (1024)
 
+/* Max number of completion queue segments (each segment doubles in size) */
+#define HG_CORE_ATOMIC_QUEUE_SEGMENT_MAX (16)
+
+/* Max number of completion entries dequeued at once by batched trigger */
+#define HG_CORE_TRIGGER_BATCH_MAX (64)
+
 /* Pre-posted requests and op IDs */
 #define HG_CORE_POST_INIT          (512)
 #define HG_CORE_POST_INCR          (512)
 #define HG_CORE_BULK_OP_INIT_COUNT (256)
 
+/* Max number of chunks in flight for chunked bulk transfers */
+#define HG_CORE_BULK_CHUNK_WINDOW (8)
+
+/* Handle pool is grown ahead of demand once fewer than min(incr_count / 4,
+ * init_count / 2) handles remain available and shrunk by one batch after each
+ * idle period (ms) */
+#define HG_CORE_POST_LOW_WATERMARK (4)
+#define HG_CORE_POST_IDLE_TIME     (10000)
+
+/* Handle pool growth state: none, requested from callbacks or in progress */
+#define HG_CORE_POOL_GROW_NONE      (0)
+#define HG_CORE_POOL_GROW_REQUESTED (1)
+#define HG_CORE_POOL_GROW_POSTED    (2)
+
 /* Number of multi-recv buffer pre-posted */
 #define HG_CORE_MULTI_RECV_OP_COUNT (4)
 
+/* Multi-recv buffers added under load (up to that factor of the initial count)
+ * are released once the initial number of buffers is posted again */
+#define HG_CORE_MULTI_RECV_OP_GROW (4)
+
+/* Multi-recv payload state of handles: in use, waiting to be processed (can be
+ * copied out to release its buffer) or being copied out */
+#define HG_CORE_MULTI_RECV_BUSY    (0)
+#define HG_CORE_MULTI_RECV_IDLE    (1)
+#define HG_CORE_MULTI_RECV_RECLAIM (2)
+
+/* Max number of handles collected at once for their payload to be copied out
+ * after the handle list lock is released */
+#define HG_CORE_MULTI_RECV_RECLAIM_MAX (16)
+
 /* Timeout on finalize */
 #define HG_CORE_CLEANUP_TIMEOUT (5000)
 
-/* Max number of events for progress */
-#define HG_CORE_MAX_EVENTS (1)
+/* Initial number of slots in RPC map and marker for removed entries */
+#define HG_CORE_MAP_INIT_SIZE (64)
+#define HG_CORE_MAP_REMOVED   ((int64_t) -1)
+
+/* Max number of events for progress (loopback, SM and NA) */
+#define HG_CORE_MAX_EVENTS (3)
+
+/* Adaptive polling: max busy-poll window and max inter-arrival time
+ * accounted for (us), weight of new samples in moving average is 1/8 */
+#define HG_CORE_ADAPTIVE_POLL_MAX_US      (200)
+#define HG_CORE_ADAPTIVE_POLL_INTERVAL_US (1000)
+#define HG_CORE_ADAPTIVE_POLL_WEIGHT      (8)
 
 /* 32-bit lock value for serial progress */
 #define HG_CORE_PROGRESS_LOCK (0x80000000)
@@ -138,18 +181,45 @@ struct hg_core_init_info {
     uint32_t request_post_incr;         /* Increment request count */
     uint32_t multi_recv_op_max;         /* Multi-recv op max */
     uint32_t multi_recv_copy_threshold; /* Copy threshold */
+    uint32_t completion_queue_size;     /* Completion queue init size */
+    size_t bulk_chunk_size;             /* Bulk chunk size */
+    uint32_t bulk_chunk_window;         /* Bulk chunks in flight */
+    size_t bulk_nt_copy_threshold;      /* Bulk non-temporal copy threshold */
     hg_checksum_level_t checksum_level; /* Checksum level */
     uint8_t progress_mode;              /* Progress mode */
+    bool post_thread;                   /* Extend pools from a thread */
     bool loopback;                      /* Use loopback capability */
     bool na_ext_init;                   /* NA externally initialized */
     bool multi_recv;                    /* Use multi-recv capability */
     bool listen;                        /* Listening on incoming RPC requests */
 };
 
-/* RPC map */
+/* RPC map table (open addressing, entries are published atomically) */
+struct hg_core_map_table {
+    struct hg_core_map_table *next; /* Next retired table */
+    unsigned int size;              /* Number of slots (power of 2) */
+    hg_atomic_int64_t entries[];    /* RPC info pointers */
+};
+
+/* RPC map value (RPC info must remain first) */
+struct hg_core_map_value {
+    struct hg_core_rpc_info rpc_info; /* RPC info */
+    struct hg_core_map_value *next;   /* Next removed value */
+};
+
+/* RPC map (lookups do not lock, updates are serialized and reclaim memory
+ * once lookups of the previous epoch have completed) */
 struct hg_core_map {
-    hg_thread_rwlock_t lock; /* Map RW lock */
-    hg_hash_table_t *map;    /* Map */
+    hg_thread_mutex_t lock;                 /* Update lock */
+    hg_atomic_int64_t table;                /* Current table */
+    hg_atomic_int32_t epoch;                /* Current lookup epoch */
+    hg_atomic_int32_t readers[2];           /* Lookups in progress */
+    struct hg_core_map_table *retired;      /* Tables replaced in epoch */
+    struct hg_core_map_value *removed;      /* Values removed in epoch */
+    struct hg_core_map_table *retired_prev; /* Tables of previous epoch */
+    struct hg_core_map_value *removed_prev; /* Values of previous epoch */
+    unsigned int count;                     /* Number of entries */
+    unsigned int used;                      /* Used slots (inc. removed) */
 };
 
 /* More data callbacks */
@@ -171,6 +241,17 @@ struct hg_core_counters {
     hg_atomic_int64_t *rpc_multi_recv_copy_count; /* RPCs requests received that
                                                      required a copy */
     hg_atomic_int64_t *bulk_count;                /* Bulk count */
+    hg_atomic_int64_t *poll_wake_count;  /* Wake-ups from poll with events */
+    hg_atomic_int64_t *poll_event_count; /* Events processed from poll */
+    hg_atomic_int64_t *poll_spin_count;  /* Progress while busy-polling */
+    hg_atomic_int64_t *handle_pool_count;        /* Handles in pools */
+    hg_atomic_int64_t *handle_pool_grow_count;   /* Pool extensions */
+    hg_atomic_int64_t *handle_pool_shrink_count; /* Pool shrinks */
+    hg_atomic_int64_t *rpc_multi_recv_starved_count; /* No multi-recv posted */
+    hg_atomic_int64_t *rpc_multi_recv_nocopy_count;  /* Copies skipped */
+    hg_atomic_int64_t *bulk_na_op_pool_hit_count;    /* Pooled NA op IDs */
+    hg_atomic_int64_t *bulk_reg_cache_hit_count;     /* Cached registrations */
+    hg_atomic_int64_t *bulk_reg_cache_miss_count;    /* New registrations */
 };
 
 /* HG class */
@@ -183,6 +264,10 @@ struct hg_core_private_class {
     struct hg_core_map rpc_map;               /* RPC Map */
     struct hg_core_more_data_cb more_data_cb; /* More data callbacks */
     na_tag_t request_max_tag;                 /* Max value for tag */
+    na_tag_t request_tag_range;               /* Tags per range (0 if none) */
+    uint8_t request_tag_range_count;          /* Number of context ranges */
+    hg_thread_pool_t *grow_thread_pool;       /* Extends pools of handles */
+    struct hg_bulk_reg_cache *bulk_reg_cache; /* Bulk registration cache */
 #if defined(HG_HAS_DEBUG) && !defined(_WIN32)
     struct hg_core_counters counters; /* Diag counters */
 #endif
@@ -207,6 +292,15 @@ struct hg_core_completion_queue {
     hg_thread_cond_t cond;                    /* Completion queue cond */
     hg_thread_mutex_t mutex;                  /* Completion queue mutex */
     hg_atomic_int32_t count;                  /* Number of entries */
+    hg_atomic_int32_t waiters;                /* Number of waiting threads */
+};
+
+/* Growable completion queue made of atomic queue segments */
+struct hg_core_atomic_queue {
+    hg_atomic_int64_t
+        segments[HG_CORE_ATOMIC_QUEUE_SEGMENT_MAX]; /* Queue segments */
+    hg_atomic_int32_t segment_count;                /* Number of segments */
+    unsigned int size;                              /* First segment size */
 };
 
 /* List of handles */
@@ -229,6 +323,12 @@ struct hg_core_loopback_notify {
     int event;                     /* Loopback event */
 };
 
+/* Adaptive polling (only updated by thread making progress) */
+struct hg_core_adaptive_poll {
+    hg_time_t last_event; /* Time of last progress event */
+    double interval_avg;  /* Moving average of inter-arrival times (s) */
+};
+
 /* Multi-recv buffer context */
 struct hg_core_multi_recv_op {
     struct hg_core_private_context *context; /* Context */
@@ -240,6 +340,7 @@ struct hg_core_multi_recv_op {
     hg_atomic_int32_t last;                  /* Buffer is consumed */
     hg_atomic_int32_t ref_count; /* Number of handles using that buffer */
     hg_atomic_int32_t op_count;  /* Total number of ops completed */
+    hg_atomic_int32_t allocated; /* Buffer is allocated */
 };
 
 /* Pool of handles */
@@ -251,8 +352,15 @@ struct hg_core_handle_pool {
     na_class_t *na_class;                    /* NA class */
     na_context_t *na_context;                /* NA context */
     struct hg_core_handle_list pending_list; /* Pending handle list */
-    unsigned int count;                      /* Number of handles */
+    struct hg_thread_work grow_work;         /* Work to extend pool */
+    hg_atomic_int64_t idle_start;            /* Start of idle period (ms) */
+    hg_atomic_int32_t count;                 /* Number of handles */
+    hg_atomic_int32_t pending_count;         /* Number of pending handles */
+    hg_atomic_int32_t grow;                  /* Extend pool on next progress */
+    hg_atomic_int32_t destroyed;             /* Freed once count reaches 0 */
+    unsigned int init_count;                 /* Initial count */
     unsigned int incr_count;                 /* Incremement count */
+    int32_t low_watermark;                   /* Extend pool below that */
     bool extending;                          /* When extending the pool */
 };
 
@@ -272,8 +380,9 @@ struct hg_core_private_context {
     struct hg_core_progress_multi progress_multi; /* Progress multi */
 #endif
     struct hg_core_completion_queue backfill_queue; /* Backfill queue */
-    struct hg_atomic_queue *completion_queue;       /* Default queue */
+    struct hg_core_atomic_queue completion_queue;   /* Default queue */
     struct hg_core_loopback_notify loopback_notify; /* Loopback notification */
+    struct hg_core_adaptive_poll adaptive_poll;     /* Adaptive polling */
     struct hg_core_handle_list user_list;           /* Created handle list */
     struct hg_core_handle_list internal_list;       /* Created handle list */
     struct hg_core_handle_pool *handle_pool;        /* Pool of handles */
@@ -281,6 +390,7 @@ struct hg_core_private_context {
     struct hg_core_handle_pool *sm_handle_pool; /* Pool of SM handles */
 #endif
     struct hg_core_multi_recv_op *multi_recv_ops;     /* Multi-recv ops */
+    unsigned int multi_recv_op_capacity;              /* Max multi-recv ops */
     struct hg_core_handle_create_cb handle_create_cb; /* Handle create cb */
     struct hg_bulk_op_pool *hg_bulk_op_pool;          /* Pool of op IDs */
     struct hg_poll_set *poll_set;                     /* Poll set */
@@ -288,10 +398,15 @@ struct hg_core_private_context {
 #ifdef NA_HAS_SM
     int na_sm_event; /* NA SM event */
 #endif
-    hg_atomic_int32_t multi_recv_op_count; /* Number of multi-recv posted */
-    hg_atomic_int32_t n_handles;           /* Number of handles */
-    hg_atomic_int32_t unposting;           /* Prevent re-posting handles */
-    bool posted;                           /* Posted receives on context */
+    na_tag_t request_tag_base;              /* First tag of context range */
+    na_tag_t request_tag_mask;              /* Tag range mask (0 if shared) */
+    hg_atomic_int32_t *request_tag_p;       /* Counter used for tag range */
+    hg_atomic_int32_t request_tag;          /* Current context RPC tag */
+    hg_atomic_int32_t multi_recv_op_count;  /* Number of multi-recv posted */
+    hg_atomic_int32_t multi_recv_replenish; /* Multi-recv buffers needed */
+    hg_atomic_int32_t n_handles;            /* Number of handles */
+    hg_atomic_int32_t unposting;            /* Prevent re-posting handles */
+    bool posted;                            /* Posted receives on context */
 };
 
 /* HG addr */
@@ -321,7 +436,8 @@ struct hg_core_ops {
         struct hg_core_private_handle *hg_core_handle); /* forward */
     hg_return_t (*respond)(struct hg_core_private_handle *hg_core_handle,
         hg_return_t ret_code); /* respond */
-    void (*trigger)(struct hg_core_private_handle *hg_core_handle); /* trigger*/
+    bool (*trigger)(struct hg_core_private_handle *hg_core_handle,
+        struct hg_completion_cb_info *cb_info_p); /* trigger */
 };
 
 /* HG core handle */
@@ -348,7 +464,9 @@ struct hg_core_private_handle {
     na_op_id_t *na_send_op_id;      /* Operation ID for send */
     na_op_id_t *na_recv_op_id;      /* Operation ID for recv */
     na_op_id_t *na_ack_op_id;       /* Operation ID for ack */
+    struct hg_core_handle_pool *handle_pool;     /* Pool handle belongs to */
     struct hg_core_multi_recv_op *multi_recv_op; /* Multi-recv operation */
+    hg_atomic_int32_t multi_recv_state;          /* Multi-recv payload state */
     void *in_buf_storage;                        /* Storage input buffer */
     size_t in_buf_storage_size;                  /* Storage input buffer size */
     na_tag_t tag;                       /* Tag used for request and response */
@@ -410,7 +528,7 @@ hg_core_counters_init(struct hg_core_counters *hg_core_counters);
  * Generate a new tag.
  */
 static HG_INLINE na_tag_t
-hg_core_gen_request_tag(struct hg_core_private_class *hg_core_class);
+hg_core_gen_request_tag(struct hg_core_private_context *context);
 
 /**
  * Proc request header and verify it if decoded.
@@ -503,6 +621,58 @@ static hg_return_t
 hg_core_context_multi_recv_unpost(struct hg_core_private_context *context,
     na_class_t *na_class, na_context_t *na_context);
 
+/**
+ * Copy out pending payloads and add buffers when few remain posted.
+ */
+static hg_return_t
+hg_core_context_multi_recv_replenish(struct hg_core_private_context *context);
+
+/**
+ * Allocate multi-recv buffer and operation ID.
+ */
+static hg_return_t
+hg_core_multi_recv_op_alloc(
+    struct hg_core_multi_recv_op *multi_recv_op, na_class_t *na_class);
+
+/**
+ * Free multi-recv buffer and operation ID.
+ */
+static void
+hg_core_multi_recv_op_free(
+    struct hg_core_multi_recv_op *multi_recv_op, na_class_t *na_class);
+
+/**
+ * Release handle reference to multi-recv buffer and repost it if consumed.
+ */
+static hg_return_t
+hg_core_multi_recv_op_release(struct hg_core_multi_recv_op *multi_recv_op,
+    na_class_t *na_class, na_context_t *na_context);
+
+/**
+ * Copy multi-recv payload to handle storage and release its buffer.
+ */
+static hg_return_t
+hg_core_multi_recv_copy(struct hg_core_private_handle *hg_core_handle);
+
+/**
+ * Mark handle not yet processed whose buffer is no longer posted as being
+ * reclaimed and take a reference to it.
+ */
+static bool
+hg_core_multi_recv_reclaim_get(struct hg_core_private_handle *hg_core_handle);
+
+/**
+ * Copy out payload of handle to release its buffer and release reference.
+ */
+static hg_return_t
+hg_core_multi_recv_reclaim(struct hg_core_private_handle *hg_core_handle);
+
+/**
+ * Prevent payload from being copied out once handle is used.
+ */
+static HG_INLINE void
+hg_core_multi_recv_claim(struct hg_core_private_handle *hg_core_handle);
+
 /**
  * Check list of handles not freed.
  */
@@ -532,10 +702,10 @@ static void
 hg_core_handle_pool_destroy(struct hg_core_handle_pool *hg_core_handle_pool);
 
 /**
- * Pool is empty.
+ * Free pool of handles once it is destroyed and no handle remains.
  */
-static HG_INLINE bool
-hg_core_handle_pool_empty(struct hg_core_handle_pool *hg_core_handle_pool);
+static void
+hg_core_handle_pool_free(struct hg_core_handle_pool *hg_core_handle_pool);
 
 /**
  * Get handle from pool and extend pool if needed.
@@ -550,6 +720,50 @@ hg_core_handle_pool_get(struct hg_core_handle_pool *hg_core_handle_pool,
 static hg_return_t
 hg_core_handle_pool_extend(struct hg_core_handle_pool *hg_core_handle_pool);
 
+/**
+ * Extend pool of handles from class thread pool.
+ */
+static HG_THREAD_RETURN_TYPE
+hg_core_handle_pool_grow_thread(void *arg);
+
+/**
+ * Allow pool to be requested to grow again and wake up waiters.
+ */
+static void
+hg_core_handle_pool_grow_done(struct hg_core_handle_pool *hg_core_handle_pool);
+
+/**
+ * Wait for pool extension from class thread pool to complete.
+ */
+static void
+hg_core_handle_pool_grow_wait(struct hg_core_handle_pool *hg_core_handle_pool);
+
+/**
+ * Release batch of unused handles from pool.
+ */
+static hg_return_t
+hg_core_handle_pool_shrink(
+    struct hg_core_handle_pool *hg_core_handle_pool, unsigned int count);
+
+/**
+ * Extend pool if requested or shrink it after an idle period.
+ */
+static hg_return_t
+hg_core_handle_pool_check(struct hg_core_handle_pool *hg_core_handle_pool);
+
+/**
+ * Check context pools before making progress.
+ */
+static HG_INLINE hg_return_t
+hg_core_context_check_pools(struct hg_core_private_context *context);
+
+/**
+ * Remove handle from pool before freeing it.
+ */
+static HG_INLINE void
+hg_core_handle_pool_release(struct hg_core_handle_pool *hg_core_handle_pool,
+    struct hg_core_private_handle *hg_core_handle);
+
 /**
  * Create and insert new handle into pool.
  */
@@ -566,22 +780,57 @@ hg_core_handle_pool_unpost(
     struct hg_core_handle_pool *hg_core_handle_pool, unsigned int timeout_ms);
 
 /**
- * Hash map keys based on RPC ID.
+ * Initialize RPC map.
  */
-static HG_INLINE unsigned int
-hg_core_map_hash(hg_hash_table_key_t key);
+static hg_return_t
+hg_core_map_init(struct hg_core_map *hg_core_map);
+
+/**
+ * Free RPC map and its entries.
+ */
+static void
+hg_core_map_finalize(struct hg_core_map *hg_core_map);
+
+/**
+ * Allocate new table and copy entries from old table if any.
+ */
+static struct hg_core_map_table *
+hg_core_map_table_alloc(
+    unsigned int size, const struct hg_core_map_table *old_table);
+
+/**
+ * Clear removed entries that end probe sequences so that their slots can be
+ * re-used without replacing the table.
+ */
+static void
+hg_core_map_table_compact(
+    struct hg_core_map *hg_core_map, struct hg_core_map_table *table);
+
+/**
+ * Free tables and values that were retired before the previous epoch once
+ * no lookup of that epoch remains, and move to the next epoch.
+ */
+static void
+hg_core_map_reclaim(struct hg_core_map *hg_core_map);
+
+/**
+ * Free lists of retired tables and values.
+ */
+static void
+hg_core_map_retired_free(
+    struct hg_core_map_table *retired, struct hg_core_map_value *removed);
 
 /**
- * Determine if map keys are equal using RPC ID.
+ * Hash RPC ID.
  */
-static HG_INLINE int
-hg_core_map_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2);
+static HG_INLINE unsigned int
+hg_core_map_hash(hg_id_t id);
 
 /**
  * Free value in map.
  */
 static void
-hg_core_map_value_free(hg_hash_table_value_t value);
+hg_core_map_value_free(struct hg_core_rpc_info *hg_core_rpc_info);
 
 /**
  * Lookup entry for RPC ID.
@@ -910,12 +1159,74 @@ static HG_INLINE hg_return_t
 hg_core_loopback_event_get(
     struct hg_core_private_context *context, bool *notified_p);
 
+/**
+ * Initialize growable atomic completion queue.
+ */
+static hg_return_t
+hg_core_atomic_queue_init(
+    struct hg_core_atomic_queue *hg_core_atomic_queue, unsigned int size);
+
+/**
+ * Free segments of growable atomic completion queue.
+ */
+static void
+hg_core_atomic_queue_finalize(
+    struct hg_core_atomic_queue *hg_core_atomic_queue);
+
+/**
+ * Add a new segment to the queue if segment_count is still current.
+ */
+static hg_return_t
+hg_core_atomic_queue_grow(struct hg_core_atomic_queue *hg_core_atomic_queue,
+    int32_t segment_count);
+
+/**
+ * Push entry to growable atomic queue.
+ */
+static HG_INLINE hg_return_t
+hg_core_atomic_queue_push(
+    struct hg_core_atomic_queue *hg_core_atomic_queue, void *entry);
+
+/**
+ * Pop entry from growable atomic queue.
+ */
+static HG_INLINE void *
+hg_core_atomic_queue_pop(struct hg_core_atomic_queue *hg_core_atomic_queue);
+
+/**
+ * Pop up to count entries from growable atomic queue.
+ */
+static HG_INLINE unsigned int
+hg_core_atomic_queue_pop_n(struct hg_core_atomic_queue *hg_core_atomic_queue,
+    void **entries, unsigned int count);
+
+/**
+ * Get number of entries in growable atomic queue.
+ */
+static HG_INLINE unsigned int
+hg_core_atomic_queue_count(
+    const struct hg_core_atomic_queue *hg_core_atomic_queue);
+
+/**
+ * Determine whether growable atomic queue is empty.
+ */
+static HG_INLINE bool
+hg_core_atomic_queue_is_empty(
+    const struct hg_core_atomic_queue *hg_core_atomic_queue);
+
 /**
  * Get completion entry from queue.
  */
 static struct hg_completion_entry *
 hg_core_completion_get(struct hg_core_private_context *context);
 
+/**
+ * Get up to count completion entries from queue.
+ */
+static unsigned int
+hg_core_completion_get_n(struct hg_core_private_context *context,
+    struct hg_completion_entry **entries, unsigned int count);
+
 /**
  * Wait timeout_ms for new completion entry.
  */
@@ -930,10 +1241,22 @@ static HG_INLINE unsigned int
 hg_core_completion_count(const struct hg_core_private_context *context);
 
 /**
- * Trigger completion entry.
+ * Trigger completion entry. If cb_info_p is not NULL, user callback is not
+ * executed and its info is returned instead.
+ *
+ * \return true if callback info was returned
  */
-static void
-hg_core_completion_trigger(struct hg_completion_entry *hg_completion_entry);
+static bool
+hg_core_completion_trigger(struct hg_completion_entry *hg_completion_entry,
+    struct hg_completion_cb_info *cb_info_p);
+
+/**
+ * Execute core callback or return its info if cb_info_p is not NULL.
+ */
+static HG_INLINE bool
+hg_core_completion_cb(hg_core_cb_t callback,
+    const struct hg_core_cb_info *hg_core_cb_info,
+    struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Check for events on loopback and if it is safe to wait.
@@ -948,6 +1271,19 @@ static hg_return_t
 hg_core_progress_wait(
     struct hg_core_private_context *context, unsigned int timeout_ms);
 
+/**
+ * Busy-poll context for an adaptive period of at most timeout_ms.
+ */
+static hg_return_t
+hg_core_progress_spin(struct hg_core_private_context *context,
+    unsigned int timeout_ms, bool *progressed_p);
+
+/**
+ * Record progress event time for adaptive polling.
+ */
+static HG_INLINE void
+hg_core_adaptive_poll_update(struct hg_core_adaptive_poll *adaptive_poll);
+
 /**
  * Poll for timeout ms on context.
  */
@@ -1001,26 +1337,30 @@ hg_core_trigger(struct hg_core_private_context *context, unsigned int max_count,
 /**
  * Trigger callback from HG lookup op ID.
  */
-static HG_INLINE void
-hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id);
+static HG_INLINE bool
+hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id,
+    struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Trigger callback from HG core handle.
  */
-static HG_INLINE void
-hg_core_trigger_entry(struct hg_core_private_handle *hg_core_handle);
+static HG_INLINE bool
+hg_core_trigger_entry(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Trigger callback from self HG core handle.
  */
-static HG_INLINE void
-hg_core_trigger_self(struct hg_core_private_handle *hg_core_handle);
+static HG_INLINE bool
+hg_core_trigger_self(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Trigger callback from HG core handle.
  */
-static HG_INLINE void
-hg_core_trigger_na(struct hg_core_private_handle *hg_core_handle);
+static HG_INLINE bool
+hg_core_trigger_na(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Trigger RPC handler callback from HG core handle.
@@ -1031,20 +1371,23 @@ hg_core_trigger_process(struct hg_core_private_handle *hg_core_handle);
 /**
  * Trigger forward callback.
  */
-static HG_INLINE void
-hg_core_trigger_forward_cb(struct hg_core_private_handle *hg_core_handle);
+static HG_INLINE bool
+hg_core_trigger_forward_cb(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Trigger respond callback.
  */
-static HG_INLINE void
-hg_core_trigger_respond_cb(struct hg_core_private_handle *hg_core_handle);
+static HG_INLINE bool
+hg_core_trigger_respond_cb(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Wrapper for local callback execution.
  */
-static void
-hg_core_trigger_self_respond_cb(struct hg_core_private_handle *hg_core_handle);
+static bool
+hg_core_trigger_self_respond_cb(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Cancel handle.
@@ -1090,6 +1433,34 @@ hg_core_counters_init(struct hg_core_counters *hg_core_counters)
 {
     /* TODO we could revert the linked list to avoid registration in reverse
      * order */
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->bulk_reg_cache_miss_count,
+        "bulk_reg_cache_miss_count",
+        "Bulk registrations not found in registration cache");
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->bulk_reg_cache_hit_count,
+        "bulk_reg_cache_hit_count",
+        "Bulk registrations found in registration cache");
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->bulk_na_op_pool_hit_count,
+        "bulk_na_op_pool_hit_count",
+        "Multi-segment bulk transfers using only pooled NA op IDs");
+    HG_LOG_ADD_COUNTER64(hg_diag,
+        &hg_core_counters->rpc_multi_recv_nocopy_count,
+        "rpc_multi_recv_nocopy_count",
+        "RPC requests kept in multi-recv buffers past copy threshold");
+    HG_LOG_ADD_COUNTER64(hg_diag,
+        &hg_core_counters->rpc_multi_recv_starved_count,
+        "rpc_multi_recv_starved_count", "Multi-recv buffers all consumed");
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->handle_pool_shrink_count,
+        "handle_pool_shrink_count", "Handle pool shrinks after idle periods");
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->handle_pool_grow_count,
+        "handle_pool_grow_count", "Handle pool extensions");
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->handle_pool_count,
+        "handle_pool_count", "Handles currently allocated in pools");
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->poll_spin_count,
+        "poll_spin_count", "Progress made while busy-polling");
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->poll_event_count,
+        "poll_event_count", "Events processed after poll wake-ups");
+    HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->poll_wake_count,
+        "poll_wake_count", "Poll wake-ups with events");
     HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->bulk_count, "bulk_count",
         "Bulk transfers (inc. extra bulks)");
     HG_LOG_ADD_COUNTER64(hg_diag, &hg_core_counters->rpc_multi_recv_copy_count,
@@ -1113,11 +1484,19 @@ hg_core_counters_init(struct hg_core_counters *hg_core_counters)
 
 /*---------------------------------------------------------------------------*/
 static HG_INLINE na_tag_t
-hg_core_gen_request_tag(struct hg_core_private_class *hg_core_class)
+hg_core_gen_request_tag(struct hg_core_private_context *context)
 {
+    struct hg_core_private_class *hg_core_class;
     na_tag_t request_tag = 0;
 
+    /* Generate tag from context range if there is one */
+    if (context->request_tag_mask != 0)
+        return context->request_tag_base +
+               ((na_tag_t) hg_atomic_incr32(context->request_tag_p) &
+                   context->request_tag_mask);
+
     /* Compare and swap tag if reached max tag */
+    hg_core_class = HG_CORE_CONTEXT_CLASS(context);
     if (!hg_atomic_cas32(&hg_core_class->request_tag,
             (int32_t) hg_core_class->request_max_tag, 0)) {
         /* Increment tag */
@@ -1199,6 +1578,7 @@ hg_core_init(const char *na_info_string, bool na_listen, unsigned int version,
 #ifdef NA_HAS_SM
     const char *na_class_name;
 #endif
+    uint64_t request_tag_range, request_tag_range_count;
     hg_return_t ret;
     int rc;
 
@@ -1218,20 +1598,9 @@ hg_core_init(const char *na_info_string, bool na_listen, unsigned int version,
     hg_atomic_init32(&hg_core_class->n_addrs, 0);
     hg_atomic_init32(&hg_core_class->n_bulks, 0);
 
-    /* Initialize mutex */
-    rc = hg_thread_rwlock_init(&hg_core_class->rpc_map.lock);
-    HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error_free, ret, HG_NOMEM,
-        "hg_thread_rwlock_init() failed");
-
     /* Create new function map */
-    hg_core_class->rpc_map.map =
-        hg_hash_table_new(hg_core_map_hash, hg_core_map_equal);
-    HG_CHECK_SUBSYS_ERROR(cls, hg_core_class->rpc_map.map == NULL, error, ret,
-        HG_NOMEM, "Could not create RPC map");
-
-    /* Automatically free all the values with the hash map */
-    hg_hash_table_register_free_functions(
-        hg_core_class->rpc_map.map, NULL, hg_core_map_value_free);
+    ret = hg_core_map_init(&hg_core_class->rpc_map);
+    HG_CHECK_SUBSYS_HG_ERROR(cls, error_free, ret, "Could not create RPC map");
 
     /* Ensure init info is API compatible */
     if (hg_init_info_p) {
@@ -1244,10 +1613,15 @@ hg_core_init(const char *na_info_string, bool na_listen, unsigned int version,
 
         /* Get init info and overwrite defaults */
         if (HG_VERSION_GE(version, HG_VERSION(2, 4))) {
-            hg_init_info = *hg_init_info_p;
-            /* Duplicate traffic class field for now, this will be fixed in
-             * a later major version. */
+            if (HG_VERSION_GE(version, HG_VERSION(2, 5)))
+                hg_init_info = *hg_init_info_p;
+            else
+                hg_init_info_dup_2_4(&hg_init_info,
+                    (const struct hg_init_info_2_4 *) hg_init_info_p);
+            /* Duplicate traffic class and message buffer count fields for
+             * now, this will be fixed in a later major version. */
             na_init_info.traffic_class = hg_init_info.traffic_class;
+            na_init_info.msg_buf_count = hg_init_info.msg_buf_count;
         } else if (HG_VERSION_GE(version, HG_VERSION(2, 3)))
             hg_init_info_dup_2_3(&hg_init_info,
                 (const struct hg_init_info_2_3 *) hg_init_info_p);
@@ -1262,7 +1636,11 @@ hg_core_init(const char *na_info_string, bool na_listen, unsigned int version,
             ", no_loopback=%" PRIu8 ", stats=%" PRIu8 ", no_multi_recv=%" PRIu8
             ", release_input_early=%" PRIu8
             ", traffic_class=%d, no_overflow=%d, multi_recv_op_max=%u, "
-            "multi_recv_copy_threshold=%u",
+            "multi_recv_copy_threshold=%u, completion_queue_size=%u, "
+            "bulk_chunk_size=%zu, bulk_chunk_window=%u, "
+            "bulk_reg_cache_size=%zu, bulk_eager_threshold=%zu, "
+            "bulk_nt_copy_threshold=%zu, request_post_thread=%d, "
+            "msg_buf_count=%u",
             (void *) hg_init_info.na_class, hg_init_info.request_post_init,
             hg_init_info.request_post_incr, hg_init_info.auto_sm,
             hg_init_info.sm_info_string, hg_init_info.checksum_level,
@@ -1270,7 +1648,12 @@ hg_core_init(const char *na_info_string, bool na_listen, unsigned int version,
             hg_init_info.stats, hg_init_info.no_multi_recv,
             hg_init_info.release_input_early, hg_init_info.traffic_class,
             hg_init_info.no_overflow, hg_init_info.multi_recv_op_max,
-            hg_init_info.multi_recv_copy_threshold);
+            hg_init_info.multi_recv_copy_threshold,
+            hg_init_info.completion_queue_size, hg_init_info.bulk_chunk_size,
+            hg_init_info.bulk_chunk_window, hg_init_info.bulk_reg_cache_size,
+            hg_init_info.bulk_eager_threshold,
+            hg_init_info.bulk_nt_copy_threshold,
+            hg_init_info.request_post_thread, hg_init_info.msg_buf_count);
     }
 
     /* Set post init / incr / multi-recv values  */
@@ -1299,6 +1682,28 @@ hg_core_init(const char *na_info_string, bool na_listen, unsigned int version,
     hg_core_class->init_info.multi_recv_copy_threshold =
         hg_init_info.multi_recv_copy_threshold;
 
+    HG_CHECK_SUBSYS_ERROR(cls, !powerof2(hg_init_info.completion_queue_size),
+        error, ret, HG_INVALID_ARG,
+        "completion_queue_size (%u) must be a power of 2",
+        hg_init_info.completion_queue_size);
+    hg_core_class->init_info.completion_queue_size =
+        (hg_init_info.completion_queue_size == 0)
+            ? HG_CORE_ATOMIC_QUEUE_SIZE
+            : hg_init_info.completion_queue_size;
+
+    /* Bulk chunking (disabled if chunk size is 0) */
+    hg_core_class->init_info.bulk_chunk_size = hg_init_info.bulk_chunk_size;
+    hg_core_class->init_info.bulk_chunk_window =
+        (hg_init_info.bulk_chunk_window == 0) ? HG_CORE_BULK_CHUNK_WINDOW
+                                              : hg_init_info.bulk_chunk_window;
+
+    /* Non-temporal local bulk copies (disabled if threshold is 0) */
+    hg_core_class->init_info.bulk_nt_copy_threshold =
+        hg_init_info.bulk_nt_copy_threshold;
+
+    /* Extend pools of handles from progress unless a thread was requested */
+    hg_core_class->init_info.post_thread = hg_init_info.request_post_thread;
+
 #ifdef HG_HAS_CHECKSUMS
     /* Save checksum level */
     hg_core_class->init_info.checksum_level = hg_init_info.checksum_level;
@@ -1422,11 +1827,57 @@ hg_core_init(const char *na_info_string, bool na_listen, unsigned int version,
         "please turn ON NA_USE_SM in CMake options");
 #endif
 
+    /* Partition tags into one range per context ID up to max_contexts plus
+     * one range shared by contexts created past that limit. Ranges must hold
+     * at least as many tags as requests posted, otherwise all contexts fall
+     * back to a single tag counter. */
+    for (request_tag_range_count = 1;
+         request_tag_range_count <= MAX(na_init_info.max_contexts, 1);
+         request_tag_range_count <<= 1)
+        continue;
+    request_tag_range = ((uint64_t) hg_core_class->request_max_tag + 1) /
+                        request_tag_range_count;
+    while (request_tag_range & (request_tag_range - 1))
+        request_tag_range &= request_tag_range - 1;
+    if (request_tag_range >= hg_core_class->init_info.request_post_init) {
+        hg_core_class->request_tag_range = (na_tag_t) request_tag_range;
+        hg_core_class->request_tag_range_count =
+            (uint8_t) MAX(na_init_info.max_contexts, 1);
+    }
+    HG_LOG_SUBSYS_DEBUG(cls,
+        "Request max tag is %" PRIu32 ", using %" PRIu8
+        " context tag ranges of %" PRIu32 " tags",
+        (uint32_t) hg_core_class->request_max_tag,
+        hg_core_class->request_tag_range_count,
+        (uint32_t) hg_core_class->request_tag_range);
+
+    /* Cache registrations of bulk handles (disabled if cache size is 0) */
+    if (hg_init_info.bulk_reg_cache_size > 0) {
+        ret = hg_bulk_reg_cache_create((hg_core_class_t *) hg_core_class,
+            hg_init_info.bulk_reg_cache_size, &hg_core_class->bulk_reg_cache);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            cls, error, ret, "Could not create bulk registration cache");
+    }
+
+    /* Pools of handles may be extended from a separate thread so that
+     * progress is not delayed, this requires NA to be thread-safe */
+    if (hg_core_class->init_info.post_thread &&
+        hg_core_class->init_info.listen &&
+        hg_core_class->init_info.request_post_incr > 0 &&
+        !hg_core_class->init_info.na_ext_init &&
+        na_init_info.thread_mode == 0) {
+        rc = hg_thread_pool_init(1, &hg_core_class->grow_thread_pool);
+        HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+            "Could not create thread pool to extend pools of handles");
+    }
+
     *class_p = hg_core_class;
 
     return HG_SUCCESS;
 
 error:
+    if (hg_core_class->bulk_reg_cache != NULL)
+        hg_bulk_reg_cache_destroy(hg_core_class->bulk_reg_cache);
     if (hg_core_class->core_class.na_class != NULL &&
         !hg_core_class->init_info.na_ext_init) {
         na_return_t na_ret = NA_Finalize(hg_core_class->core_class.na_class);
@@ -1440,9 +1891,9 @@ error:
             "Could not finalize NA SM class (%s)", NA_Error_to_string(na_ret));
     }
 #endif
-    if (hg_core_class->rpc_map.map)
-        hg_hash_table_free(hg_core_class->rpc_map.map);
-    (void) hg_thread_rwlock_destroy(&hg_core_class->rpc_map.lock);
+    hg_core_map_finalize(&hg_core_class->rpc_map);
+    if (hg_core_class->grow_thread_pool != NULL)
+        (void) hg_thread_pool_destroy(hg_core_class->grow_thread_pool);
 
 error_free:
     free(hg_core_class);
@@ -1475,6 +1926,20 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
     HG_CHECK_SUBSYS_ERROR(cls, n_addrs != 0, error, ret, HG_BUSY,
         "HG addrs must be freed before finalizing HG (%d remaining)", n_addrs);
 
+    /* Stop thread extending pools */
+    if (hg_core_class->grow_thread_pool != NULL) {
+        int rc = hg_thread_pool_destroy(hg_core_class->grow_thread_pool);
+        HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret, HG_FAULT,
+            "Could not destroy thread pool");
+        hg_core_class->grow_thread_pool = NULL;
+    }
+
+    /* Release cached registrations before NA classes are finalized */
+    if (hg_core_class->bulk_reg_cache != NULL) {
+        hg_bulk_reg_cache_destroy(hg_core_class->bulk_reg_cache);
+        hg_core_class->bulk_reg_cache = NULL;
+    }
+
     /* Finalize NA class */
     if (hg_core_class->core_class.na_class != NULL &&
         !hg_core_class->init_info.na_ext_init) {
@@ -1502,11 +1967,7 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
             hg_core_class->core_class.data);
 
     /* Delete RPC map */
-    if (hg_core_class->rpc_map.map != NULL) {
-        hg_hash_table_free(hg_core_class->rpc_map.map);
-        hg_core_class->rpc_map.map = NULL;
-    }
-    (void) hg_thread_rwlock_destroy(&hg_core_class->rpc_map.lock);
+    hg_core_map_finalize(&hg_core_class->rpc_map);
     free(hg_core_class);
 
     return HG_SUCCESS;
@@ -1538,7 +1999,29 @@ hg_core_class_get_counters(const struct hg_core_counters *counters,
             (uint64_t) hg_atomic_get64(counters->rpc_req_recv_active_count),
         .rpc_multi_recv_copy_count =
             (uint64_t) hg_atomic_get64(counters->rpc_multi_recv_copy_count),
-        .bulk_count = (uint64_t) hg_atomic_get64(counters->bulk_count)};
+        .bulk_count = (uint64_t) hg_atomic_get64(counters->bulk_count),
+        .poll_wake_count =
+            (uint64_t) hg_atomic_get64(counters->poll_wake_count),
+        .poll_event_count =
+            (uint64_t) hg_atomic_get64(counters->poll_event_count),
+        .poll_spin_count =
+            (uint64_t) hg_atomic_get64(counters->poll_spin_count),
+        .handle_pool_count =
+            (uint64_t) hg_atomic_get64(counters->handle_pool_count),
+        .handle_pool_grow_count =
+            (uint64_t) hg_atomic_get64(counters->handle_pool_grow_count),
+        .handle_pool_shrink_count =
+            (uint64_t) hg_atomic_get64(counters->handle_pool_shrink_count),
+        .rpc_multi_recv_starved_count =
+            (uint64_t) hg_atomic_get64(counters->rpc_multi_recv_starved_count),
+        .rpc_multi_recv_nocopy_count =
+            (uint64_t) hg_atomic_get64(counters->rpc_multi_recv_nocopy_count),
+        .bulk_na_op_pool_hit_count =
+            (uint64_t) hg_atomic_get64(counters->bulk_na_op_pool_hit_count),
+        .bulk_reg_cache_hit_count =
+            (uint64_t) hg_atomic_get64(counters->bulk_reg_cache_hit_count),
+        .bulk_reg_cache_miss_count =
+            (uint64_t) hg_atomic_get64(counters->bulk_reg_cache_miss_count)};
 }
 #endif
 
@@ -1558,6 +2041,66 @@ hg_core_bulk_decr(hg_core_class_t *hg_core_class)
         &((struct hg_core_private_class *) hg_core_class)->n_bulks);
 }
 
+/*---------------------------------------------------------------------------*/
+void
+hg_core_bulk_na_op_pool_hit(hg_core_class_t HG_UNUSED *hg_core_class)
+{
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    /* Increment counter */
+    hg_atomic_incr64(((struct hg_core_private_class *) hg_core_class)
+                         ->counters.bulk_na_op_pool_hit_count);
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+struct hg_bulk_reg_cache *
+hg_core_bulk_get_reg_cache(hg_core_class_t *hg_core_class)
+{
+    return ((struct hg_core_private_class *) hg_core_class)->bulk_reg_cache;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_core_bulk_reg_cache_hit(hg_core_class_t HG_UNUSED *hg_core_class)
+{
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    /* Increment counter */
+    hg_atomic_incr64(((struct hg_core_private_class *) hg_core_class)
+                         ->counters.bulk_reg_cache_hit_count);
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_core_bulk_reg_cache_miss(hg_core_class_t HG_UNUSED *hg_core_class)
+{
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    /* Increment counter */
+    hg_atomic_incr64(((struct hg_core_private_class *) hg_core_class)
+                         ->counters.bulk_reg_cache_miss_count);
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_core_bulk_get_chunk_info(hg_core_class_t *hg_core_class,
+    size_t *chunk_size_p, uint32_t *chunk_window_p)
+{
+    const struct hg_core_init_info *init_info =
+        &((struct hg_core_private_class *) hg_core_class)->init_info;
+
+    *chunk_size_p = init_info->bulk_chunk_size;
+    *chunk_window_p = init_info->bulk_chunk_window;
+}
+
+/*---------------------------------------------------------------------------*/
+size_t
+hg_core_bulk_get_nt_copy_threshold(hg_core_class_t *hg_core_class)
+{
+    return ((struct hg_core_private_class *) hg_core_class)
+        ->init_info.bulk_nt_copy_threshold;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_context_create(struct hg_core_private_class *hg_core_class, uint8_t id,
@@ -1586,6 +2129,7 @@ hg_core_context_create(struct hg_core_private_class *hg_core_class, uint8_t id,
 
     STAILQ_INIT(&backfill_queue->queue);
     hg_atomic_init32(&backfill_queue->count, 0);
+    hg_atomic_init32(&backfill_queue->waiters, 0);
     rc = hg_thread_mutex_init(&backfill_queue->mutex);
     HG_CHECK_SUBSYS_ERROR(ctx, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
         "hg_thread_mutex_init() failed");
@@ -1595,10 +2139,9 @@ hg_core_context_create(struct hg_core_private_class *hg_core_class, uint8_t id,
         "hg_thread_cond_init() failed");
     backfill_queue_cond_init = true;
 
-    context->completion_queue =
-        hg_atomic_queue_alloc(HG_CORE_ATOMIC_QUEUE_SIZE);
-    HG_CHECK_SUBSYS_ERROR(ctx, context->completion_queue == NULL, error, ret,
-        HG_NOMEM, "Could not allocate queue");
+    ret = hg_core_atomic_queue_init(&context->completion_queue,
+        hg_core_class->init_info.completion_queue_size);
+    HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not allocate queue");
 
     /* Notifications of completion queue events */
     hg_atomic_init32(&context->loopback_notify.must_notify, 0);
@@ -1608,6 +2151,11 @@ hg_core_context_create(struct hg_core_private_class *hg_core_class, uint8_t id,
         "hg_thread_mutex_init() failed");
     loopback_notify_mutex_init = true;
 
+    /* Start with a full busy-poll window */
+    hg_time_get_current(&context->adaptive_poll.last_event);
+    context->adaptive_poll.interval_avg =
+        (double) HG_CORE_ADAPTIVE_POLL_MAX_US / 2.0e6;
+
     LIST_INIT(&context->user_list.list);
     rc = hg_thread_spin_init(&context->user_list.lock);
     HG_CHECK_SUBSYS_ERROR(ctx, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
@@ -1705,6 +2253,20 @@ hg_core_context_create(struct hg_core_private_class *hg_core_class, uint8_t id,
     /* Assign context ID */
     context->core_context.id = id;
 
+    /* Generate tags from the context ID range without contention between
+     * contexts, contexts past the last range share the class counter */
+    hg_atomic_init32(&context->request_tag, 0);
+    if (hg_core_class->request_tag_range != 0) {
+        uint8_t range_id = MIN(id, hg_core_class->request_tag_range_count);
+
+        context->request_tag_base =
+            (na_tag_t) range_id * hg_core_class->request_tag_range;
+        context->request_tag_mask = hg_core_class->request_tag_range - 1;
+        context->request_tag_p = (id < hg_core_class->request_tag_range_count)
+                                     ? &context->request_tag
+                                     : &hg_core_class->request_tag;
+    }
+
     /* Create pool of bulk op IDs */
     ret = hg_bulk_op_pool_create((hg_core_context_t *) context,
         HG_CORE_BULK_OP_INIT_COUNT, &context->hg_bulk_op_pool);
@@ -1784,7 +2346,7 @@ error:
         if (progress_multi_cond_init)
             (void) hg_thread_cond_destroy(&progress_multi->cond);
 #endif
-        hg_atomic_queue_free(context->completion_queue);
+        hg_core_atomic_queue_finalize(&context->completion_queue);
         free(context);
     }
 
@@ -1852,7 +2414,7 @@ hg_core_context_destroy(struct hg_core_private_context *context)
         "Completion queue should be empty");
 
     /* Check that atomic completion queue is empty now */
-    empty = hg_atomic_queue_is_empty(context->completion_queue);
+    empty = hg_core_atomic_queue_is_empty(&context->completion_queue);
     HG_CHECK_SUBSYS_ERROR(ctx, empty == false, error, ret, HG_BUSY,
         "Completion queue should be empty");
 
@@ -1937,7 +2499,7 @@ hg_core_context_destroy(struct hg_core_private_context *context)
     (void) hg_thread_cond_destroy(&progress_multi->cond);
 #endif
 
-    hg_atomic_queue_free(context->completion_queue);
+    hg_core_atomic_queue_finalize(&context->completion_queue);
     free(context);
 
     /* Decrement context count of parent class */
@@ -2101,35 +2663,43 @@ hg_core_context_multi_recv_alloc(struct hg_core_private_context *context,
     unexpected_msg_size = NA_Msg_get_max_unexpected_size(na_class);
     HG_CHECK_SUBSYS_ERROR(ctx, unexpected_msg_size == 0, error, ret,
         HG_INVALID_PARAM, "Invalid unexpected message size");
-    context->multi_recv_ops =
-        calloc(multi_recv_op_max, sizeof(*context->multi_recv_ops));
+
+    /* Reserve entries for buffers that may be added under load */
+    context->multi_recv_op_capacity =
+        multi_recv_op_max * HG_CORE_MULTI_RECV_OP_GROW;
+    context->multi_recv_ops = calloc(
+        context->multi_recv_op_capacity, sizeof(*context->multi_recv_ops));
     HG_CHECK_SUBSYS_ERROR(ctx, context->multi_recv_ops == NULL, error, ret,
         HG_NOMEM, "Could not allocate %u multi-recv op entries",
-        multi_recv_op_max);
+        context->multi_recv_op_capacity);
 
-    for (i = 0; i < multi_recv_op_max; i++) {
+    for (i = 0; i < context->multi_recv_op_capacity; i++) {
         struct hg_core_multi_recv_op *multi_recv_op =
             &context->multi_recv_ops[i];
 
         multi_recv_op->context = context;
-        multi_recv_op->op_id = NA_Op_create(na_class, NA_OP_MULTI);
-        HG_CHECK_SUBSYS_ERROR(ctx, multi_recv_op->op_id == NULL, error, ret,
-            HG_NOMEM, "Could not create new OP ID");
+        multi_recv_op->id = i;
 
         /* Keep total buffer size as max of unexpected msg size x number of
          * "pre-posted" operations. */
         multi_recv_op->buf_size = request_count * unexpected_msg_size;
 
-        multi_recv_op->buf = NA_Msg_buf_alloc(na_class, multi_recv_op->buf_size,
-            NA_MULTI_RECV, &multi_recv_op->plugin_data);
-        HG_CHECK_SUBSYS_ERROR(ctx, multi_recv_op->buf == NULL, error, ret,
-            HG_NOMEM, "Could not allocate multi-recv buffer of size %zu",
-            multi_recv_op->buf_size);
-
         hg_atomic_init32(&multi_recv_op->last, 0);
         hg_atomic_init32(&multi_recv_op->ref_count, 0);
         hg_atomic_init32(&multi_recv_op->op_count, 0);
+        hg_atomic_init32(&multi_recv_op->allocated, 0);
+    }
+
+    for (i = 0; i < multi_recv_op_max; i++) {
+        struct hg_core_multi_recv_op *multi_recv_op =
+            &context->multi_recv_ops[i];
+
+        ret = hg_core_multi_recv_op_alloc(multi_recv_op, na_class);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            ctx, error, ret, "Could not allocate multi-recv op %u", i);
+        hg_atomic_set32(&multi_recv_op->allocated, 1);
     }
+    hg_atomic_init32(&context->multi_recv_replenish, 0);
 
     return HG_SUCCESS;
 
@@ -2137,18 +2707,11 @@ error:
     if (context->multi_recv_ops == NULL)
         return ret;
 
-    for (i = 0; i < multi_recv_op_max; i++) {
-        struct hg_core_multi_recv_op *multi_recv_op =
-            &context->multi_recv_ops[i];
-        NA_Op_destroy(na_class, multi_recv_op->op_id);
-        multi_recv_op->op_id = NULL;
-        NA_Msg_buf_free(
-            na_class, multi_recv_op->buf, multi_recv_op->plugin_data);
-        multi_recv_op->buf = NULL;
-        multi_recv_op->plugin_data = NULL;
-        multi_recv_op->buf_size = 0;
-    }
+    for (i = 0; i < multi_recv_op_max; i++)
+        if (hg_atomic_get32(&context->multi_recv_ops[i].allocated))
+            hg_core_multi_recv_op_free(&context->multi_recv_ops[i], na_class);
     free(context->multi_recv_ops);
+    context->multi_recv_ops = NULL;
 
     return ret;
 }
@@ -2158,32 +2721,29 @@ static void
 hg_core_context_multi_recv_free(
     struct hg_core_private_context *context, na_class_t *na_class)
 {
-    unsigned int multi_recv_op_max =
-        HG_CORE_CONTEXT_CLASS(context)->init_info.multi_recv_op_max;
     unsigned int i;
 
     if (context->multi_recv_ops == NULL)
         return;
 
-    for (i = 0; i < multi_recv_op_max; i++) {
+    for (i = 0; i < context->multi_recv_op_capacity; i++) {
         struct hg_core_multi_recv_op *multi_recv_op =
             &context->multi_recv_ops[i];
 
+        if (!hg_atomic_get32(&multi_recv_op->allocated))
+            continue;
+
         HG_CHECK_SUBSYS_WARNING(ctx,
             hg_atomic_get32(&multi_recv_op->ref_count) != 0,
             "Freeing multi-recv operation that is still being referenced "
             "(%" PRId32 ")",
             hg_atomic_get32(&multi_recv_op->ref_count));
 
-        NA_Op_destroy(na_class, multi_recv_op->op_id);
-        multi_recv_op->op_id = NULL;
-        NA_Msg_buf_free(
-            na_class, multi_recv_op->buf, multi_recv_op->plugin_data);
-        multi_recv_op->buf = NULL;
-        multi_recv_op->plugin_data = NULL;
-        multi_recv_op->buf_size = 0;
+        hg_core_multi_recv_op_free(multi_recv_op, na_class);
+        hg_atomic_set32(&multi_recv_op->allocated, 0);
     }
     free(context->multi_recv_ops);
+    context->multi_recv_ops = NULL;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2200,12 +2760,8 @@ hg_core_context_multi_recv_post(struct hg_core_private_context *context,
      * a new buffer until the previous buffer can be safely re-used once it's
      * consumed. */
     for (i = 0; i < multi_recv_op_max; i++) {
-        struct hg_core_multi_recv_op *multi_recv_op =
-            &context->multi_recv_ops[i];
-
-        multi_recv_op->id = i;
-
-        ret = hg_core_post_multi(multi_recv_op, na_class, na_context);
+        ret = hg_core_post_multi(
+            &context->multi_recv_ops[i], na_class, na_context);
         HG_CHECK_SUBSYS_HG_ERROR(
             ctx, error, ret, "Could not post multi-recv buffer %u", i);
     }
@@ -2223,16 +2779,17 @@ static hg_return_t
 hg_core_context_multi_recv_unpost(struct hg_core_private_context *context,
     na_class_t *na_class, na_context_t *na_context)
 {
-    unsigned int multi_recv_op_max =
-        HG_CORE_CONTEXT_CLASS(context)->init_info.multi_recv_op_max;
     hg_return_t ret;
     unsigned int i;
 
-    for (i = 0; i < multi_recv_op_max; i++) {
+    for (i = 0; i < context->multi_recv_op_capacity; i++) {
         struct hg_core_multi_recv_op *multi_recv_op =
             &context->multi_recv_ops[i];
         na_return_t na_ret;
 
+        if (!hg_atomic_get32(&multi_recv_op->allocated))
+            continue;
+
         na_ret = NA_Cancel(na_class, na_context, multi_recv_op->op_id);
         HG_CHECK_SUBSYS_ERROR(rpc, na_ret != NA_SUCCESS, error, ret,
             (hg_return_t) na_ret, "NA_Cancel() of multi-recv op failed (%s)",
@@ -2253,10 +2810,290 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_core_context_check_handle_list(struct hg_core_handle_list *handle_list)
+hg_core_context_multi_recv_replenish(struct hg_core_private_context *context)
 {
-    struct hg_core_private_handle *hg_core_handle = NULL;
-    hg_return_t ret;
+    struct hg_core_private_class *hg_core_class =
+        HG_CORE_CONTEXT_CLASS(context);
+    unsigned int multi_recv_op_max = hg_core_class->init_info.multi_recv_op_max;
+    int32_t low_watermark = (int32_t) MAX(multi_recv_op_max / 2, 1);
+    struct hg_core_private_handle
+        *hg_core_handles[HG_CORE_MULTI_RECV_RECLAIM_MAX];
+    unsigned int i, count;
+    hg_return_t ret;
+
+    /* Copy out payloads of requests that have not been processed yet so that
+     * consumed buffers can be reposted, copies and reposts are done outside
+     * of the handle list lock */
+    do {
+        struct hg_core_private_handle *hg_core_handle;
+
+        count = 0;
+        hg_thread_spin_lock(&context->internal_list.lock);
+        LIST_FOREACH (hg_core_handle, &context->internal_list.list, created) {
+            if (count == HG_CORE_MULTI_RECV_RECLAIM_MAX)
+                break;
+            if (hg_core_multi_recv_reclaim_get(hg_core_handle))
+                hg_core_handles[count++] = hg_core_handle;
+        }
+        hg_thread_spin_unlock(&context->internal_list.lock);
+
+        for (i = 0; i < count; i++) {
+            ret = hg_core_multi_recv_reclaim(hg_core_handles[i]);
+            HG_CHECK_SUBSYS_HG_ERROR(ctx, release, ret,
+                "Could not copy out multi-recv payload of handle (%p)",
+                (void *) hg_core_handles[i]);
+        }
+    } while (count == HG_CORE_MULTI_RECV_RECLAIM_MAX);
+
+    /* Add buffers while too few remain posted */
+    for (i = multi_recv_op_max; i < context->multi_recv_op_capacity &&
+                                hg_atomic_get32(&context->multi_recv_op_count) <
+                                    low_watermark &&
+                                !hg_atomic_get32(&context->unposting);
+         i++) {
+        struct hg_core_multi_recv_op *multi_recv_op =
+            &context->multi_recv_ops[i];
+
+        if (!hg_atomic_cas32(&multi_recv_op->allocated, 0, 1))
+            continue;
+
+        HG_LOG_SUBSYS_DEBUG(ctx, "Adding multi-recv buffer %u", i);
+
+        ret = hg_core_multi_recv_op_alloc(
+            multi_recv_op, hg_core_class->core_class.na_class);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            ctx, error, ret, "Could not allocate multi-recv op %u", i);
+
+        ret = hg_core_post_multi(multi_recv_op,
+            hg_core_class->core_class.na_class,
+            context->core_context.na_context);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            ctx, error, ret, "Could not post multi-recv buffer %u", i);
+        hg_atomic_incr32(&context->multi_recv_op_count);
+    }
+
+    return HG_SUCCESS;
+
+release:
+    /* Release handles that have not been processed */
+    for (i = i + 1; i < count; i++) {
+        hg_atomic_set32(
+            &hg_core_handles[i]->multi_recv_state, HG_CORE_MULTI_RECV_IDLE);
+        (void) hg_core_destroy(hg_core_handles[i]);
+    }
+
+    return ret;
+
+error:
+    hg_core_multi_recv_op_free(
+        &context->multi_recv_ops[i], hg_core_class->core_class.na_class);
+    hg_atomic_set32(&context->multi_recv_ops[i].allocated, 0);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_multi_recv_op_alloc(
+    struct hg_core_multi_recv_op *multi_recv_op, na_class_t *na_class)
+{
+    hg_return_t ret;
+
+    multi_recv_op->op_id = NA_Op_create(na_class, NA_OP_MULTI);
+    HG_CHECK_SUBSYS_ERROR(ctx, multi_recv_op->op_id == NULL, error, ret,
+        HG_NOMEM, "Could not create new OP ID");
+
+    multi_recv_op->buf = NA_Msg_buf_alloc(na_class, multi_recv_op->buf_size,
+        NA_MULTI_RECV, &multi_recv_op->plugin_data);
+    HG_CHECK_SUBSYS_ERROR(ctx, multi_recv_op->buf == NULL, error, ret,
+        HG_NOMEM, "Could not allocate multi-recv buffer of size %zu",
+        multi_recv_op->buf_size);
+
+    return HG_SUCCESS;
+
+error:
+    hg_core_multi_recv_op_free(multi_recv_op, na_class);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_multi_recv_op_free(
+    struct hg_core_multi_recv_op *multi_recv_op, na_class_t *na_class)
+{
+    NA_Op_destroy(na_class, multi_recv_op->op_id);
+    multi_recv_op->op_id = NULL;
+    NA_Msg_buf_free(na_class, multi_recv_op->buf, multi_recv_op->plugin_data);
+    multi_recv_op->buf = NULL;
+    multi_recv_op->plugin_data = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_multi_recv_op_release(struct hg_core_multi_recv_op *multi_recv_op,
+    na_class_t *na_class, na_context_t *na_context)
+{
+    struct hg_core_private_context *context = multi_recv_op->context;
+    unsigned int multi_recv_op_max =
+        HG_CORE_CONTEXT_CLASS(context)->init_info.multi_recv_op_max;
+    hg_return_t ret;
+
+    if (hg_atomic_decr32(&multi_recv_op->ref_count) != 0 ||
+        !hg_atomic_get32(&multi_recv_op->last))
+        return HG_SUCCESS;
+
+    /* Release buffers added under load once enough buffers are posted */
+    if (multi_recv_op->id >= multi_recv_op_max &&
+        hg_atomic_get32(&context->multi_recv_op_count) >=
+            (int32_t) multi_recv_op_max) {
+        HG_LOG_SUBSYS_DEBUG(
+            ctx, "Releasing multi-recv buffer %u", multi_recv_op->id);
+        hg_core_multi_recv_op_free(multi_recv_op, na_class);
+        hg_atomic_set32(&multi_recv_op->allocated, 0);
+        return HG_SUCCESS;
+    }
+
+    HG_LOG_SUBSYS_DEBUG(
+        ctx, "Reposting multi-recv buffer %d", multi_recv_op->id);
+
+    /* Repost multi recv */
+    ret = hg_core_post_multi(multi_recv_op, na_class, na_context);
+    HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret,
+        "Cannot repost multi-recv operation (%d)", multi_recv_op->id);
+    hg_atomic_incr32(&context->multi_recv_op_count);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static bool
+hg_core_multi_recv_reclaim_get(struct hg_core_private_handle *hg_core_handle)
+{
+    struct hg_core_multi_recv_op *multi_recv_op;
+    int32_t ref_count;
+
+    if (!hg_atomic_cas32(&hg_core_handle->multi_recv_state,
+            HG_CORE_MULTI_RECV_IDLE, HG_CORE_MULTI_RECV_RECLAIM))
+        return false;
+
+    /* Nothing to release while buffer is still posted */
+    multi_recv_op = hg_core_handle->multi_recv_op;
+    if (multi_recv_op == NULL || !hg_atomic_get32(&multi_recv_op->last))
+        goto idle;
+
+    /* Keep handle alive until payload is copied out, unless it is already
+     * being destroyed */
+    do {
+        ref_count = hg_atomic_get32(&hg_core_handle->ref_count);
+        if (ref_count == 0)
+            goto idle;
+    } while (!hg_atomic_cas32(
+        &hg_core_handle->ref_count, ref_count, ref_count + 1));
+    HG_LOG_SUBSYS_DEBUG(rpc_ref, "Handle (%p) ref_count incr to %" PRId32,
+        (void *) hg_core_handle, ref_count + 1);
+
+    return true;
+
+idle:
+    hg_atomic_set32(&hg_core_handle->multi_recv_state, HG_CORE_MULTI_RECV_IDLE);
+
+    return false;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_multi_recv_reclaim(struct hg_core_private_handle *hg_core_handle)
+{
+    hg_return_t ret;
+
+    ret = hg_core_multi_recv_copy(hg_core_handle);
+    hg_atomic_set32(&hg_core_handle->multi_recv_state, HG_CORE_MULTI_RECV_BUSY);
+    HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret,
+        "Could not copy out multi-recv payload for handle (%p)",
+        (void *) hg_core_handle);
+
+    return hg_core_destroy(hg_core_handle);
+
+error:
+    (void) hg_core_destroy(hg_core_handle);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_multi_recv_copy(struct hg_core_private_handle *hg_core_handle)
+{
+    hg_return_t ret;
+
+    if (hg_core_handle->in_buf_storage == NULL) {
+        hg_core_handle->in_buf_storage_size =
+            NA_Msg_get_max_unexpected_size(hg_core_handle->na_class);
+        hg_core_handle->in_buf_storage = NA_Msg_buf_alloc(
+            hg_core_handle->na_class, hg_core_handle->in_buf_storage_size,
+            NA_RECV, &hg_core_handle->in_buf_plugin_data);
+        HG_CHECK_SUBSYS_ERROR(rpc, hg_core_handle->in_buf_storage == NULL,
+            error, ret, HG_NOMEM, "Could not allocate buffer for input");
+    }
+    HG_CHECK_SUBSYS_ERROR(rpc,
+        hg_core_handle->core_handle.in_buf_used >
+            hg_core_handle->in_buf_storage_size,
+        error, ret, HG_OVERFLOW,
+        "Actual transfer size (%zu) is too large for unexpected recv",
+        hg_core_handle->core_handle.in_buf_used);
+
+    HG_LOG_SUBSYS_DEBUG(rpc,
+        "Copying multi-recv payload of size %zu for handle (%p)",
+        hg_core_handle->core_handle.in_buf_used, (void *) hg_core_handle);
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    /* Increment counter */
+    hg_atomic_incr64(HG_CORE_HANDLE_CLASS(hg_core_handle)
+                         ->counters.rpc_multi_recv_copy_count);
+#endif
+
+    memcpy(hg_core_handle->in_buf_storage, hg_core_handle->core_handle.in_buf,
+        hg_core_handle->core_handle.in_buf_used);
+    hg_core_handle->core_handle.in_buf_size =
+        hg_core_handle->in_buf_storage_size;
+    hg_core_handle->core_handle.in_buf = hg_core_handle->in_buf_storage;
+    hg_core_handle->multi_recv_copy = true;
+
+    ret = hg_core_release_input(hg_core_handle);
+    HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret,
+        "Could not release input for handle (%p)", (void *) hg_core_handle);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_core_multi_recv_claim(struct hg_core_private_handle *hg_core_handle)
+{
+    if (hg_atomic_get32(&hg_core_handle->multi_recv_state) ==
+        HG_CORE_MULTI_RECV_BUSY)
+        return;
+
+    /* Wait for payload copy to complete if one was started */
+    while (!hg_atomic_cas32(&hg_core_handle->multi_recv_state,
+               HG_CORE_MULTI_RECV_IDLE, HG_CORE_MULTI_RECV_BUSY) &&
+           hg_atomic_get32(&hg_core_handle->multi_recv_state) ==
+               HG_CORE_MULTI_RECV_RECLAIM)
+        cpu_spinwait();
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_context_check_handle_list(struct hg_core_handle_list *handle_list)
+{
+    struct hg_core_private_handle *hg_core_handle = NULL;
+    hg_return_t ret;
 
     hg_thread_spin_lock(&handle_list->lock);
 
@@ -2373,8 +3210,17 @@ hg_core_handle_pool_create(struct hg_core_private_context *context,
         "hg_thread_cond_init() failed");
     extend_cond_init = true;
 
-    hg_core_handle_pool->count = init_count;
+    hg_atomic_init64(&hg_core_handle_pool->idle_start, 0);
+    hg_atomic_init32(&hg_core_handle_pool->count, 0);
+    hg_atomic_init32(&hg_core_handle_pool->pending_count, 0);
+    hg_atomic_init32(&hg_core_handle_pool->grow, HG_CORE_POOL_GROW_NONE);
+    hg_atomic_init32(&hg_core_handle_pool->destroyed, 0);
+    hg_core_handle_pool->grow_work.func = hg_core_handle_pool_grow_thread;
+    hg_core_handle_pool->grow_work.args = hg_core_handle_pool;
+    hg_core_handle_pool->init_count = init_count;
     hg_core_handle_pool->incr_count = incr_count;
+    hg_core_handle_pool->low_watermark = (int32_t) MIN(
+        incr_count / HG_CORE_POST_LOW_WATERMARK, init_count / 2);
     hg_core_handle_pool->extending = false;
     hg_core_handle_pool->context = context;
     hg_core_handle_pool->na_class = na_class;
@@ -2406,7 +3252,7 @@ error:
             LIST_REMOVE(hg_core_handle, pending);
 
             /* Prevent re-initialization */
-            hg_core_handle->reuse = false;
+            hg_core_handle_pool_release(hg_core_handle_pool, hg_core_handle);
 
             /* Destroy handle */
             (void) hg_core_destroy(hg_core_handle);
@@ -2434,6 +3280,8 @@ hg_core_handle_pool_destroy(struct hg_core_handle_pool *hg_core_handle_pool)
 
     HG_LOG_DEBUG("Free handle pool (%p)", (void *) hg_core_handle_pool);
 
+    hg_core_handle_pool_grow_wait(hg_core_handle_pool);
+
     hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
     hg_core_handle = LIST_FIRST(&hg_core_handle_pool->pending_list.list);
     while (hg_core_handle) {
@@ -2442,7 +3290,7 @@ hg_core_handle_pool_destroy(struct hg_core_handle_pool *hg_core_handle_pool)
         LIST_REMOVE(hg_core_handle, pending);
 
         /* Prevent re-initialization */
-        hg_core_handle->reuse = false;
+        hg_core_handle_pool_release(hg_core_handle_pool, hg_core_handle);
 
         /* Destroy handle */
         (void) hg_core_destroy(hg_core_handle);
@@ -2450,24 +3298,22 @@ hg_core_handle_pool_destroy(struct hg_core_handle_pool *hg_core_handle_pool)
     }
     hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
 
-    (void) hg_thread_mutex_destroy(&hg_core_handle_pool->extend_mutex);
-    (void) hg_thread_cond_destroy(&hg_core_handle_pool->extend_cond);
-    (void) hg_thread_spin_destroy(&hg_core_handle_pool->pending_list.lock);
-
-    free(hg_core_handle_pool);
+    /* Handles that are still in use release the pool once they are freed */
+    hg_atomic_set32(&hg_core_handle_pool->destroyed, 1);
+    if (hg_atomic_get32(&hg_core_handle_pool->count) == 0 &&
+        hg_atomic_cas32(&hg_core_handle_pool->destroyed, 1, 2))
+        hg_core_handle_pool_free(hg_core_handle_pool);
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE bool
-hg_core_handle_pool_empty(struct hg_core_handle_pool *hg_core_handle_pool)
+static void
+hg_core_handle_pool_free(struct hg_core_handle_pool *hg_core_handle_pool)
 {
-    bool ret;
-
-    hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
-    ret = LIST_EMPTY(&hg_core_handle_pool->pending_list.list);
-    hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+    (void) hg_thread_mutex_destroy(&hg_core_handle_pool->extend_mutex);
+    (void) hg_thread_cond_destroy(&hg_core_handle_pool->extend_cond);
+    (void) hg_thread_spin_destroy(&hg_core_handle_pool->pending_list.lock);
 
-    return ret;
+    free(hg_core_handle_pool);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2476,6 +3322,7 @@ hg_core_handle_pool_get(struct hg_core_handle_pool *hg_core_handle_pool,
     struct hg_core_private_handle **hg_core_handle_p)
 {
     struct hg_core_private_handle *hg_core_handle;
+    int32_t pending_count = 0;
     hg_return_t ret;
 
     do {
@@ -2483,6 +3330,8 @@ hg_core_handle_pool_get(struct hg_core_handle_pool *hg_core_handle_pool,
         hg_core_handle = LIST_FIRST(&hg_core_handle_pool->pending_list.list);
         if (hg_core_handle != NULL) {
             LIST_REMOVE(hg_core_handle, pending);
+            pending_count =
+                hg_atomic_decr32(&hg_core_handle_pool->pending_count);
             hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
             break;
         }
@@ -2495,6 +3344,11 @@ hg_core_handle_pool_get(struct hg_core_handle_pool *hg_core_handle_pool,
 
     } while (hg_core_handle == NULL);
 
+    /* Extend pool ahead of demand on next progress */
+    if (pending_count < hg_core_handle_pool->low_watermark)
+        hg_atomic_cas32(&hg_core_handle_pool->grow, HG_CORE_POOL_GROW_NONE,
+            HG_CORE_POOL_GROW_REQUESTED);
+
     *hg_core_handle_p = hg_core_handle;
 
     return HG_SUCCESS;
@@ -2529,7 +3383,10 @@ hg_core_handle_pool_extend(struct hg_core_handle_pool *hg_core_handle_pool)
         HG_CHECK_SUBSYS_HG_ERROR(
             ctx, unlock, ret, "Could not insert handle %u into pool", i);
     }
-    hg_core_handle_pool->count += hg_core_handle_pool->incr_count;
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    hg_atomic_incr64(HG_CORE_CONTEXT_CLASS(hg_core_handle_pool->context)
+                         ->counters.handle_pool_grow_count);
+#endif
 
 unlock:
     hg_thread_mutex_lock(&hg_core_handle_pool->extend_mutex);
@@ -2540,6 +3397,248 @@ unlock:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_core_handle_pool_grow_thread(void *arg)
+{
+    struct hg_core_handle_pool *hg_core_handle_pool =
+        (struct hg_core_handle_pool *) arg;
+    hg_thread_ret_t thread_ret = (hg_thread_ret_t) 0;
+
+    /* Handles would no longer be canceled once unposting */
+    if (!hg_atomic_get32(&hg_core_handle_pool->context->unposting)) {
+        hg_return_t ret = hg_core_handle_pool_extend(hg_core_handle_pool);
+        HG_CHECK_SUBSYS_ERROR_DONE(
+            ctx, ret != HG_SUCCESS, "Could not extend pool");
+    }
+    hg_core_handle_pool_grow_done(hg_core_handle_pool);
+
+    return thread_ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_handle_pool_grow_done(struct hg_core_handle_pool *hg_core_handle_pool)
+{
+    hg_thread_mutex_lock(&hg_core_handle_pool->extend_mutex);
+    hg_atomic_set32(&hg_core_handle_pool->grow, HG_CORE_POOL_GROW_NONE);
+    hg_thread_cond_broadcast(&hg_core_handle_pool->extend_cond);
+    hg_thread_mutex_unlock(&hg_core_handle_pool->extend_mutex);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_handle_pool_grow_wait(struct hg_core_handle_pool *hg_core_handle_pool)
+{
+    hg_thread_mutex_lock(&hg_core_handle_pool->extend_mutex);
+    while (hg_atomic_get32(&hg_core_handle_pool->grow) ==
+           HG_CORE_POOL_GROW_POSTED)
+        hg_thread_cond_wait(&hg_core_handle_pool->extend_cond,
+            &hg_core_handle_pool->extend_mutex);
+    hg_thread_mutex_unlock(&hg_core_handle_pool->extend_mutex);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_handle_pool_shrink(
+    struct hg_core_handle_pool *hg_core_handle_pool, unsigned int count)
+{
+    struct hg_core_private_handle *hg_core_handle;
+    unsigned int i;
+    hg_return_t ret;
+
+    HG_LOG_SUBSYS_DEBUG(perf, "Handle pool (%p) was idle, releasing %u handles",
+        (void *) hg_core_handle_pool, count);
+
+    if (hg_core_handle_pool->flags & HG_CORE_HANDLE_MULTI_RECV) {
+        /* Handles are not posted and can be freed directly */
+        for (i = 0; i < count; i++) {
+            hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
+            hg_core_handle =
+                LIST_FIRST(&hg_core_handle_pool->pending_list.list);
+            if (hg_core_handle == NULL) {
+                hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+                break;
+            }
+            LIST_REMOVE(hg_core_handle, pending);
+            hg_atomic_decr32(&hg_core_handle_pool->pending_count);
+            hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+
+            hg_core_handle_pool_release(hg_core_handle_pool, hg_core_handle);
+            (void) hg_core_destroy(hg_core_handle);
+        }
+    } else {
+        struct hg_core_private_handle **hg_core_handles;
+        unsigned int n = 0;
+
+        hg_core_handles = (struct hg_core_private_handle **) malloc(
+            count * sizeof(*hg_core_handles));
+        HG_CHECK_SUBSYS_ERROR(ctx, hg_core_handles == NULL, error, ret,
+            HG_NOMEM, "Could not allocate array of %u handles", count);
+
+        /* Take a reference to handles to cancel so that they remain valid
+         * once the lock is released */
+        hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
+        LIST_FOREACH (
+            hg_core_handle, &hg_core_handle_pool->pending_list.list, pending) {
+            if (n == count)
+                break;
+            hg_atomic_incr32(&hg_core_handle->ref_count);
+            hg_core_handles[n++] = hg_core_handle;
+        }
+        hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
+
+        /* Cancel posted handles, they are freed once cancelation completes */
+        ret = HG_SUCCESS;
+        for (i = 0; i < n; i++) {
+            if (ret == HG_SUCCESS) {
+                ret = hg_core_cancel(hg_core_handles[i]);
+                HG_CHECK_SUBSYS_ERROR_DONE(ctx, ret != HG_SUCCESS,
+                    "Could not cancel handle (%p)",
+                    (void *) hg_core_handles[i]);
+            }
+            (void) hg_core_destroy(hg_core_handles[i]);
+        }
+        free(hg_core_handles);
+        if (ret != HG_SUCCESS)
+            return ret;
+    }
+
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    hg_atomic_incr64(HG_CORE_CONTEXT_CLASS(hg_core_handle_pool->context)
+                         ->counters.handle_pool_shrink_count);
+#endif
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_handle_pool_check(struct hg_core_handle_pool *hg_core_handle_pool)
+{
+    int32_t extra = hg_atomic_get32(&hg_core_handle_pool->count) -
+                    (int32_t) hg_core_handle_pool->init_count;
+    int64_t idle_start, now_ms;
+    hg_time_t now;
+    hg_return_t ret;
+
+    /* Extend pool that was requested to grow from callbacks, from the class
+     * thread pool if one was requested so that progress is not delayed */
+    if (hg_atomic_get32(&hg_core_handle_pool->grow) ==
+            HG_CORE_POOL_GROW_REQUESTED &&
+        hg_atomic_cas32(&hg_core_handle_pool->grow,
+            HG_CORE_POOL_GROW_REQUESTED, HG_CORE_POOL_GROW_POSTED)) {
+        hg_thread_pool_t *thread_pool =
+            HG_CORE_CONTEXT_CLASS(hg_core_handle_pool->context)
+                ->grow_thread_pool;
+
+        HG_LOG_SUBSYS_DEBUG(perf,
+            "Pre-posted handles below low watermark, posting %u more",
+            hg_core_handle_pool->incr_count);
+
+        if (thread_pool != NULL &&
+            hg_thread_pool_post(thread_pool, &hg_core_handle_pool->grow_work) ==
+                HG_UTIL_SUCCESS)
+            return HG_SUCCESS;
+
+        ret = hg_core_handle_pool_extend(hg_core_handle_pool);
+        hg_core_handle_pool_grow_done(hg_core_handle_pool);
+        HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not extend pool");
+        return HG_SUCCESS;
+    }
+
+    if (extra <= 0)
+        return HG_SUCCESS;
+    extra = MIN(extra, (int32_t) hg_core_handle_pool->incr_count);
+
+    /* Pool is idle when a batch could be removed without going below the
+     * low watermark */
+    if (hg_atomic_get32(&hg_core_handle_pool->pending_count) - extra <
+        hg_core_handle_pool->low_watermark) {
+        hg_atomic_set64(&hg_core_handle_pool->idle_start, 0);
+        return HG_SUCCESS;
+    }
+
+    hg_time_get_current_ms(&now);
+    now_ms = (int64_t) (hg_time_to_double(now) * 1000.0);
+    idle_start = hg_atomic_get64(&hg_core_handle_pool->idle_start);
+    if (idle_start == 0) {
+        hg_atomic_cas64(&hg_core_handle_pool->idle_start, 0, now_ms);
+        return HG_SUCCESS;
+    }
+    if (now_ms - idle_start < HG_CORE_POST_IDLE_TIME)
+        return HG_SUCCESS;
+
+    /* Start new idle period, only one thread shrinks the pool */
+    if (!hg_atomic_cas64(&hg_core_handle_pool->idle_start, idle_start, now_ms))
+        return HG_SUCCESS;
+
+    ret = hg_core_handle_pool_shrink(hg_core_handle_pool, (unsigned int) extra);
+    HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret, "Could not shrink pool");
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_core_context_check_pools(struct hg_core_private_context *context)
+{
+    hg_return_t ret;
+
+    if (context->handle_pool != NULL) {
+        ret = hg_core_handle_pool_check(context->handle_pool);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            ctx, error, ret, "Could not check pool of handles");
+    }
+
+#ifdef NA_HAS_SM
+    if (context->sm_handle_pool != NULL) {
+        ret = hg_core_handle_pool_check(context->sm_handle_pool);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            ctx, error, ret, "Could not check pool of handles");
+    }
+#endif
+
+    if (hg_atomic_get32(&context->multi_recv_replenish) &&
+        hg_atomic_cas32(&context->multi_recv_replenish, 1, 0)) {
+        ret = hg_core_context_multi_recv_replenish(context);
+        HG_CHECK_SUBSYS_HG_ERROR(
+            ctx, error, ret, "Could not replenish multi-recv buffers");
+    }
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_core_handle_pool_release(struct hg_core_handle_pool *hg_core_handle_pool,
+    struct hg_core_private_handle *hg_core_handle)
+{
+    int32_t count;
+
+    hg_core_handle->reuse = false;
+    hg_core_handle->handle_pool = NULL;
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    hg_atomic_decr64(
+        HG_CORE_HANDLE_CLASS(hg_core_handle)->counters.handle_pool_count);
+#endif
+
+    /* Last handle of a destroyed pool frees it */
+    count = hg_atomic_decr32(&hg_core_handle_pool->count);
+    if (count == 0 && hg_atomic_get32(&hg_core_handle_pool->destroyed) &&
+        hg_atomic_cas32(&hg_core_handle_pool->destroyed, 1, 2))
+        hg_core_handle_pool_free(hg_core_handle_pool);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_handle_pool_insert(struct hg_core_private_context *context,
@@ -2567,11 +3666,18 @@ hg_core_handle_pool_insert(struct hg_core_private_context *context,
 
     /* Re-use handle on completion */
     hg_core_handle->reuse = true;
+    hg_core_handle->handle_pool = hg_core_handle_pool;
+    hg_atomic_incr32(&hg_core_handle_pool->count);
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    hg_atomic_incr64(
+        HG_CORE_CONTEXT_CLASS(context)->counters.handle_pool_count);
+#endif
 
     /* Add handle to pending list */
     hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
     LIST_INSERT_HEAD(
         &hg_core_handle_pool->pending_list.list, hg_core_handle, pending);
+    hg_atomic_incr32(&hg_core_handle_pool->pending_count);
     hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
 
     /* Handle is pre-posted only when muti-recv is off */
@@ -2591,9 +3697,11 @@ error:
         if (post) {
             hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
             LIST_REMOVE(hg_core_handle, pending);
+            hg_atomic_decr32(&hg_core_handle_pool->pending_count);
             hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
-        }
-        hg_core_handle->reuse = false;
+            hg_core_handle_pool_release(hg_core_handle_pool, hg_core_handle);
+        } else
+            hg_core_handle->reuse = false;
         (void) hg_core_destroy(hg_core_handle);
     }
 
@@ -2608,6 +3716,9 @@ hg_core_handle_pool_unpost(
     struct hg_core_private_handle *hg_core_handle;
     hg_return_t ret;
 
+    /* Handles inserted past that point would not be canceled */
+    hg_core_handle_pool_grow_wait(hg_core_handle_pool);
+
     if (hg_core_handle_pool->flags & HG_CORE_HANDLE_MULTI_RECV)
         return HG_SUCCESS; /* Nothing to do */
 
@@ -2640,26 +3751,194 @@ error:
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE unsigned int
-hg_core_map_hash(hg_hash_table_key_t key)
+static hg_return_t
+hg_core_map_init(struct hg_core_map *hg_core_map)
+{
+    struct hg_core_map_table *table;
+    hg_return_t ret;
+    int rc;
+
+    table = hg_core_map_table_alloc(HG_CORE_MAP_INIT_SIZE, NULL);
+    HG_CHECK_SUBSYS_ERROR(cls, table == NULL, error, ret, HG_NOMEM,
+        "Could not allocate RPC map table");
+
+    rc = hg_thread_mutex_init(&hg_core_map->lock);
+    HG_CHECK_SUBSYS_ERROR(cls, rc != HG_UTIL_SUCCESS, error, ret, HG_NOMEM,
+        "hg_thread_mutex_init() failed");
+
+    hg_atomic_init64(&hg_core_map->table, (int64_t) table);
+    hg_atomic_init32(&hg_core_map->epoch, 0);
+    hg_atomic_init32(&hg_core_map->readers[0], 0);
+    hg_atomic_init32(&hg_core_map->readers[1], 0);
+    hg_core_map->retired = NULL;
+    hg_core_map->removed = NULL;
+    hg_core_map->retired_prev = NULL;
+    hg_core_map->removed_prev = NULL;
+    hg_core_map->count = 0;
+    hg_core_map->used = 0;
+
+    return HG_SUCCESS;
+
+error:
+    free(table);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_map_finalize(struct hg_core_map *hg_core_map)
 {
-    return *((hg_id_t *) key) & 0xffffffff;
+    struct hg_core_map_table *table =
+        (struct hg_core_map_table *) hg_atomic_get64(&hg_core_map->table);
+    unsigned int i;
+
+    if (table == NULL)
+        return;
+
+    for (i = 0; i < table->size; i++) {
+        int64_t entry = hg_atomic_get64(&table->entries[i]);
+
+        if (entry != 0 && entry != HG_CORE_MAP_REMOVED)
+            hg_core_map_value_free((struct hg_core_rpc_info *) entry);
+    }
+    free(table);
+    hg_atomic_set64(&hg_core_map->table, 0);
+
+    hg_core_map_retired_free(hg_core_map->retired, hg_core_map->removed);
+    hg_core_map_retired_free(
+        hg_core_map->retired_prev, hg_core_map->removed_prev);
+
+    (void) hg_thread_mutex_destroy(&hg_core_map->lock);
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE int
-hg_core_map_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2)
+static struct hg_core_map_table *
+hg_core_map_table_alloc(
+    unsigned int size, const struct hg_core_map_table *old_table)
 {
-    return *((hg_id_t *) key1) == *((hg_id_t *) key2);
+    struct hg_core_map_table *table;
+    unsigned int i;
+
+    table = (struct hg_core_map_table *) calloc(
+        1, sizeof(*table) + size * sizeof(table->entries[0]));
+    if (table == NULL)
+        return NULL;
+    table->size = size;
+
+    if (old_table == NULL)
+        return table;
+
+    /* Re-insert entries, removed entries are dropped */
+    for (i = 0; i < old_table->size; i++) {
+        int64_t entry = hg_atomic_get64(&old_table->entries[i]);
+        unsigned int j;
+
+        if (entry == 0 || entry == HG_CORE_MAP_REMOVED)
+            continue;
+
+        j = hg_core_map_hash(((struct hg_core_rpc_info *) entry)->id) &
+            (size - 1);
+        while (hg_atomic_get64(&table->entries[j]) != 0)
+            j = (j + 1) & (size - 1);
+        hg_atomic_init64(&table->entries[j], entry);
+    }
+
+    return table;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_map_table_compact(
+    struct hg_core_map *hg_core_map, struct hg_core_map_table *table)
+{
+    unsigned int i, mask = table->size - 1;
+
+    /* A removed entry followed by an empty slot does not need to be skipped
+     * by any lookup, clearing it in place is therefore safe while lookups are
+     * in progress. Entries are never moved as concurrent lookups could then
+     * miss them. Table is never full so there is always an empty slot. */
+    for (i = 0; i < table->size; i++) {
+        unsigned int j = i;
+
+        if (hg_atomic_get64(&table->entries[i]) != 0 ||
+            hg_atomic_get64(&table->entries[(i - 1) & mask]) !=
+                HG_CORE_MAP_REMOVED)
+            continue;
+
+        do {
+            j = (j - 1) & mask;
+            hg_atomic_set64(&table->entries[j], 0);
+            hg_core_map->used--;
+        } while (hg_atomic_get64(&table->entries[(j - 1) & mask]) ==
+                 HG_CORE_MAP_REMOVED);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_map_reclaim(struct hg_core_map *hg_core_map)
+{
+    int i;
+
+    /* Advancing twice in a row frees everything that was retired if there
+     * are no lookups in progress */
+    for (i = 0; i < 2; i++) {
+        int32_t epoch = hg_atomic_get32(&hg_core_map->epoch);
+
+        if (hg_core_map->retired == NULL && hg_core_map->removed == NULL &&
+            hg_core_map->retired_prev == NULL &&
+            hg_core_map->removed_prev == NULL)
+            return;
+
+        /* Lookups of the previous epoch may still access what was retired
+         * since then. Read count with an atomic RMW so that it is ordered
+         * after the stores that unpublished retired tables and values. */
+        if (hg_atomic_or32(&hg_core_map->readers[epoch ^ 1], 0) != 0)
+            return;
+
+        hg_core_map_retired_free(
+            hg_core_map->retired_prev, hg_core_map->removed_prev);
+        hg_core_map->retired_prev = hg_core_map->retired;
+        hg_core_map->removed_prev = hg_core_map->removed;
+        hg_core_map->retired = NULL;
+        hg_core_map->removed = NULL;
+        hg_atomic_set32(&hg_core_map->epoch, epoch ^ 1);
+    }
 }
 
 /*---------------------------------------------------------------------------*/
 static void
-hg_core_map_value_free(hg_hash_table_value_t value)
+hg_core_map_retired_free(
+    struct hg_core_map_table *retired, struct hg_core_map_value *removed)
+{
+    while (retired != NULL) {
+        struct hg_core_map_table *table = retired;
+
+        retired = table->next;
+        free(table);
+    }
+
+    /* User data of removed values was already freed */
+    while (removed != NULL) {
+        struct hg_core_map_value *value = removed;
+
+        removed = value->next;
+        free(value);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned int
+hg_core_map_hash(hg_id_t id)
 {
-    struct hg_core_rpc_info *hg_core_rpc_info =
-        (struct hg_core_rpc_info *) value;
+    return (unsigned int) (id & 0xffffffff);
+}
 
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_map_value_free(struct hg_core_rpc_info *hg_core_rpc_info)
+{
     if (hg_core_rpc_info->free_callback)
         hg_core_rpc_info->free_callback(hg_core_rpc_info->data);
     free(hg_core_rpc_info);
@@ -2669,15 +3948,36 @@ hg_core_map_value_free(hg_hash_table_value_t value)
 static HG_INLINE struct hg_core_rpc_info *
 hg_core_map_lookup(struct hg_core_map *hg_core_map, hg_id_t *id)
 {
-    hg_hash_table_value_t value = NULL;
+    /* Tables are never modified in place other than for publishing or
+     * removing entries, and replaced tables and removed values are only freed
+     * once lookups of the epoch they were retired in have completed, lookups
+     * can therefore proceed without taking a lock */
+    int32_t epoch = hg_atomic_get32(&hg_core_map->epoch);
+    const struct hg_core_map_table *table;
+    struct hg_core_rpc_info *hg_core_rpc_info = NULL;
+    unsigned int i, n, mask;
 
-    /* Lookup key */
-    hg_thread_rwlock_rdlock(&hg_core_map->lock);
-    value = hg_hash_table_lookup(hg_core_map->map, (hg_hash_table_key_t) id);
-    hg_thread_rwlock_release_rdlock(&hg_core_map->lock);
+    hg_atomic_incr32(&hg_core_map->readers[epoch]);
 
-    return (value == HG_HASH_TABLE_NULL) ? NULL
-                                         : (struct hg_core_rpc_info *) value;
+    table =
+        (const struct hg_core_map_table *) hg_atomic_get64(&hg_core_map->table);
+    mask = table->size - 1;
+    for (i = hg_core_map_hash(*id) & mask, n = 0; n < table->size;
+         i = (i + 1) & mask, n++) {
+        int64_t entry = hg_atomic_get64(&table->entries[i]);
+
+        if (entry == 0)
+            break;
+        if (entry != HG_CORE_MAP_REMOVED &&
+            ((struct hg_core_rpc_info *) entry)->id == *id) {
+            hg_core_rpc_info = (struct hg_core_rpc_info *) entry;
+            break;
+        }
+    }
+
+    hg_atomic_decr32(&hg_core_map->readers[epoch]);
+
+    return hg_core_rpc_info;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2685,31 +3985,79 @@ static hg_return_t
 hg_core_map_insert(struct hg_core_map *hg_core_map, hg_id_t *id,
     struct hg_core_rpc_info **hg_core_rpc_info_p)
 {
+    struct hg_core_map_table *table;
     struct hg_core_rpc_info *hg_core_rpc_info;
+    struct hg_core_map_value *value;
+    unsigned int i, mask;
     hg_return_t ret;
-    int rc;
+
+    hg_thread_mutex_lock(&hg_core_map->lock);
+
+    /* Entry may have been inserted concurrently */
+    hg_core_rpc_info = hg_core_map_lookup(hg_core_map, id);
+    if (hg_core_rpc_info != NULL) {
+        hg_thread_mutex_unlock(&hg_core_map->lock);
+        *hg_core_rpc_info_p = hg_core_rpc_info;
+        return HG_SUCCESS;
+    }
 
     /* Allocate new RPC info */
-    hg_core_rpc_info =
-        (struct hg_core_rpc_info *) calloc(1, sizeof(*hg_core_rpc_info));
-    HG_CHECK_SUBSYS_ERROR(cls, hg_core_rpc_info == NULL, error, ret, HG_NOMEM,
+    value = (struct hg_core_map_value *) calloc(1, sizeof(*value));
+    HG_CHECK_SUBSYS_ERROR(cls, value == NULL, unlock, ret, HG_NOMEM,
         "Could not allocate HG core RPC info");
+    hg_core_rpc_info = &value->rpc_info;
     hg_core_rpc_info->id = *id;
 
-    hg_thread_rwlock_wrlock(&hg_core_map->lock);
-    rc = hg_hash_table_insert(hg_core_map->map,
-        (hg_hash_table_key_t) &hg_core_rpc_info->id,
-        (hg_hash_table_value_t) hg_core_rpc_info);
-    hg_thread_rwlock_release_wrlock(&hg_core_map->lock);
-    HG_CHECK_SUBSYS_ERROR(
-        cls, rc == 0, error, ret, HG_NOMEM, "hg_hash_table_insert() failed");
+    /* Keep table at most half full, clear removed entries in place first and
+     * replace table with a new table if that is not enough */
+    table = (struct hg_core_map_table *) hg_atomic_get64(&hg_core_map->table);
+    if ((hg_core_map->used + 1) * 2 > table->size &&
+        hg_core_map->used > hg_core_map->count)
+        hg_core_map_table_compact(hg_core_map, table);
+    if ((hg_core_map->used + 1) * 2 > table->size) {
+        unsigned int size = ((hg_core_map->count + 1) * 4 > table->size)
+                                ? table->size * 2
+                                : table->size;
+        struct hg_core_map_table *new_table =
+            hg_core_map_table_alloc(size, table);
+        HG_CHECK_SUBSYS_ERROR(cls, new_table == NULL, error, ret, HG_NOMEM,
+            "Could not allocate RPC map table");
+
+        /* Lookups may still access the previous table */
+        table->next = hg_core_map->retired;
+        hg_core_map->retired = table;
+        hg_atomic_set64(&hg_core_map->table, (int64_t) new_table);
+        hg_core_map->used = hg_core_map->count;
+        table = new_table;
+    }
+
+    /* Publish new entry */
+    mask = table->size - 1;
+    for (i = hg_core_map_hash(*id) & mask;; i = (i + 1) & mask) {
+        int64_t entry = hg_atomic_get64(&table->entries[i]);
+
+        if (entry == 0) {
+            hg_core_map->used++;
+            break;
+        }
+        if (entry == HG_CORE_MAP_REMOVED)
+            break;
+    }
+    hg_atomic_set64(&table->entries[i], (int64_t) hg_core_rpc_info);
+    hg_core_map->count++;
+
+    hg_core_map_reclaim(hg_core_map);
+
+    hg_thread_mutex_unlock(&hg_core_map->lock);
 
     *hg_core_rpc_info_p = hg_core_rpc_info;
 
     return HG_SUCCESS;
 
 error:
-    free(hg_core_rpc_info);
+    free(value);
+unlock:
+    hg_thread_mutex_unlock(&hg_core_map->lock);
 
     return ret;
 }
@@ -2718,19 +4066,51 @@ error:
 static hg_return_t
 hg_core_map_remove(struct hg_core_map *hg_core_map, hg_id_t *id)
 {
+    struct hg_core_map_table *table;
+    unsigned int i, n, mask;
     hg_return_t ret;
-    int rc;
 
-    /* Remove key */
-    hg_thread_rwlock_wrlock(&hg_core_map->lock);
-    rc = hg_hash_table_remove(hg_core_map->map, (hg_hash_table_key_t) id);
-    hg_thread_rwlock_release_wrlock(&hg_core_map->lock);
-    HG_CHECK_SUBSYS_ERROR(
-        cls, rc != 1, error, ret, HG_NOENTRY, "hg_hash_table_remove() failed");
+    hg_thread_mutex_lock(&hg_core_map->lock);
 
-    return HG_SUCCESS;
+    table = (struct hg_core_map_table *) hg_atomic_get64(&hg_core_map->table);
+    mask = table->size - 1;
+    for (i = hg_core_map_hash(*id) & mask, n = 0; n < table->size;
+         i = (i + 1) & mask, n++) {
+        int64_t entry = hg_atomic_get64(&table->entries[i]);
+
+        if (entry == 0)
+            break;
+        if (entry != HG_CORE_MAP_REMOVED &&
+            ((struct hg_core_rpc_info *) entry)->id == *id) {
+            struct hg_core_map_value *value =
+                (struct hg_core_map_value *) entry;
+            void (*free_callback)(void *) = value->rpc_info.free_callback;
+            void *data = value->rpc_info.data;
+
+            /* Slot remains used until it is compacted or table is replaced */
+            hg_atomic_set64(&table->entries[i], HG_CORE_MAP_REMOVED);
+            hg_core_map->count--;
+
+            /* Concurrent lookups may still be reading the value, only free
+             * user data now and keep the value until it can be reclaimed */
+            value->next = hg_core_map->removed;
+            hg_core_map->removed = value;
+            hg_core_map_reclaim(hg_core_map);
+            hg_thread_mutex_unlock(&hg_core_map->lock);
+
+            if (free_callback)
+                free_callback(data);
+
+            return HG_SUCCESS;
+        }
+    }
+
+    HG_GOTO_SUBSYS_ERROR(cls, error, ret, HG_NOENTRY,
+        "Could not find RPC ID (%" PRIu64 ") in RPC map", *id);
 
 error:
+    hg_thread_mutex_unlock(&hg_core_map->lock);
+
     return ret;
 }
 
@@ -3435,6 +4815,9 @@ hg_core_destroy(struct hg_core_private_handle *hg_core_handle)
         return HG_SUCCESS; /* Cannot free yet */
     }
 
+    /* Payload can no longer be copied out */
+    hg_core_multi_recv_claim(hg_core_handle);
+
 #if defined(HG_HAS_DEBUG) && !defined(_WIN32)
     if (hg_core_handle->active) {
         hg_atomic_decr64(HG_CORE_HANDLE_CLASS(hg_core_handle)
@@ -3462,6 +4845,11 @@ hg_core_destroy(struct hg_core_private_handle *hg_core_handle)
         HG_LOG_SUBSYS_DEBUG(
             rpc, "Freeing handle (%p)", (void *) hg_core_handle);
 
+        /* Pool handle that is not re-posted while unposting */
+        if (hg_core_handle->reuse)
+            hg_core_handle_pool_release(
+                hg_core_handle->handle_pool, hg_core_handle);
+
         /* Free extra data here if needed */
         if (hg_core_class->more_data_cb.release)
             hg_core_class->more_data_cb.release(
@@ -3799,21 +5187,15 @@ hg_core_reset_post(struct hg_core_private_handle *hg_core_handle)
     hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
     LIST_INSERT_HEAD(
         &hg_core_handle_pool->pending_list.list, hg_core_handle, pending);
+    hg_atomic_incr32(&hg_core_handle_pool->pending_count);
     hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
 
     if (use_multi_recv) {
-        if (multi_recv_op != NULL &&
-            hg_atomic_decr32(&multi_recv_op->ref_count) == 0 &&
-            hg_atomic_get32(&multi_recv_op->last)) {
-            HG_LOG_SUBSYS_DEBUG(
-                ctx, "Reposting multi-recv buffer %d", multi_recv_op->id);
-
-            /* Repost multi recv */
-            ret = hg_core_post_multi(multi_recv_op,
+        if (multi_recv_op != NULL) {
+            ret = hg_core_multi_recv_op_release(multi_recv_op,
                 hg_core_handle_pool->na_class, hg_core_handle_pool->na_context);
             HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret,
-                "Cannot repost multi-recv operation (%d)", multi_recv_op->id);
-            hg_atomic_incr32(&context->multi_recv_op_count);
+                "Cannot release multi-recv operation (%d)", multi_recv_op->id);
         }
     } else {
         /* Repost single recv */
@@ -3973,18 +5355,10 @@ hg_core_release_input(struct hg_core_private_handle *hg_core_handle)
         }
         hg_core_handle->multi_recv_op = NULL;
 
-        if (hg_atomic_decr32(&multi_recv_op->ref_count) == 0 &&
-            hg_atomic_get32(&multi_recv_op->last)) {
-            HG_LOG_SUBSYS_DEBUG(
-                ctx, "Reposting multi-recv buffer %d", multi_recv_op->id);
-
-            /* Repost multi recv */
-            ret = hg_core_post_multi(multi_recv_op,
-                hg_core_handle_pool->na_class, hg_core_handle_pool->na_context);
-            HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret,
-                "Cannot repost multi-recv operation (%d)", multi_recv_op->id);
-            hg_atomic_incr32(&context->multi_recv_op_count);
-        }
+        ret = hg_core_multi_recv_op_release(multi_recv_op,
+            hg_core_handle_pool->na_class, hg_core_handle_pool->na_context);
+        HG_CHECK_SUBSYS_HG_ERROR(ctx, error, ret,
+            "Cannot release multi-recv operation (%d)", multi_recv_op->id);
     }
 
     return HG_SUCCESS;
@@ -4135,7 +5509,7 @@ hg_core_forward_na(struct hg_core_private_handle *hg_core_handle)
 
     /* Generate tag */
     hg_core_handle->tag =
-        hg_core_gen_request_tag(HG_CORE_HANDLE_CLASS(hg_core_handle));
+        hg_core_gen_request_tag(HG_CORE_HANDLE_CONTEXT(hg_core_handle));
 
     /* Pre-post recv (output) if response is expected */
     if (!(hg_atomic_get32(&hg_core_handle->flags) & HG_CORE_NO_RESPONSE)) {
@@ -4506,6 +5880,7 @@ hg_core_recv_input_cb(const struct na_cb_info *callback_info)
     struct hg_core_handle_pool *hg_core_handle_pool;
     const struct na_cb_info_recv_unexpected *na_cb_info_recv_unexpected =
         &callback_info->info.recv_unexpected;
+    int32_t pending_count;
     hg_return_t ret;
 
 /* Remove handle from pending list */
@@ -4519,6 +5894,7 @@ hg_core_recv_input_cb(const struct na_cb_info *callback_info)
 #endif
     hg_thread_spin_lock(&hg_core_handle_pool->pending_list.lock);
     LIST_REMOVE(hg_core_handle, pending);
+    pending_count = hg_atomic_decr32(&hg_core_handle_pool->pending_count);
     hg_thread_spin_unlock(&hg_core_handle_pool->pending_list.lock);
 #if defined(HG_HAS_DEBUG) && !defined(_WIN32)
     /* Increment counter */
@@ -4528,18 +5904,22 @@ hg_core_recv_input_cb(const struct na_cb_info *callback_info)
 #endif
 
     if (callback_info->ret == NA_SUCCESS) {
-        /* Extend pool if all handles are being utilized */
+        /* Extend pool if all handles are being utilized, otherwise defer
+         * extension to next progress once below low watermark */
         if (hg_core_handle_pool->incr_count > 0 &&
-            !hg_atomic_get32(&context->unposting) &&
-            hg_core_handle_pool_empty(hg_core_handle_pool)) {
-            HG_LOG_SUBSYS_WARNING(perf,
-                "Pre-posted handles have all been consumed / are being "
-                "utilized, posting %u more",
-                hg_core_handle_pool->incr_count);
-
-            ret = hg_core_handle_pool_extend(hg_core_handle_pool);
-            HG_CHECK_SUBSYS_HG_ERROR(
-                rpc, error, ret, "Could not extend handle pool");
+            !hg_atomic_get32(&context->unposting)) {
+            if (pending_count == 0) {
+                HG_LOG_SUBSYS_WARNING(perf,
+                    "Pre-posted handles have all been consumed / are being "
+                    "utilized, posting %u more",
+                    hg_core_handle_pool->incr_count);
+
+                ret = hg_core_handle_pool_extend(hg_core_handle_pool);
+                HG_CHECK_SUBSYS_HG_ERROR(
+                    rpc, error, ret, "Could not extend handle pool");
+            } else if (pending_count < hg_core_handle_pool->low_watermark)
+                hg_atomic_cas32(&hg_core_handle_pool->grow,
+                    HG_CORE_POOL_GROW_NONE, HG_CORE_POOL_GROW_REQUESTED);
         }
 
         /* Fill unexpected info */
@@ -4583,7 +5963,7 @@ hg_core_recv_input_cb(const struct na_cb_info *callback_info)
             rpc, "NA_CANCELED event on handle %p", (void *) hg_core_handle);
 
         /* Prevent re-initialization */
-        hg_core_handle->reuse = false;
+        hg_core_handle_pool_release(hg_core_handle_pool, hg_core_handle);
 
         /* Clean up handle */
         (void) hg_core_destroy(hg_core_handle);
@@ -4592,7 +5972,7 @@ hg_core_recv_input_cb(const struct na_cb_info *callback_info)
             NA_Error_to_string(callback_info->ret));
 
         /* Prevent re-initialization */
-        hg_core_handle->reuse = false;
+        hg_core_handle_pool_release(hg_core_handle_pool, hg_core_handle);
 
         /* Clean up handle */
         (void) hg_core_destroy(hg_core_handle);
@@ -4621,6 +6001,7 @@ hg_core_multi_recv_input_cb(const struct na_cb_info *callback_info)
         *na_cb_info_multi_recv_unexpected =
             &callback_info->info.multi_recv_unexpected;
     struct hg_core_private_handle *hg_core_handle = NULL;
+    int32_t multi_recv_op_count;
     hg_return_t ret;
 
     if (callback_info->ret == NA_SUCCESS) {
@@ -4639,9 +6020,7 @@ hg_core_multi_recv_input_cb(const struct na_cb_info *callback_info)
         hg_atomic_or32(&hg_core_handle->status, HG_CORE_OP_MULTI_RECV);
         /* Prevent from reposting multi-recv buffer until done with handle */
         hg_atomic_incr32(&multi_recv_op->ref_count);
-        hg_core_handle->multi_recv_copy =
-            (unsigned int) hg_atomic_get32(&context->multi_recv_op_count) <=
-            HG_CORE_CONTEXT_CLASS(context)->init_info.multi_recv_copy_threshold;
+        hg_core_handle->multi_recv_copy = false;
 
         if (na_cb_info_multi_recv_unexpected->last) {
             HG_LOG_SUBSYS_DEBUG(rpc,
@@ -4649,19 +6028,33 @@ hg_core_multi_recv_input_cb(const struct na_cb_info *callback_info)
                 " operations completed)",
                 multi_recv_op->id, hg_atomic_get32(&multi_recv_op->op_count));
             hg_atomic_set32(&multi_recv_op->last, true);
-            if (hg_atomic_decr32(&context->multi_recv_op_count) == 0) {
-                unsigned int multi_recv_op_max =
-                    HG_CORE_CONTEXT_CLASS(context)->init_info.multi_recv_op_max;
+            multi_recv_op_count =
+                hg_atomic_decr32(&context->multi_recv_op_count);
+            if (multi_recv_op_count == 0) {
                 unsigned int i;
                 HG_LOG_SUBSYS_WARNING(ctx,
                     "All multi-recv buffers have been consumed, consider "
                     "increasing request_post_init init info in order to "
                     "increase initial buffer sizes");
-                for (i = 0; i < multi_recv_op_max; i++)
-                    HG_LOG_SUBSYS_WARNING(ctx,
-                        "Multi-recv buffer %d held by %d handles", i,
-                        hg_atomic_get32(&context->multi_recv_ops[i].ref_count));
+                for (i = 0; i < context->multi_recv_op_capacity; i++)
+                    if (hg_atomic_get32(&context->multi_recv_ops[i].allocated))
+                        HG_LOG_SUBSYS_WARNING(ctx,
+                            "Multi-recv buffer %u held by %d handles", i,
+                            hg_atomic_get32(
+                                &context->multi_recv_ops[i].ref_count));
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+                /* Increment counter */
+                hg_atomic_incr64(HG_CORE_CONTEXT_CLASS(context)
+                                     ->counters.rpc_multi_recv_starved_count);
+#endif
             }
+            /* Copy out pending payloads or add buffers on next progress */
+            if (multi_recv_op_count <
+                (int32_t) MAX(HG_CORE_CONTEXT_CLASS(context)
+                                      ->init_info.multi_recv_op_max /
+                                  2,
+                    1))
+                hg_atomic_set32(&context->multi_recv_replenish, 1);
         }
 
         /* Fill unexpected info */
@@ -4672,46 +6065,16 @@ hg_core_multi_recv_input_cb(const struct na_cb_info *callback_info)
         hg_core_handle->core_handle.in_buf_used =
             na_cb_info_multi_recv_unexpected->actual_buf_size;
 
-        /* Either copy the buffer to release early or point to the actual
-         * multi-recv buffer space to save a memcpy */
-        if (hg_core_handle->multi_recv_copy) {
-            HG_CHECK_SUBSYS_ERROR(rpc,
-                hg_core_handle->core_handle.in_buf_used >
-                    hg_core_handle->in_buf_storage_size,
-                error, ret, HG_OVERFLOW,
-                "Actual transfer size (%zu) is too large for unexpected recv",
-                hg_core_handle->core_handle.in_buf_used);
-            HG_LOG_SUBSYS_DEBUG(rpc,
-                "Copying multi-recv payload of size %zu for handle (%p)",
-                hg_core_handle->core_handle.in_buf_used,
-                (void *) hg_core_handle);
-#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
-            /* Increment counter */
-            hg_atomic_incr64(HG_CORE_CONTEXT_CLASS(context)
-                                 ->counters.rpc_multi_recv_copy_count);
-#endif
-
-            memcpy(hg_core_handle->in_buf_storage,
-                na_cb_info_multi_recv_unexpected->actual_buf,
-                hg_core_handle->core_handle.in_buf_used);
-            hg_core_handle->core_handle.in_buf_size =
-                hg_core_handle->in_buf_storage_size;
-            hg_core_handle->core_handle.in_buf = hg_core_handle->in_buf_storage;
-
-            ret = hg_core_release_input(hg_core_handle);
-            HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret,
-                "Could not release input for handle (%p)",
-                (void *) hg_core_handle);
-        } else {
-            HG_LOG_SUBSYS_DEBUG(rpc,
-                "Using direct multi-recv payload of size %zu for handle (%p)",
-                hg_core_handle->core_handle.in_buf_used,
-                (void *) hg_core_handle);
-            hg_core_handle->core_handle.in_buf_size =
-                hg_core_handle->core_handle.in_buf_used;
-            hg_core_handle->core_handle.in_buf =
-                na_cb_info_multi_recv_unexpected->actual_buf;
-        }
+        /* Point to the actual multi-recv buffer space to save a memcpy, the
+         * payload is only copied once it is known whether the buffer is needed
+         * and the RPC keeps its input */
+        HG_LOG_SUBSYS_DEBUG(rpc,
+            "Using direct multi-recv payload of size %zu for handle (%p)",
+            hg_core_handle->core_handle.in_buf_used, (void *) hg_core_handle);
+        hg_core_handle->core_handle.in_buf_size =
+            hg_core_handle->core_handle.in_buf_used;
+        hg_core_handle->core_handle.in_buf =
+            na_cb_info_multi_recv_unexpected->actual_buf;
 
         HG_LOG_SUBSYS_DEBUG(rpc,
             "Processing input for handle %p, tag=%u, buf_size=%zu",
@@ -4722,6 +6085,11 @@ hg_core_multi_recv_input_cb(const struct na_cb_info *callback_info)
         ret = hg_core_process_input(hg_core_handle);
         HG_CHECK_SUBSYS_HG_ERROR(rpc, error, ret, "Could not process input");
 
+        /* Payload may be copied out until request is processed if its buffer
+         * is needed */
+        hg_atomic_set32(
+            &hg_core_handle->multi_recv_state, HG_CORE_MULTI_RECV_IDLE);
+
         /* Complete operation */
         hg_core_complete_op(hg_core_handle);
     } else if (callback_info->ret == NA_CANCELED) {
@@ -5128,6 +6496,27 @@ hg_core_process(struct hg_core_private_handle *hg_core_handle)
     HG_CHECK_SUBSYS_ERROR(rpc, hg_core_rpc_info->rpc_cb == NULL, error, ret,
         HG_INVALID_ARG, "No RPC callback registered");
 
+    /* Copy payload before it is exposed to the RPC callback if multi-recv
+     * buffers are running low, unless the RPC releases its input promptly */
+    if (hg_core_handle->multi_recv_op != NULL &&
+        !hg_core_handle->multi_recv_copy &&
+        (unsigned int) hg_atomic_get32(
+            &HG_CORE_HANDLE_CONTEXT(hg_core_handle)->multi_recv_op_count) <=
+            HG_CORE_HANDLE_CLASS(hg_core_handle)
+                ->init_info.multi_recv_copy_threshold) {
+        if (hg_core_rpc_info->no_input_copy) {
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+            /* Increment counter */
+            hg_atomic_incr64(HG_CORE_HANDLE_CLASS(hg_core_handle)
+                                 ->counters.rpc_multi_recv_nocopy_count);
+#endif
+        } else {
+            ret = hg_core_multi_recv_copy(hg_core_handle);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                rpc, error, ret, "Could not copy multi-recv payload");
+        }
+    }
+
     /* Increment ref count here so that a call to HG_Destroy in user's RPC
      * callback does not free the handle but only schedules its completion
      */
@@ -5196,40 +6585,224 @@ hg_core_loopback_event_set(struct hg_core_private_context *context)
 
     hg_atomic_incr32(&context->loopback_notify.nevents);
 
-    rc = hg_event_set(context->loopback_notify.event);
-    HG_CHECK_SUBSYS_ERROR(poll, rc != HG_UTIL_SUCCESS, error, ret,
-        HG_PROTOCOL_ERROR, "Could not signal completion queue");
+    rc = hg_event_set(context->loopback_notify.event);
+    HG_CHECK_SUBSYS_ERROR(poll, rc != HG_UTIL_SUCCESS, error, ret,
+        HG_PROTOCOL_ERROR, "Could not signal completion queue");
+
+    return HG_SUCCESS;
+
+error:
+    hg_atomic_decr32(&context->loopback_notify.nevents);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_core_loopback_event_get(
+    struct hg_core_private_context *context, bool *notified_p)
+{
+    hg_return_t ret;
+    bool signaled;
+    int rc;
+
+    rc = hg_event_get(context->loopback_notify.event, &signaled);
+    HG_CHECK_SUBSYS_ERROR(poll, rc != HG_UTIL_SUCCESS, error, ret,
+        HG_PROTOCOL_ERROR, "Could not get loopback event notification");
+    if (signaled)
+        hg_atomic_decr32(&context->loopback_notify.nevents);
+
+    if (notified_p != NULL)
+        *notified_p = signaled;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_atomic_queue_init(
+    struct hg_core_atomic_queue *hg_core_atomic_queue, unsigned int size)
+{
+    struct hg_atomic_queue *hg_atomic_queue;
+    hg_return_t ret;
+    int i;
+
+    for (i = 0; i < HG_CORE_ATOMIC_QUEUE_SEGMENT_MAX; i++)
+        hg_atomic_init64(&hg_core_atomic_queue->segments[i], 0);
+    hg_atomic_init32(&hg_core_atomic_queue->segment_count, 0);
+    hg_core_atomic_queue->size = size;
+
+    hg_atomic_queue = hg_atomic_queue_alloc(size);
+    HG_CHECK_SUBSYS_ERROR(ctx, hg_atomic_queue == NULL, error, ret, HG_NOMEM,
+        "Could not allocate atomic queue (size=%u)", size);
+
+    hg_atomic_set64(
+        &hg_core_atomic_queue->segments[0], (int64_t) hg_atomic_queue);
+    hg_atomic_set32(&hg_core_atomic_queue->segment_count, 1);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_core_atomic_queue_finalize(struct hg_core_atomic_queue *hg_core_atomic_queue)
+{
+    int32_t i, segment_count =
+                   hg_atomic_get32(&hg_core_atomic_queue->segment_count);
+
+    for (i = 0; i < segment_count; i++) {
+        hg_atomic_queue_free((struct hg_atomic_queue *) hg_atomic_get64(
+            &hg_core_atomic_queue->segments[i]));
+        hg_atomic_set64(&hg_core_atomic_queue->segments[i], 0);
+    }
+    hg_atomic_set32(&hg_core_atomic_queue->segment_count, 0);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_atomic_queue_grow(
+    struct hg_core_atomic_queue *hg_core_atomic_queue, int32_t segment_count)
+{
+    struct hg_atomic_queue *hg_atomic_queue;
+    unsigned int size;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(ctx, segment_count >= HG_CORE_ATOMIC_QUEUE_SEGMENT_MAX,
+        error, ret, HG_OVERFLOW,
+        "Reached max number of completion queue segments (%d)",
+        HG_CORE_ATOMIC_QUEUE_SEGMENT_MAX);
+    HG_CHECK_SUBSYS_ERROR(ctx,
+        hg_core_atomic_queue->size > (UINT_MAX >> segment_count), error, ret,
+        HG_OVERFLOW, "Completion queue segment size would overflow");
+    size = hg_core_atomic_queue->size << segment_count;
+
+    /* Segments are only added, never removed, so that concurrent producers
+     * and consumers can keep accessing them without further synchronization.
+     * Only one thread can install the new segment, others free theirs. */
+    if (hg_atomic_get64(&hg_core_atomic_queue->segments[segment_count]) == 0) {
+        hg_atomic_queue = hg_atomic_queue_alloc(size);
+        HG_CHECK_SUBSYS_ERROR(ctx, hg_atomic_queue == NULL, error, ret,
+            HG_NOMEM, "Could not allocate atomic queue (size=%u)", size);
+
+        if (!hg_atomic_cas64(&hg_core_atomic_queue->segments[segment_count], 0,
+                (int64_t) hg_atomic_queue))
+            hg_atomic_queue_free(hg_atomic_queue);
+        else
+            HG_LOG_SUBSYS_DEBUG(ctx,
+                "Added completion queue segment %" PRId32 " (size=%u)",
+                segment_count, size);
+    }
+
+    /* Segment is now installed, publish it */
+    (void) hg_atomic_cas32(&hg_core_atomic_queue->segment_count,
+        segment_count, segment_count + 1);
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_core_atomic_queue_push(
+    struct hg_core_atomic_queue *hg_core_atomic_queue, void *entry)
+{
+    for (;;) {
+        int32_t segment_count =
+            hg_atomic_get32(&hg_core_atomic_queue->segment_count);
+        struct hg_atomic_queue *hg_atomic_queue =
+            (struct hg_atomic_queue *) hg_atomic_get64(
+                &hg_core_atomic_queue->segments[segment_count - 1]);
+        hg_return_t ret;
+
+        /* Always push to the last (largest) segment so that previous
+         * segments eventually drain */
+        if (hg_atomic_queue_push(hg_atomic_queue, entry) == HG_UTIL_SUCCESS)
+            return HG_SUCCESS;
+
+        ret = hg_core_atomic_queue_grow(hg_core_atomic_queue, segment_count);
+        if (ret != HG_SUCCESS)
+            return ret;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void *
+hg_core_atomic_queue_pop(struct hg_core_atomic_queue *hg_core_atomic_queue)
+{
+    int32_t i, segment_count =
+                   hg_atomic_get32(&hg_core_atomic_queue->segment_count);
+
+    /* Pop from oldest segments first */
+    for (i = 0; i < segment_count; i++) {
+        void *entry = hg_atomic_queue_pop_mc((struct hg_atomic_queue *)
+                hg_atomic_get64(&hg_core_atomic_queue->segments[i]));
+        if (entry != NULL)
+            return entry;
+    }
+
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE unsigned int
+hg_core_atomic_queue_pop_n(struct hg_core_atomic_queue *hg_core_atomic_queue,
+    void **entries, unsigned int count)
+{
+    int32_t i, segment_count =
+                   hg_atomic_get32(&hg_core_atomic_queue->segment_count);
+    unsigned int n = 0;
 
-    return HG_SUCCESS;
+    /* Pop from oldest segments first, reserving as many entries as
+     * possible from each segment at once */
+    for (i = 0; i < segment_count && n < count; i++) {
+        struct hg_atomic_queue *hg_atomic_queue =
+            (struct hg_atomic_queue *) hg_atomic_get64(
+                &hg_core_atomic_queue->segments[i]);
 
-error:
-    hg_atomic_decr32(&context->loopback_notify.nevents);
+        n += hg_atomic_queue_pop_mc_n(hg_atomic_queue, entries + n, count - n);
+    }
 
-    return ret;
+    return n;
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE hg_return_t
-hg_core_loopback_event_get(
-    struct hg_core_private_context *context, bool *notified_p)
+static HG_INLINE unsigned int
+hg_core_atomic_queue_count(
+    const struct hg_core_atomic_queue *hg_core_atomic_queue)
 {
-    hg_return_t ret;
-    bool signaled;
-    int rc;
+    int32_t i, segment_count =
+                   hg_atomic_get32(&hg_core_atomic_queue->segment_count);
+    unsigned int count = 0;
 
-    rc = hg_event_get(context->loopback_notify.event, &signaled);
-    HG_CHECK_SUBSYS_ERROR(poll, rc != HG_UTIL_SUCCESS, error, ret,
-        HG_PROTOCOL_ERROR, "Could not get loopback event notification");
-    if (signaled)
-        hg_atomic_decr32(&context->loopback_notify.nevents);
+    for (i = 0; i < segment_count; i++)
+        count += hg_atomic_queue_count((const struct hg_atomic_queue *)
+                hg_atomic_get64(&hg_core_atomic_queue->segments[i]));
 
-    if (notified_p != NULL)
-        *notified_p = signaled;
+    return count;
+}
 
-    return HG_SUCCESS;
+/*---------------------------------------------------------------------------*/
+static HG_INLINE bool
+hg_core_atomic_queue_is_empty(
+    const struct hg_core_atomic_queue *hg_core_atomic_queue)
+{
+    int32_t i, segment_count =
+                   hg_atomic_get32(&hg_core_atomic_queue->segment_count);
 
-error:
-    return ret;
+    for (i = 0; i < segment_count; i++)
+        if (!hg_atomic_queue_is_empty((const struct hg_atomic_queue *)
+                    hg_atomic_get64(&hg_core_atomic_queue->segments[i])))
+            return false;
+
+    return true;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -5240,7 +6813,7 @@ hg_core_completion_add(struct hg_core_context *core_context,
     struct hg_core_private_context *context =
         (struct hg_core_private_context *) core_context;
     struct hg_core_completion_queue *backfill_queue = &context->backfill_queue;
-    int rc;
+    hg_return_t ret;
 
 #if defined(HG_HAS_DEBUG) && !defined(_WIN32)
     /* Increment counter */
@@ -5248,12 +6821,14 @@ hg_core_completion_add(struct hg_core_context *core_context,
         hg_atomic_incr64(HG_CORE_CONTEXT_CLASS(context)->counters.bulk_count);
 #endif
 
-    rc = hg_atomic_queue_push(context->completion_queue, hg_completion_entry);
-    if (rc != HG_UTIL_SUCCESS) {
-        HG_LOG_SUBSYS_WARNING(perf, "Atomic completion queue is full, pushing "
-                                    "completion data to backfill queue");
+    ret = hg_core_atomic_queue_push(
+        &context->completion_queue, hg_completion_entry);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_SUBSYS_WARNING(perf, "Atomic completion queue cannot grow, "
+                                    "pushing completion data to backfill "
+                                    "queue");
 
-        /* Queue is full */
+        /* Queue cannot grow */
         hg_thread_mutex_lock(&backfill_queue->mutex);
         STAILQ_INSERT_TAIL(&backfill_queue->queue, hg_completion_entry, entry);
         hg_atomic_incr32(&backfill_queue->count);
@@ -5261,10 +6836,15 @@ hg_core_completion_add(struct hg_core_context *core_context,
     }
 
     /* Callback is pushed to the completion queue when something completes
-     * so wake up anyone waiting in trigger */
-    hg_thread_mutex_lock(&backfill_queue->mutex);
-    hg_thread_cond_signal(&backfill_queue->cond);
-    hg_thread_mutex_unlock(&backfill_queue->mutex);
+     * so wake up anyone waiting in trigger. Waiters register themselves
+     * before checking the queue, use an atomic RMW here so that either the
+     * entry is seen by the waiter or the waiter is seen by us, this allows
+     * for skipping the mutex entirely when no one is waiting. */
+    if (hg_atomic_or32(&backfill_queue->waiters, 0) > 0) {
+        hg_thread_mutex_lock(&backfill_queue->mutex);
+        hg_thread_cond_signal(&backfill_queue->cond);
+        hg_thread_mutex_unlock(&backfill_queue->mutex);
+    }
 
     /* Do not bother notifying if it's not needed as any event call will
      * increase latency */
@@ -5279,7 +6859,7 @@ hg_core_completion_get(struct hg_core_private_context *context)
 {
     struct hg_completion_entry *hg_completion_entry = NULL;
 
-    hg_completion_entry = hg_atomic_queue_pop_mc(context->completion_queue);
+    hg_completion_entry = hg_core_atomic_queue_pop(&context->completion_queue);
     if (hg_completion_entry == NULL) { /* Check backfill queue */
         struct hg_core_completion_queue *backfill_queue =
             &context->backfill_queue;
@@ -5298,6 +6878,30 @@ hg_core_completion_get(struct hg_core_private_context *context)
     return hg_completion_entry;
 }
 
+/*---------------------------------------------------------------------------*/
+static unsigned int
+hg_core_completion_get_n(struct hg_core_private_context *context,
+    struct hg_completion_entry **entries, unsigned int count)
+{
+    struct hg_core_completion_queue *backfill_queue = &context->backfill_queue;
+    unsigned int n;
+
+    n = hg_core_atomic_queue_pop_n(
+        &context->completion_queue, (void **) entries, count);
+    if (n < count && hg_atomic_get32(&backfill_queue->count) > 0) {
+        /* Check backfill queue */
+        hg_thread_mutex_lock(&backfill_queue->mutex);
+        while (n < count && hg_atomic_get32(&backfill_queue->count) > 0) {
+            entries[n++] = STAILQ_FIRST(&backfill_queue->queue);
+            STAILQ_REMOVE_HEAD(&backfill_queue->queue, entry);
+            hg_atomic_decr32(&backfill_queue->count);
+        }
+        hg_thread_mutex_unlock(&backfill_queue->mutex);
+    }
+
+    return n;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_completion_wait(
@@ -5307,10 +6911,13 @@ hg_core_completion_wait(
     hg_return_t ret = HG_SUCCESS;
 
     hg_thread_mutex_lock(&backfill_queue->mutex);
+    /* Must register as a waiter before checking completion count */
+    hg_atomic_incr32(&backfill_queue->waiters);
     if ((hg_core_completion_count(context) == 0) &&
         (hg_thread_cond_timedwait(&backfill_queue->cond, &backfill_queue->mutex,
              timeout_ms) != HG_UTIL_SUCCESS))
         ret = HG_TIMEOUT;
+    hg_atomic_decr32(&backfill_queue->waiters);
     hg_thread_mutex_unlock(&backfill_queue->mutex);
 
     return ret;
@@ -5320,33 +6927,53 @@ hg_core_completion_wait(
 static HG_INLINE unsigned int
 hg_core_completion_count(const struct hg_core_private_context *context)
 {
-    return hg_atomic_queue_count(context->completion_queue) +
+    return hg_core_atomic_queue_count(&context->completion_queue) +
            (unsigned int) hg_atomic_get32(&context->backfill_queue.count);
 }
 
 /*---------------------------------------------------------------------------*/
-static void
-hg_core_completion_trigger(struct hg_completion_entry *hg_completion_entry)
+static bool
+hg_core_completion_trigger(struct hg_completion_entry *hg_completion_entry,
+    struct hg_completion_cb_info *cb_info_p)
 {
     /* Trigger entry */
     switch (hg_completion_entry->op_type) {
         case HG_ADDR:
-            hg_core_trigger_lookup_entry(
-                hg_completion_entry->op_id.hg_core_op_id);
-            break;
+            return hg_core_trigger_lookup_entry(
+                hg_completion_entry->op_id.hg_core_op_id, cb_info_p);
         case HG_RPC:
-            hg_core_trigger_entry(
+            return hg_core_trigger_entry(
                 (struct hg_core_private_handle *)
-                    hg_completion_entry->op_id.hg_core_handle);
-            break;
+                    hg_completion_entry->op_id.hg_core_handle,
+                cb_info_p);
         case HG_BULK:
-            hg_bulk_trigger_entry(hg_completion_entry->op_id.hg_bulk_op_id);
-            break;
+            return hg_bulk_trigger_entry(
+                hg_completion_entry->op_id.hg_bulk_op_id, cb_info_p);
         default:
             HG_LOG_SUBSYS_ERROR(poll, "Invalid type of completion entry (%d)",
                 (int) hg_completion_entry->op_type);
-            break;
+            return false;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE bool
+hg_core_completion_cb(hg_core_cb_t callback,
+    const struct hg_core_cb_info *hg_core_cb_info,
+    struct hg_completion_cb_info *cb_info_p)
+{
+    if (cb_info_p == NULL) {
+        (void) callback(hg_core_cb_info);
+        return false;
     }
+
+    /* Defer callback execution to caller */
+    cb_info_p->callback.core = callback;
+    cb_info_p->info.core = *hg_core_cb_info;
+    cb_info_p->op_type =
+        (hg_core_cb_info->type == HG_CB_LOOKUP) ? HG_ADDR : HG_RPC;
+
+    return true;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -5370,9 +6997,16 @@ static hg_return_t
 hg_core_progress_wait(
     struct hg_core_private_context *context, unsigned int timeout_ms)
 {
+    uint8_t progress_mode =
+        HG_CORE_CONTEXT_CLASS(context)->init_info.progress_mode;
+    bool adaptive = (progress_mode & NA_ADAPTIVE_POLL) && context->poll_set;
     hg_time_t deadline, now = hg_time_from_ms(0);
     hg_return_t ret;
 
+    /* Grow or shrink pools outside of NA callbacks */
+    ret = hg_core_context_check_pools(context);
+    HG_CHECK_SUBSYS_HG_ERROR(poll, error, ret, "Could not check context pools");
+
     if (timeout_ms != 0)
         hg_time_get_current_ms(&now);
     deadline = hg_time_add(now, hg_time_from_ms(timeout_ms));
@@ -5381,6 +7015,22 @@ hg_core_progress_wait(
         bool safe_wait = false, progressed = false;
         unsigned int poll_timeout = 0;
 
+        /* Busy-poll first if events are frequent enough */
+        if (adaptive && timeout_ms != 0) {
+            adaptive = false; /* Only once */
+            ret = hg_core_progress_spin(context,
+                hg_time_to_ms(hg_time_subtract(deadline, now)), &progressed);
+            HG_CHECK_SUBSYS_HG_ERROR(
+                poll, error, ret, "Could not busy-poll on context");
+            if (progressed) {
+                hg_core_adaptive_poll_update(&context->adaptive_poll);
+                return HG_SUCCESS;
+            }
+            hg_time_get_current_ms(&now);
+            if (!hg_time_less(now, deadline))
+                break;
+        }
+
         /* Bypass notifications if timeout_ms is 0 to prevent system calls */
         if (timeout_ms == 0) {
             ; // nothing to do
@@ -5407,8 +7057,11 @@ hg_core_progress_wait(
         }
 
         /* We progressed or we have something to trigger */
-        if (progressed || (hg_core_completion_count(context) > 0))
+        if (progressed || (hg_core_completion_count(context) > 0)) {
+            if (progress_mode & NA_ADAPTIVE_POLL)
+                hg_core_adaptive_poll_update(&context->adaptive_poll);
             return HG_SUCCESS;
+        }
 
         if (timeout_ms != 0)
             hg_time_get_current_ms(&now);
@@ -5420,6 +7073,71 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_core_progress_spin(struct hg_core_private_context *context,
+    unsigned int timeout_ms, bool *progressed_p)
+{
+    hg_time_t deadline, now;
+    double window = 2.0 * context->adaptive_poll.interval_avg;
+    hg_return_t ret;
+
+    *progressed_p = false;
+
+    /* Events are too sparse, do not waste cycles */
+    if (window > (double) HG_CORE_ADAPTIVE_POLL_MAX_US / 1.0e6)
+        return HG_SUCCESS;
+    if (window > (double) timeout_ms / 1.0e3)
+        window = (double) timeout_ms / 1.0e3;
+
+    hg_time_get_current(&now);
+    deadline = hg_time_add(now, hg_time_from_double(window));
+
+    do {
+        unsigned int count = 0;
+
+        ret = hg_core_progress(context, &count);
+        HG_CHECK_SUBSYS_HG_ERROR(poll, error, ret, "Could not make progress");
+
+        if (count > 0) {
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+            /* Increment counter */
+            hg_atomic_incr64(
+                HG_CORE_CONTEXT_CLASS(context)->counters.poll_spin_count);
+#endif
+            *progressed_p = true;
+            break;
+        }
+
+        hg_time_get_current(&now);
+    } while (hg_time_less(now, deadline));
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_core_adaptive_poll_update(struct hg_core_adaptive_poll *adaptive_poll)
+{
+    hg_time_t now;
+    double interval;
+
+    hg_time_get_current(&now);
+    interval = hg_time_diff(now, adaptive_poll->last_event);
+
+    /* Bound contribution of idle periods so that busy-polling resumes quickly
+     * once events become frequent again */
+    if (interval > (double) HG_CORE_ADAPTIVE_POLL_INTERVAL_US / 1.0e6)
+        interval = (double) HG_CORE_ADAPTIVE_POLL_INTERVAL_US / 1.0e6;
+
+    adaptive_poll->interval_avg +=
+        (interval - adaptive_poll->interval_avg) / HG_CORE_ADAPTIVE_POLL_WEIGHT;
+    adaptive_poll->last_event = now;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_poll_wait(struct hg_core_private_context *context,
@@ -5446,7 +7164,14 @@ hg_core_poll_wait(struct hg_core_private_context *context,
         return HG_SUCCESS;
     }
 
-    /* Process events */
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+    /* Increment counter */
+    if (nevents > 0)
+        hg_atomic_incr64(
+            HG_CORE_CONTEXT_CLASS(context)->counters.poll_wake_count);
+#endif
+
+    /* Process all ready events, each source is progressed once */
     for (i = 0; i < nevents; i++) {
         bool progressed_event = false;
         unsigned int count = 0;
@@ -5484,6 +7209,12 @@ hg_core_poll_wait(struct hg_core_private_context *context,
                     (int) poll_events[i].data.u32);
         }
         progressed |= progressed_event;
+
+#if defined(HG_HAS_DEBUG) && !defined(_WIN32)
+        /* Increment counter */
+        hg_atomic_incr64(
+            HG_CORE_CONTEXT_CLASS(context)->counters.poll_event_count);
+#endif
     }
 
     *progressed_p = progressed;
@@ -5726,7 +7457,7 @@ hg_core_trigger_wait(struct hg_core_private_context *context,
             HG_FAULT, "NULL completion entry");
 
         /* Trigger entry */
-        hg_core_completion_trigger(hg_completion_entry);
+        (void) hg_core_completion_trigger(hg_completion_entry, NULL);
 
         count++;
     }
@@ -5754,7 +7485,7 @@ hg_core_trigger(struct hg_core_private_context *context, unsigned int max_count,
             break;
 
         /* Trigger entry */
-        hg_core_completion_trigger(hg_completion_entry);
+        (void) hg_core_completion_trigger(hg_completion_entry, NULL);
 
         count++;
     }
@@ -5764,9 +7495,72 @@ hg_core_trigger(struct hg_core_private_context *context, unsigned int max_count,
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE void
-hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id)
+hg_return_t
+hg_core_trigger_batch(struct hg_core_context *core_context,
+    unsigned int timeout_ms, unsigned int max_count,
+    struct hg_completion_cb_info *cb_infos, unsigned int *actual_count_p)
+{
+    struct hg_core_private_context *context =
+        (struct hg_core_private_context *) core_context;
+    struct hg_completion_entry *entries[HG_CORE_TRIGGER_BATCH_MAX];
+    hg_time_t deadline, now = hg_time_from_ms(0);
+    unsigned int count = 0, processed = 0;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (timeout_ms != 0)
+        hg_time_get_current_ms(&now);
+    deadline = hg_time_add(now, hg_time_from_ms(timeout_ms));
+
+    while (count < max_count) {
+        unsigned int i, n;
+
+        /* Reserve as many entries as we can return */
+        n = hg_core_completion_get_n(context, entries,
+            MIN(max_count - count, HG_CORE_TRIGGER_BATCH_MAX));
+        if (n == 0) {
+            /* If something was already processed leave */
+            if (processed > 0)
+                break;
+
+            /* Timeout is 0 so leave */
+            if (!hg_time_less(now, deadline)) {
+                ret = HG_TIMEOUT;
+                break;
+            }
+
+            /* Otherwise wait remaining ms */
+            ret = hg_core_completion_wait(
+                context, hg_time_to_ms(hg_time_subtract(deadline, now)));
+            if (ret == HG_TIMEOUT) /* Timeout occurred so leave */
+                break;
+
+            if (timeout_ms != 0)
+                hg_time_get_current_ms(&now);
+            continue; /* Give another change to grab it */
+        }
+
+        /* Entries that do not complete a user operation (e.g., RPC
+         * handlers) are still triggered internally */
+        for (i = 0; i < n; i++)
+            if (hg_core_completion_trigger(entries[i], &cb_infos[count]))
+                count++;
+
+        processed += n;
+    }
+
+    if (actual_count_p)
+        *actual_count_p = count;
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE bool
+hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id,
+    struct hg_completion_cb_info *cb_info_p)
 {
+    bool ret = false;
+
     /* Execute callback */
     if (hg_core_op_id->callback) {
         struct hg_core_cb_info hg_core_cb_info = {.arg = hg_core_op_id->arg,
@@ -5775,65 +7569,78 @@ hg_core_trigger_lookup_entry(struct hg_core_op_id *hg_core_op_id)
             .info.lookup.addr =
                 (hg_core_addr_t) hg_core_op_id->info.lookup.hg_core_addr};
 
-        hg_core_op_id->callback(&hg_core_cb_info);
+        ret = hg_core_completion_cb(
+            hg_core_op_id->callback, &hg_core_cb_info, cb_info_p);
     }
 
     /* NB. OK to free after callback execution, op ID is not re-used */
     free(hg_core_op_id);
+
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE void
-hg_core_trigger_entry(struct hg_core_private_handle *hg_core_handle)
+static HG_INLINE bool
+hg_core_trigger_entry(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p)
 {
+    bool ret;
+
     hg_atomic_and32(&hg_core_handle->status, ~HG_CORE_OP_QUEUED);
 
     HG_LOG_SUBSYS_DEBUG(rpc, "Triggering callback type %s",
         hg_core_op_type_to_string(hg_core_handle->op_type));
 
-    hg_core_handle->ops.trigger(hg_core_handle);
+    ret = hg_core_handle->ops.trigger(hg_core_handle, cb_info_p);
+    if (ret) {
+        /* Callback info references handle, caller must release it */
+        int32_t HG_DEBUG_LOG_USED ref_count =
+            hg_atomic_incr32(&hg_core_handle->ref_count);
+        HG_LOG_SUBSYS_DEBUG(rpc_ref, "Handle (%p) ref_count incr to %" PRId32,
+            (void *) hg_core_handle, ref_count);
+    }
 
     /* Reuse handle if we were listening, otherwise destroy it */
     (void) hg_core_destroy(hg_core_handle);
+
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE void
-hg_core_trigger_self(struct hg_core_private_handle *hg_core_handle)
+static HG_INLINE bool
+hg_core_trigger_self(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p)
 {
     switch (hg_core_handle->op_type) {
         case HG_CORE_PROCESS:
             hg_core_trigger_process(hg_core_handle);
-            break;
+            return false;
         case HG_CORE_FORWARD:
-            hg_core_trigger_forward_cb(hg_core_handle);
-            break;
+            return hg_core_trigger_forward_cb(hg_core_handle, cb_info_p);
         case HG_CORE_RESPOND:
-            hg_core_trigger_self_respond_cb(hg_core_handle);
-            break;
+            return hg_core_trigger_self_respond_cb(hg_core_handle, cb_info_p);
         default:
             HG_LOG_SUBSYS_ERROR(rpc, "Invalid core operation type");
-            break;
+            return false;
     }
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE void
-hg_core_trigger_na(struct hg_core_private_handle *hg_core_handle)
+static HG_INLINE bool
+hg_core_trigger_na(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p)
 {
     switch (hg_core_handle->op_type) {
         case HG_CORE_PROCESS:
             hg_core_trigger_process(hg_core_handle);
-            break;
+            return false;
         case HG_CORE_FORWARD:
-            hg_core_trigger_forward_cb(hg_core_handle);
-            break;
+            return hg_core_trigger_forward_cb(hg_core_handle, cb_info_p);
         case HG_CORE_RESPOND:
-            hg_core_trigger_respond_cb(hg_core_handle);
-            break;
+            return hg_core_trigger_respond_cb(hg_core_handle, cb_info_p);
         default:
             HG_LOG_SUBSYS_ERROR(rpc, "Invalid core operation type");
-            break;
+            return false;
     }
 }
 
@@ -5844,6 +7651,9 @@ hg_core_trigger_process(struct hg_core_private_handle *hg_core_handle)
     hg_return_t ret;
     int32_t flags;
 
+    /* Payload can no longer be copied out */
+    hg_core_multi_recv_claim(hg_core_handle);
+
     /* Silently exit if error occurred */
     if (hg_core_handle->ret != HG_SUCCESS)
         return;
@@ -5872,8 +7682,9 @@ hg_core_trigger_process(struct hg_core_private_handle *hg_core_handle)
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE void
-hg_core_trigger_forward_cb(struct hg_core_private_handle *hg_core_handle)
+static HG_INLINE bool
+hg_core_trigger_forward_cb(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p)
 {
     if (hg_core_handle->request_callback) {
         struct hg_core_cb_info hg_core_cb_info = {
@@ -5882,13 +7693,17 @@ hg_core_trigger_forward_cb(struct hg_core_private_handle *hg_core_handle)
             .type = HG_CB_FORWARD,
             .info.forward.handle = (hg_core_handle_t) hg_core_handle};
 
-        (void) hg_core_handle->request_callback(&hg_core_cb_info);
+        return hg_core_completion_cb(
+            hg_core_handle->request_callback, &hg_core_cb_info, cb_info_p);
     }
+
+    return false;
 }
 
 /*---------------------------------------------------------------------------*/
-static HG_INLINE void
-hg_core_trigger_respond_cb(struct hg_core_private_handle *hg_core_handle)
+static HG_INLINE bool
+hg_core_trigger_respond_cb(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p)
 {
     if (hg_core_handle->response_callback) {
         struct hg_core_cb_info hg_core_cb_info = {
@@ -5897,15 +7712,20 @@ hg_core_trigger_respond_cb(struct hg_core_private_handle *hg_core_handle)
             .type = HG_CB_RESPOND,
             .info.respond.handle = (hg_core_handle_t) hg_core_handle};
 
-        (void) hg_core_handle->response_callback(&hg_core_cb_info);
+        return hg_core_completion_cb(
+            hg_core_handle->response_callback, &hg_core_cb_info, cb_info_p);
     }
+
+    return false;
 }
 
 /*---------------------------------------------------------------------------*/
-static void
-hg_core_trigger_self_respond_cb(struct hg_core_private_handle *hg_core_handle)
+static bool
+hg_core_trigger_self_respond_cb(struct hg_core_private_handle *hg_core_handle,
+    struct hg_completion_cb_info *cb_info_p)
 {
     int32_t HG_DEBUG_LOG_USED ref_count, HG_DEBUG_LOG_USED expected_count;
+    bool captured = false;
     hg_return_t ret;
 
     /* Increment number of expected completions */
@@ -5926,7 +7746,8 @@ hg_core_trigger_self_respond_cb(struct hg_core_private_handle *hg_core_handle)
             .type = HG_CB_RESPOND,
             .info.respond.handle = (hg_core_handle_t) hg_core_handle};
 
-        (void) hg_core_handle->response_callback(&hg_core_cb_info);
+        captured = hg_core_completion_cb(
+            hg_core_handle->response_callback, &hg_core_cb_info, cb_info_p);
     }
 
     /* Assign forward callback back to handle */
@@ -5941,6 +7762,8 @@ hg_core_trigger_self_respond_cb(struct hg_core_private_handle *hg_core_handle)
 
     /* Mark as completed */
     hg_core_complete_op(hg_core_handle);
+
+    return captured;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -6486,6 +8309,58 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_registered_disable_input_copy(
+    hg_core_class_t *hg_core_class, hg_id_t id, uint8_t disable)
+{
+    struct hg_core_private_class *private_class =
+        (struct hg_core_private_class *) hg_core_class;
+    struct hg_core_rpc_info *hg_core_rpc_info = NULL;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(cls, hg_core_class == NULL, error, ret,
+        HG_INVALID_ARG, "NULL HG core class");
+
+    hg_core_rpc_info = hg_core_map_lookup(&private_class->rpc_map, &id);
+    HG_CHECK_SUBSYS_ERROR(cls, hg_core_rpc_info == NULL, error, ret, HG_NOENTRY,
+        "Could not find RPC ID (%" PRIu64 ") in RPC map", id);
+
+    hg_core_rpc_info->no_input_copy = disable;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Core_registered_disabled_input_copy(
+    hg_core_class_t *hg_core_class, hg_id_t id, uint8_t *disabled_p)
+{
+    struct hg_core_private_class *private_class =
+        (struct hg_core_private_class *) hg_core_class;
+    struct hg_core_rpc_info *hg_core_rpc_info = NULL;
+    hg_return_t ret;
+
+    HG_CHECK_SUBSYS_ERROR(cls, hg_core_class == NULL, error, ret,
+        HG_INVALID_ARG, "NULL HG core class");
+    HG_CHECK_SUBSYS_ERROR(cls, disabled_p == NULL, error, ret, HG_INVALID_ARG,
+        "NULL pointer to disabled flag");
+
+    hg_core_rpc_info = hg_core_map_lookup(&private_class->rpc_map, &id);
+    HG_CHECK_SUBSYS_ERROR(cls, hg_core_rpc_info == NULL, error, ret, HG_NOENTRY,
+        "Could not find RPC ID (%" PRIu64 ") in RPC map", id);
+
+    *disabled_p = hg_core_rpc_info->no_input_copy;
+
+    return HG_SUCCESS;
+
+error:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Core_addr_lookup1(hg_core_context_t *context, hg_core_cb_t callback,
@@ -7212,6 +9087,11 @@ HG_Core_event_progress(hg_core_context_t *context, unsigned int *count_p)
     HG_CHECK_SUBSYS_ERROR(poll, context == NULL, error, ret, HG_INVALID_ARG,
         "NULL HG core context");
 
+    ret =
+        hg_core_context_check_pools((struct hg_core_private_context *) context);
+    HG_CHECK_SUBSYS_HG_ERROR(poll, error, ret,
+        "Could not check pools of context (%p)", (void *) context);
+
     ret = hg_core_progress((struct hg_core_private_context *) context, count_p);
     HG_CHECK_SUBSYS_HG_ERROR(
         poll, error, ret, "Could not progress context (%p)", (void *) context);
@@ -575,6 +575,41 @@ HG_PUBLIC hg_return_t
 HG_Core_registered_disabled_response(
     hg_core_class_t *hg_core_class, hg_id_t id, uint8_t *disabled_p);
 
+/**
+ * Disable copy of input payload for a given RPC ID. When multi-recv is used
+ * and multi_recv_copy_threshold is reached, the input payload of an RPC is
+ * normally copied before the RPC callback is executed so that the multi-recv
+ * buffer it was received in can be reposted. Disabling that copy lets the RPC
+ * callback use the payload in place; the RPC callback must then release it
+ * promptly by calling HG_Core_release_input() or HG_Core_destroy().
+ *
+ * \param hg_core_class [IN]    pointer to HG core class
+ * \param id [IN]               registered function ID
+ * \param disable [IN]          boolean (HG_TRUE to disable
+ *                                       HG_FALSE to re-enable)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Core_registered_disable_input_copy(
+    hg_core_class_t *hg_core_class, hg_id_t id, uint8_t disable);
+
+/**
+ * Check if input copy is disabled for a given RPC ID
+ * (i.e., HG_Core_registered_disable_input_copy() has been called for this RPC
+ * ID).
+ *
+ * \param hg_core_class [IN]    pointer to HG core class
+ * \param id [IN]               registered function ID
+ * \param disabled_p [OUT]      boolean (HG_TRUE if disabled
+ *                                       HG_FALSE if enabled)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Core_registered_disabled_input_copy(
+    hg_core_class_t *hg_core_class, hg_id_t id, uint8_t *disabled_p);
+
 /**
  * Lookup an addr from a peer address/name. Addresses need to be
  * freed by calling HG_Core_addr_free(). After completion, user callback is
@@ -1115,6 +1150,7 @@ struct hg_core_rpc_info {
     void (*free_callback)(void *); /* User data free callback */
     hg_id_t id;                    /* RPC ID */
     uint8_t no_response;           /* RPC response not expected */
+    uint8_t no_input_copy;         /* RPC input never copied */
 };
 
 /* HG core handle */
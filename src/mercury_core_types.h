@@ -107,16 +107,79 @@ struct hg_init_info {
     /* Controls the number of multi-recv buffers that are posted. Incrementing
      * this value may be beneficial in cases where RPC handles remain in use for
      * longer periods of time and release_input_early is not set, preventing
-     * existing buffers from being reposted.
+     * existing buffers from being reposted. When buffers run low, payloads of
+     * requests not yet processed are copied out and up to 4 times that number
+     * of buffers may be posted until load decreases.
      * Default value is: 4 */
     unsigned int multi_recv_op_max;
 
     /* Controls when we should start copying data in an effort to release
-     * multi-recv buffers. Copy will occur when at most
-     * multi_recv_copy_threshold buffers remain. Value should not exceed
-     * multi_recv_op_max.
+     * multi-recv buffers. Copy will occur before an RPC callback is executed
+     * when at most multi_recv_copy_threshold buffers remain, unless input copy
+     * was disabled for that RPC. Value should not exceed multi_recv_op_max.
      * Default value is: 0 (never copy) */
     unsigned int multi_recv_copy_threshold;
+
+    /* Controls the initial number of entries of the per-context completion
+     * queue. The queue grows without locking by adding segments of twice the
+     * previous size when it becomes full. Value must be a power of 2, a value
+     * of zero is equivalent to using the internal default value.
+     * Default value is: 1024 */
+    unsigned int completion_queue_size;
+
+    /* Split bulk transfers that go through NA into operations of at most
+     * bulk_chunk_size bytes. Chunks are pipelined, with a new chunk posted
+     * each time one completes, and complete as a single bulk operation. This
+     * may be used to stay within transport limits or to overlap transfers of
+     * very large buffers.
+     * Default value is: 0 (no chunking) */
+    size_t bulk_chunk_size;
+
+    /* Controls the max number of chunks in flight for a single bulk transfer
+     * when bulk_chunk_size is set.
+     * Default value is: 8 */
+    unsigned int bulk_chunk_window;
+
+    /* Cache NA memory registrations of bulk handles created on user memory
+     * so that handles that are repeatedly created on the same buffers do not
+     * register them again. Unused registrations are released in LRU order
+     * once the cached registrations exceed bulk_reg_cache_size bytes. When
+     * set, HG_Bulk_cache_invalidate() must be called before memory that was
+     * exposed through bulk handles is unmapped or freed.
+     * Default value is: 0 (no caching) */
+    size_t bulk_reg_cache_size;
+
+    /* Replaces the default eager bulk policy, which only embeds the data of
+     * read-only bulk handles when it fits in the remaining space of the RPC
+     * buffer. When set, data of read-only bulk handles that is at most
+     * bulk_eager_threshold bytes is always embedded, using the overflow
+     * buffer if needed, and larger data is never embedded. Data that was
+     * embedded is then copied locally by HG_Bulk_transfer() on the target
+     * without any RMA operation. Has no effect if no_bulk_eager is set and is
+     * ignored if no_overflow is set. Can be overridden per RPC with
+     * HG_Registered_set_bulk_eager_threshold().
+     * Default value is: 0 (embed only if data fits) */
+    size_t bulk_eager_threshold;
+
+    /* Local copies of bulk data, i.e., transfers to self and pulls of eager
+     * data, of at least bulk_nt_copy_threshold bytes use non-temporal stores
+     * so that copying large buffers does not evict the contents of the CPU
+     * caches. This is only supported on x86 and ignored elsewhere.
+     * Default value is: 0 (regular copies) */
+    size_t bulk_nt_copy_threshold;
+
+    /* Extend pools of pre-posted handles that run low from a separate thread
+     * instead of from progress, so that progress is not delayed by the
+     * allocation and posting of new handles. This requires the NA class to be
+     * thread-safe and is ignored if the NA class was externally initialized.
+     * Default is: false (pools are extended from progress) */
+    bool request_post_thread;
+
+    /* Number of eager message buffers hint that is passed to NA in place of
+     * the msg_buf_count field of NA init info, which cannot be set through
+     * the embedded na_init_info struct (currently used by the na+sm plugin).
+     * Default is 0 (plugin default) */
+    unsigned int msg_buf_count;
 };
 
 /* Error return codes:
@@ -200,6 +263,19 @@ struct hg_diag_counters {
     uint64_t rpc_multi_recv_copy_count; /* RPCs requests received that
                                                      required a copy */
     uint64_t bulk_count;                /* Bulk transfer count */
+    uint64_t poll_wake_count;           /* Poll wake-ups with events */
+    uint64_t poll_event_count;          /* Events processed after wake-ups */
+    uint64_t poll_spin_count;           /* Progress made while busy-polling */
+    uint64_t handle_pool_count;         /* Handles allocated in pools */
+    uint64_t handle_pool_grow_count;    /* Handle pool extensions */
+    uint64_t handle_pool_shrink_count;  /* Handle pool shrinks when idle */
+    uint64_t rpc_multi_recv_starved_count; /* Multi-recv buffers consumed */
+    uint64_t rpc_multi_recv_nocopy_count;  /* RPCs requests that skipped
+                                              a copy */
+    uint64_t bulk_na_op_pool_hit_count;    /* Bulk transfers using pooled
+                                              NA op IDs */
+    uint64_t bulk_reg_cache_hit_count;     /* Registrations found in cache */
+    uint64_t bulk_reg_cache_miss_count;    /* Registrations not in cache */
 };
 
 /*****************/
@@ -229,7 +305,11 @@ struct hg_diag_counters {
         .no_bulk_eager = false, .no_loopback = false, .stats = false,          \
         .no_multi_recv = false, .release_input_early = false,                  \
         .no_overflow = false, .multi_recv_op_max = 0,                          \
-        .multi_recv_copy_threshold = 0                                         \
+        .multi_recv_copy_threshold = 0, .completion_queue_size = 0,            \
+        .bulk_chunk_size = 0, .bulk_chunk_window = 0,                          \
+        .bulk_reg_cache_size = 0, .bulk_eager_threshold = 0,                   \
+        .bulk_nt_copy_threshold = 0, .request_post_thread = false,             \
+        .msg_buf_count = 0                                                     \
     }
 
 #endif /* MERCURY_CORE_TYPES_H */
@@ -9,6 +9,7 @@
 #define MERCURY_PRIVATE_H
 
 #include "mercury_core.h"
+#include "mercury_types.h"
 
 #include "mercury_queue.h"
 
@@ -17,6 +18,25 @@
 /*************************************/
 
 /* Previous versions of init info to keep compatiblity with older versions */
+struct hg_init_info_2_4 {
+    struct na_init_info_4_0 na_init_info;
+    na_class_t *na_class;
+    uint32_t request_post_init;
+    int32_t request_post_incr;
+    uint8_t auto_sm;
+    const char *sm_info_string;
+    hg_checksum_level_t checksum_level;
+    uint8_t no_bulk_eager;
+    uint8_t no_loopback;
+    uint8_t stats;
+    uint8_t no_multi_recv;
+    uint8_t release_input_early;
+    enum na_traffic_class traffic_class;
+    bool no_overflow;
+    unsigned int multi_recv_op_max;
+    unsigned int multi_recv_copy_threshold;
+};
+
 struct hg_init_info_2_3 {
     struct na_init_info_4_0 na_init_info;
     na_class_t *na_class;
@@ -66,7 +86,21 @@ struct hg_completion_entry {
     hg_op_type_t op_type;
 };
 
+/* Callback info returned by batched trigger instead of executing callback */
+struct hg_completion_cb_info {
+    union {
+        hg_core_cb_t core; /* HG_ADDR / HG_RPC */
+        hg_cb_t bulk;      /* HG_BULK */
+    } callback;
+    union {
+        struct hg_core_cb_info core; /* HG_ADDR / HG_RPC */
+        struct hg_cb_info bulk;      /* HG_BULK */
+    } info;
+    hg_op_type_t op_type;
+};
+
 struct hg_bulk_op_pool;
+struct hg_bulk_reg_cache;
 
 /*****************/
 /* Public Macros */
@@ -102,6 +136,9 @@ extern "C" {
  * Duplicate init info for ABI compatibility.
  */
 static HG_INLINE void
+hg_init_info_dup_2_4(
+    struct hg_init_info *new_info, const struct hg_init_info_2_4 *old_info);
+static HG_INLINE void
 hg_init_info_dup_2_3(
     struct hg_init_info *new_info, const struct hg_init_info_2_3 *old_info);
 static HG_INLINE void
@@ -120,6 +157,44 @@ hg_core_bulk_incr(hg_core_class_t *hg_core_class);
 HG_PRIVATE void
 hg_core_bulk_decr(hg_core_class_t *hg_core_class);
 
+/**
+ * Increment counter of bulk transfers using pooled NA op IDs.
+ */
+HG_PRIVATE void
+hg_core_bulk_na_op_pool_hit(hg_core_class_t *hg_core_class);
+
+/**
+ * Get bulk chunk size (0 if transfers are not chunked) and max number of
+ * chunks in flight.
+ */
+HG_PRIVATE void
+hg_core_bulk_get_chunk_info(hg_core_class_t *hg_core_class,
+    size_t *chunk_size_p, uint32_t *chunk_window_p);
+
+/**
+ * Get size from which local bulk copies use non-temporal stores (0 if never).
+ */
+HG_PRIVATE size_t
+hg_core_bulk_get_nt_copy_threshold(hg_core_class_t *hg_core_class);
+
+/**
+ * Get bulk registration cache (NULL if registrations are not cached).
+ */
+HG_PRIVATE struct hg_bulk_reg_cache *
+hg_core_bulk_get_reg_cache(hg_core_class_t *hg_core_class);
+
+/**
+ * Increment counter of bulk registrations found in cache.
+ */
+HG_PRIVATE void
+hg_core_bulk_reg_cache_hit(hg_core_class_t *hg_core_class);
+
+/**
+ * Increment counter of bulk registrations not found in cache.
+ */
+HG_PRIVATE void
+hg_core_bulk_reg_cache_miss(hg_core_class_t *hg_core_class);
+
 /**
  * Get bulk op pool.
  */
@@ -134,10 +209,26 @@ hg_core_completion_add(struct hg_core_context *core_context,
     struct hg_completion_entry *hg_completion_entry, bool loopback_notify);
 
 /**
- * Trigger callback from bulk op ID.
+ * Trigger up to max_count completion entries, callbacks that complete user
+ * operations are not executed, their info is returned in cb_infos instead.
+ * When callback info references an RPC handle or bulk handles, caller must
+ * release them.
  */
-HG_PRIVATE void
-hg_bulk_trigger_entry(struct hg_bulk_op_id *hg_bulk_op_id);
+HG_PRIVATE hg_return_t
+hg_core_trigger_batch(struct hg_core_context *core_context,
+    unsigned int timeout_ms, unsigned int max_count,
+    struct hg_completion_cb_info *cb_infos, unsigned int *actual_count_p);
+
+/**
+ * Trigger callback from bulk op ID. If cb_info_p is not NULL, callback is not
+ * executed and its info is returned instead, along with a reference to the
+ * origin and local handles that caller must release.
+ *
+ * \return true if callback info was returned
+ */
+HG_PRIVATE bool
+hg_bulk_trigger_entry(
+    struct hg_bulk_op_id *hg_bulk_op_id, struct hg_completion_cb_info *cb_info_p);
 
 /**
  * Create pool of bulk op IDs.
@@ -152,6 +243,51 @@ hg_bulk_op_pool_create(hg_core_context_t *core_context, unsigned int init_count,
 HG_PRIVATE void
 hg_bulk_op_pool_destroy(struct hg_bulk_op_pool *hg_bulk_op_pool);
 
+/**
+ * Create cache of NA memory registrations that keeps up to max_size bytes
+ * registered.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_reg_cache_create(hg_core_class_t *core_class, size_t max_size,
+    struct hg_bulk_reg_cache **hg_bulk_reg_cache_p);
+
+/**
+ * Destroy cache of NA memory registrations.
+ */
+HG_PRIVATE void
+hg_bulk_reg_cache_destroy(struct hg_bulk_reg_cache *hg_bulk_reg_cache);
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_init_info_dup_2_4(
+    struct hg_init_info *new_info, const struct hg_init_info_2_4 *old_info)
+{
+    *new_info = (struct hg_init_info){.na_init_info = old_info->na_init_info,
+        .na_class = old_info->na_class,
+        .request_post_init = old_info->request_post_init,
+        .request_post_incr = old_info->request_post_incr,
+        .auto_sm = old_info->auto_sm,
+        .sm_info_string = old_info->sm_info_string,
+        .checksum_level = old_info->checksum_level,
+        .no_bulk_eager = old_info->no_bulk_eager,
+        .no_loopback = old_info->no_loopback,
+        .stats = old_info->stats,
+        .no_multi_recv = old_info->no_multi_recv,
+        .release_input_early = old_info->release_input_early,
+        .traffic_class = old_info->traffic_class,
+        .no_overflow = old_info->no_overflow,
+        .multi_recv_op_max = old_info->multi_recv_op_max,
+        .multi_recv_copy_threshold = old_info->multi_recv_copy_threshold,
+        .completion_queue_size = 0,
+        .bulk_chunk_size = 0,
+        .bulk_chunk_window = 0,
+        .bulk_reg_cache_size = 0,
+        .bulk_eager_threshold = 0,
+        .bulk_nt_copy_threshold = 0,
+        .request_post_thread = false,
+        .msg_buf_count = 0};
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE void
 hg_init_info_dup_2_3(
@@ -172,7 +308,15 @@ hg_init_info_dup_2_3(
         .traffic_class = NA_TC_UNSPEC,
         .no_overflow = false,
         .multi_recv_op_max = 0,
-        .multi_recv_copy_threshold = 0};
+        .multi_recv_copy_threshold = 0,
+        .completion_queue_size = 0,
+        .bulk_chunk_size = 0,
+        .bulk_chunk_window = 0,
+        .bulk_reg_cache_size = 0,
+        .bulk_eager_threshold = 0,
+        .bulk_nt_copy_threshold = 0,
+        .request_post_thread = false,
+        .msg_buf_count = 0};
 }
 
 /*---------------------------------------------------------------------------*/
@@ -195,7 +339,15 @@ hg_init_info_dup_2_2(
         .traffic_class = NA_TC_UNSPEC,
         .no_overflow = false,
         .multi_recv_op_max = 0,
-        .multi_recv_copy_threshold = 0};
+        .multi_recv_copy_threshold = 0,
+        .completion_queue_size = 0,
+        .bulk_chunk_size = 0,
+        .bulk_chunk_window = 0,
+        .bulk_reg_cache_size = 0,
+        .bulk_eager_threshold = 0,
+        .bulk_nt_copy_threshold = 0,
+        .request_post_thread = false,
+        .msg_buf_count = 0};
 }
 
 #ifdef __cplusplus
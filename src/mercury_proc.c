@@ -182,6 +182,7 @@ hg_proc_reset(hg_proc_t proc, void *buf, hg_size_t buf_size, hg_proc_op_t op)
 
     /* Reset flags */
     hg_proc->flags = 0;
+    hg_proc->bulk_eager_threshold = 0;
 
     /* Reset proc buf */
     hg_proc->proc_buf.buf = buf;
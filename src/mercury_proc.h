@@ -307,6 +307,30 @@ hg_proc_set_flags(hg_proc_t proc, uint8_t flags);
 static HG_INLINE uint8_t
 hg_proc_get_flags(hg_proc_t proc);
 
+/**
+ * Set the max size of bulk data that is embedded when encoding bulk handles
+ * with the HG_PROC_BULK_EAGER flag set. When set, data of read-only bulk
+ * handles that is at most threshold bytes is always embedded, even if that
+ * requires an extra buffer, and larger data is never embedded. A value of 0
+ * only embeds data when it fits in the remaining buffer space.
+ * Threshold is reset to 0 after a call to hg_proc_reset().
+ *
+ * \param proc [IN]             abstract processor object
+ * \param threshold [IN]        max size of embedded bulk data
+ */
+static HG_INLINE void
+hg_proc_set_bulk_eager_threshold(hg_proc_t proc, hg_size_t threshold);
+
+/**
+ * Get the max size of bulk data that is embedded when encoding bulk handles.
+ *
+ * \param proc [IN]             abstract processor object
+ *
+ * \return Non-negative size value
+ */
+static HG_INLINE hg_size_t
+hg_proc_get_bulk_eager_threshold(hg_proc_t proc);
+
 /**
  * Get buffer size available for processing.
  *
@@ -616,7 +640,8 @@ struct hg_proc {
 #endif
     hg_proc_op_t op;
     uint8_t flags;
-    hg_handle_t handle; /* HG handle */
+    hg_handle_t handle;             /* HG handle */
+    hg_size_t bulk_eager_threshold; /* Max size of embedded bulk data */
 };
 
 /*---------------------------------------------------------------------------*/
@@ -661,6 +686,20 @@ hg_proc_get_flags(hg_proc_t proc)
     return ((struct hg_proc *) proc)->flags;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_proc_set_bulk_eager_threshold(hg_proc_t proc, hg_size_t threshold)
+{
+    ((struct hg_proc *) proc)->bulk_eager_threshold = threshold;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+hg_proc_get_bulk_eager_threshold(hg_proc_t proc)
+{
+    return ((struct hg_proc *) proc)->bulk_eager_threshold;
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_size_t
 hg_proc_get_size(hg_proc_t proc)
@@ -59,13 +59,19 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
 
             /* Try to make everything fit in an eager buffer */
             if (hg_proc_get_flags(proc) & HG_PROC_BULK_EAGER) {
+                hg_size_t threshold = hg_proc_get_bulk_eager_threshold(proc);
+
                 HG_LOG_SUBSYS_DEBUG(proc, "Proc size left is %" PRIu64 " bytes",
                     hg_proc_get_size_left(proc));
                 buf_size = HG_Bulk_get_serialize_size(
                     *bulk_ptr, HG_BULK_EAGER | flags);
 
-                if (hg_proc_get_size_left(proc) >=
-                    (buf_size + sizeof(uint64_t)))
+                /* When a threshold is set, small data is always embedded
+                 * (possibly overflowing) and larger data never is */
+                if (threshold > 0)
+                    try_eager = (HG_Bulk_get_size(*bulk_ptr) <= threshold);
+                else if (hg_proc_get_size_left(proc) >=
+                         (buf_size + sizeof(uint64_t)))
                     try_eager = true;
             }
             if (try_eager) {
@@ -44,6 +44,7 @@ typedef enum hg_mem_type {
 struct hg_bulk_attr {
     hg_mem_type_t mem_type; /*!< Memory type */
     uint64_t device;        /*!< Optional device ID */
+    bool shared;            /*!< Allocate memory that local peers can map */
 };
 
 /**
@@ -802,8 +802,11 @@ NA_Initialize_opt2(const char *info_string, bool listen, unsigned int version,
             NA_MAJOR(version), NA_MINOR(version));
 
         /* Get init info and overwrite defaults */
-        if (NA_VERSION_GE(version, NA_VERSION(5, 0)))
+        if (NA_VERSION_GE(version, NA_VERSION(5, 1)))
             na_info->na_init_info = *na_init_info;
+        else if (NA_VERSION_GE(version, NA_VERSION(5, 0)))
+            na_init_info_dup_5_0(&na_info->na_init_info,
+                (const struct na_init_info_5_0 *) na_init_info);
         else
             na_init_info_dup_4_0(&na_info->na_init_info,
                 (const struct na_init_info_4_0 *) na_init_info);
@@ -812,7 +815,7 @@ NA_Initialize_opt2(const char *info_string, bool listen, unsigned int version,
             "NA Init info: ip_subnet=%s, auth_key=%s, max_unexpected_size=%zu, "
             "max_expected_size=%zu, progress_mode=%" PRIu8
             ", addr_format=%d, max_contexts=%" PRIu8 ", thread_mode=%" PRIu8
-            ", request_mem_device=%u, traffic_class=%d",
+            ", request_mem_device=%u, traffic_class=%d, msg_buf_count=%u",
             na_info->na_init_info.ip_subnet, na_info->na_init_info.auth_key,
             na_info->na_init_info.max_unexpected_size,
             na_info->na_init_info.max_expected_size,
@@ -821,7 +824,8 @@ NA_Initialize_opt2(const char *info_string, bool listen, unsigned int version,
             na_info->na_init_info.max_contexts,
             na_info->na_init_info.thread_mode,
             na_info->na_init_info.request_mem_device,
-            na_info->na_init_info.traffic_class);
+            na_info->na_init_info.traffic_class,
+            na_info->na_init_info.msg_buf_count);
 
         na_private_class->na_class.progress_mode = na_init_info->progress_mode;
     }
@@ -1571,6 +1575,67 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+void *
+NA_Mem_alloc(na_class_t *na_class, size_t buf_size, unsigned long flags,
+    void **plugin_data_p)
+{
+    void *ret = NULL;
+
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, na_class == NULL, error, "NULL NA class");
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, buf_size == 0, error, "NULL buffer size");
+    NA_CHECK_SUBSYS_ERROR_NORET(
+        mem, plugin_data_p == NULL, error, "NULL pointer to plugin data");
+
+    if (na_class->ops && na_class->ops->mem_alloc) {
+        ret =
+            na_class->ops->mem_alloc(na_class, buf_size, flags, plugin_data_p);
+        NA_CHECK_SUBSYS_ERROR_NORET(mem, ret == NULL, error,
+            "Could not allocate buffer of size %zu", buf_size);
+    } else {
+        size_t page_size = (size_t) hg_mem_get_page_size();
+
+        ret = hg_mem_aligned_alloc(page_size, buf_size);
+        NA_CHECK_SUBSYS_ERROR_NORET(mem, ret == NULL, error,
+            "Could not allocate buffer of size %zu", buf_size);
+        memset(ret, 0, buf_size);
+        *plugin_data_p = (void *) 1; /* Sanity check on free */
+    }
+
+    NA_LOG_SUBSYS_DEBUG(mem,
+        "Allocated mem buffer (%p), size (%zu bytes), plugin data (%p)", ret,
+        buf_size, *plugin_data_p);
+
+    return ret;
+
+error:
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+NA_Mem_free(na_class_t *na_class, void *buf, void *plugin_data)
+{
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, na_class == NULL, error, "NULL NA class");
+
+    if (buf == NULL)
+        return;
+
+    NA_LOG_SUBSYS_DEBUG(
+        mem, "Freeing mem buffer (%p), plugin data (%p)", buf, plugin_data);
+
+    if (na_class->ops && na_class->ops->mem_free) {
+        na_class->ops->mem_free(na_class, buf, plugin_data);
+    } else {
+        NA_CHECK_SUBSYS_WARNING(
+            mem, plugin_data != (void *) 1, "Invalid plugin data value");
+        hg_mem_aligned_free(buf);
+    }
+
+error:
+    return;
+}
+
 /*---------------------------------------------------------------------------*/
 na_return_t
 NA_Mem_handle_create(na_class_t *na_class, void *buf, size_t buf_size,
@@ -664,6 +664,39 @@ NA_Msg_recv_expected(na_class_t *na_class, na_context_t *context,
     na_cb_t callback, void *arg, void *buf, size_t buf_size, void *plugin_data,
     na_addr_t *source_addr, uint8_t source_id, na_tag_t tag, na_op_id_t *op_id);
 
+/**
+ * Allocate buf_size bytes of memory for RMA operations and return a pointer
+ * to the allocated memory. Plugins may back that memory so that local peers
+ * can access it directly once it is registered, e.g., NA SM allocates it
+ * from a shared-memory file that peers map and copy from/to without
+ * going through CMA. If size is 0, NA_Mem_alloc() returns NULL. The
+ * plugin_data output parameter can be used by the underlying plugin
+ * implementation to store internal memory information.
+ *
+ * \param na_class [IN/OUT]     pointer to NA class
+ * \param buf_size [IN]         buffer size
+ * \param flags [IN]            optional flags
+ * \param plugin_data_p [OUT]   pointer to internal plugin data
+ *
+ * \return Pointer to allocated memory or NULL in case of failure
+ */
+NA_PUBLIC void *
+NA_Mem_alloc(na_class_t *na_class, size_t buf_size, unsigned long flags,
+    void **plugin_data_p) NA_WARN_UNUSED_RESULT;
+
+/**
+ * The NA_Mem_free() function releases the memory space pointed to by buf,
+ * which must have been returned by a previous call to NA_Mem_alloc().
+ * Memory handles created on that memory must be freed first.
+ * If buf is NULL, no operation is performed.
+ *
+ * \param na_class [IN/OUT]     pointer to NA class
+ * \param buf [IN]              pointer to buffer
+ * \param plugin_data [IN]      pointer to internal plugin data
+ */
+NA_PUBLIC void
+NA_Mem_free(na_class_t *na_class, void *buf, void *plugin_data);
+
 /**
  * Create memory handle for RMA operations.
  * For non-contiguous memory, use NA_Mem_handle_create_segments() instead.
@@ -1104,8 +1137,29 @@ struct na_class_ops {
         unsigned int timeout_ms, unsigned int *count_p);
     na_return_t (*cancel)(
         na_class_t *na_class, na_context_t *context, na_op_id_t *op_id);
+    void *(*mem_alloc)(na_class_t *na_class, size_t buf_size,
+        unsigned long flags, void **plugin_data_p);
+    void (*mem_free)(na_class_t *na_class, void *buf, void *plugin_data);
 };
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE void
+na_init_info_dup_5_0(
+    struct na_init_info *new_info, const struct na_init_info_5_0 *old_info)
+{
+    *new_info = (struct na_init_info){.ip_subnet = old_info->ip_subnet,
+        .auth_key = old_info->auth_key,
+        .max_unexpected_size = old_info->max_unexpected_size,
+        .max_expected_size = old_info->max_expected_size,
+        .progress_mode = old_info->progress_mode,
+        .addr_format = old_info->addr_format,
+        .max_contexts = old_info->max_contexts,
+        .thread_mode = old_info->thread_mode,
+        .request_mem_device = old_info->request_mem_device,
+        .traffic_class = old_info->traffic_class,
+        .msg_buf_count = 0};
+}
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE void
 na_init_info_dup_4_0(
@@ -1120,7 +1174,8 @@ na_init_info_dup_4_0(
         .max_contexts = old_info->max_contexts,
         .thread_mode = old_info->thread_mode,
         .request_mem_device = old_info->request_mem_device,
-        .traffic_class = NA_TC_UNSPEC};
+        .traffic_class = NA_TC_UNSPEC,
+        .msg_buf_count = 0};
 }
 
 /*---------------------------------------------------------------------------*/
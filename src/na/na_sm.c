@@ -16,6 +16,7 @@
 #include "mercury_hash_table.h"
 #include "mercury_mem.h"
 #include "mercury_poll.h"
+#include "mercury_thread.h"
 #include "mercury_thread_mutex.h"
 #include "mercury_thread_rwlock.h"
 #include "mercury_thread_spin.h"
@@ -68,15 +69,33 @@
 /* Max filename length used for shared files */
 #define NA_SM_MAX_FILENAME 64
 
-/* Max number of shared-memory buffers (reserved by 64-bit atomic integer) */
-#define NA_SM_NUM_BUFS 64
+/* Number of shared-memory buffers reserved by each 64-bit atomic integer */
+#define NA_SM_COPY_BUF_WORD_BITS 64
 
-/* Size of shared-memory buffer */
-#define NA_SM_COPY_BUF_SIZE NA_SM_PAGE_SIZE
+/* Default and max number of shared-memory buffers (index is 16 bits) */
+#define NA_SM_COPY_BUF_COUNT_DEFAULT 64
+#define NA_SM_COPY_BUF_COUNT_MAX     4096
+
+/* Default and max size of shared-memory buffers */
+#define NA_SM_COPY_BUF_SIZE_DEFAULT NA_SM_PAGE_SIZE
+#define NA_SM_COPY_BUF_SIZE_MAX     (1024 * 1024)
+
+/* Number of entries in msg queues */
+#define NA_SM_MSG_QUEUE_SIZE 64
+
+/* Round up to multiple of */
+#define NA_SM_ROUND_UP(x, a) ((((x) + (a) - 1) / (a)) * (a))
 
 /* Max number of fds used for cleanup */
 #define NA_SM_CLEANUP_NFDS 16
 
+/* Number of expected op queues (power of 2), indexed by addr/tag hash */
+#define NA_SM_EXPECTED_OP_QUEUE_BITS  8
+#define NA_SM_EXPECTED_OP_QUEUE_COUNT (1 << NA_SM_EXPECTED_OP_QUEUE_BITS)
+
+/* Max number of peer shared memory mappings cached per address */
+#define NA_SM_MEM_MAP_CACHE_MAX 16
+
 /* Max number of peers */
 #define NA_SM_MAX_PEERS (NA_CONTEXT_ID_MAX + 1)
 
@@ -85,10 +104,6 @@
 #define NA_SM_ADDR_CMD_PUSHED (1 << 1)
 #define NA_SM_ADDR_RESOLVED   (1 << 2)
 
-/* Msg sizes */
-#define NA_SM_UNEXPECTED_SIZE NA_SM_COPY_BUF_SIZE
-#define NA_SM_EXPECTED_SIZE   NA_SM_UNEXPECTED_SIZE
-
 /* Max tag */
 #define NA_SM_MAX_TAG NA_TAG_MAX
 
@@ -105,6 +120,20 @@
 #define NA_SM_OP_QUEUED    (1 << 3)
 #define NA_SM_OP_ERRORED   (1 << 4)
 
+/* Mem handle describes memory that peers can map (not an access flag) */
+#define NA_SM_MEM_SHARED (1 << 7)
+
+/* Copy buffer pool access */
+#define NA_SM_COPY_BUF_AVAILABLE(__bufs, __word)                               \
+    (&(((union na_sm_cacheline_atomic_int64 *) ((char *) (__bufs) +           \
+           (__bufs)->available_offset))[__word]                                \
+            .val))
+#define NA_SM_COPY_BUF_MSG_SIZE(__bufs, __idx)                                 \
+    (((uint32_t *) ((char *) (__bufs) + (__bufs)->sizes_offset))[__idx])
+#define NA_SM_COPY_BUF(__bufs, __idx)                                          \
+    ((char *) (__bufs) + (__bufs)->bufs_offset +                               \
+        (size_t) (__idx) * (__bufs)->buf_size)
+
 /* Private data access */
 #define NA_SM_CLASS(na_class) ((struct na_sm_class *) (na_class->plugin_class))
 #define NA_SM_CONTEXT(context)                                                 \
@@ -154,6 +183,10 @@
 #define NA_SM_PRINT_SHM_NAME(str, size, uri)                                   \
     snprintf(str, size, NA_SM_SHM_PREFIX "-%s", uri)
 
+/* Generate SHM file name of memory allocated with NA_Mem_alloc() */
+#define NA_SM_PRINT_MEM_SHM_NAME(str, size, pid, id)                           \
+    snprintf(str, size, NA_SM_SHM_PREFIX "-%d-mem-%" PRIu32, pid, id)
+
 /* Generate socket path */
 #define NA_SM_PRINT_SOCK_PATH(str, size, uri)                                  \
     snprintf(str, size, NA_SM_TMP_DIRECTORY "/" NA_SM_SHM_PREFIX "-%s", uri);
@@ -176,10 +209,11 @@
 /* Msg header */
 NA_PACKED(union na_sm_msg_hdr {
     struct {
-        unsigned int tag : 32;      /* Message tag : UINT MAX */
-        unsigned int buf_size : 16; /* Buffer length: 4KB MAX */
-        unsigned int buf_idx : 8;   /* Index reserved: 64 MAX */
-        unsigned int type : 8;      /* Message type */
+        unsigned int tag : 32;     /* Message tag : UINT MAX */
+        unsigned int buf_idx : 16; /* Index reserved: 64K MAX */
+        unsigned int type : 8;     /* Message type */
+        unsigned int has_buf : 1;  /* Copy buffer reserved */
+        unsigned int pad : 7;      /* 7 bits left */
     } hdr;
     uint64_t val;
 });
@@ -195,11 +229,20 @@ union na_sm_cacheline_atomic_int256 {
     char pad[NA_SM_CACHE_LINE_SIZE];
 };
 
-/* Msg buffers (page aligned) */
+/* Msg buffers (pool is laid out after the region, offsets are relative to
+ * this descriptor so that they remain valid in every process). Each 64-bit
+ * available bitmask holds the credits of a partition: the first
+ * partition_count ones are shared by queue pairs (pair index modulo
+ * partition_count), the remaining ones form an overflow pool. A buffer is
+ * owned by whoever cleared its bit and is handed over through the msg
+ * queue, which orders accesses to its content without any lock. */
 struct na_sm_copy_buf {
-    hg_thread_spin_t buf_locks[NA_SM_NUM_BUFS];    /* Locks on buffers */
-    char buf[NA_SM_NUM_BUFS][NA_SM_COPY_BUF_SIZE]; /* Array of buffers */
-    union na_sm_cacheline_atomic_int64 available;  /* Available bitmask */
+    size_t buf_size;              /* Size of each buffer (page aligned) */
+    size_t available_offset;      /* Available bitmasks (one per line) */
+    size_t sizes_offset;          /* Size of msg stored in each buffer */
+    size_t bufs_offset;           /* Array of buffers (page aligned) */
+    unsigned int buf_count;       /* Number of buffers */
+    unsigned int partition_count; /* Number of per-pair partitions */
 };
 
 /* Msg queue (allocate queue's flexible array member statically) */
@@ -213,7 +256,9 @@ struct na_sm_msg_queue {
     hg_atomic_int32_t cons_tail;
     unsigned int cons_size;
     unsigned int cons_mask;
-    NA_ALIGNED(hg_atomic_int64_t ring[NA_SM_NUM_BUFS], HG_MEM_CACHE_LINE_SIZE);
+    hg_atomic_int32_t cons_waiting; /* Consumer may block (notify it) */
+    NA_ALIGNED(
+        hg_atomic_int64_t ring[NA_SM_MSG_QUEUE_SIZE], HG_MEM_CACHE_LINE_SIZE);
 };
 
 /* Shared queue pair */
@@ -262,6 +307,7 @@ struct na_sm_addr_key {
 /* Shared region */
 struct na_sm_region {
     struct na_sm_addr_key addr_key;  /* Region IDs */
+    size_t size;                     /* Size of region and buffer pool */
     struct na_sm_copy_buf copy_bufs; /* Pool of msg buffers */
     NA_ALIGNED(struct na_sm_queue_pair queue_pairs[NA_SM_MAX_PEERS],
         NA_SM_PAGE_SIZE);                          /* Msg queue pairs */
@@ -276,6 +322,23 @@ enum na_sm_poll_type {
     NA_SM_POLL_TX_NOTIFY
 };
 
+/* Mapping of peer shared memory */
+struct na_sm_mem_map {
+    void *base;        /* Local address of mapping */
+    void *remote_base; /* Address of memory in owner */
+    size_t size;       /* Size of mapping */
+    pid_t pid;         /* Owner PID */
+    uint32_t id;       /* Owner allocation ID */
+};
+
+/* Cache of peer shared memory mappings */
+struct na_sm_mem_map_cache {
+    struct na_sm_mem_map maps[NA_SM_MEM_MAP_CACHE_MAX]; /* Mappings */
+    hg_thread_rwlock_t lock;                            /* Cache lock */
+    unsigned int count;                                 /* Mapping count */
+    unsigned int next;                                  /* Next to evict */
+};
+
 /* Address */
 struct na_sm_addr {
     hg_thread_mutex_t resolve_lock;     /* Lock to resolve address */
@@ -290,6 +353,7 @@ struct na_sm_addr {
     int rx_notify;                      /* Notify fd for rx queue */
     enum na_sm_poll_type tx_poll_type;  /* Tx poll type */
     enum na_sm_poll_type rx_poll_type;  /* Rx poll type */
+    struct na_sm_mem_map_cache maps;    /* Peer memory mappings */
     hg_atomic_int32_t refcount;         /* Ref count */
     hg_atomic_int32_t status;           /* Status bits */
     uint8_t queue_pair_idx;             /* Shared queue pair index */
@@ -315,6 +379,27 @@ struct na_sm_mem_desc_info {
     uint8_t flags;        /* Flag of operation access */
 };
 
+/* Shared memory info, only valid if NA_SM_MEM_SHARED is set */
+struct na_sm_mem_shared_info {
+    void *base;  /* Address of allocation in owner */
+    size_t size; /* Size of allocation */
+    pid_t pid;   /* Owner PID */
+    uint32_t id; /* Owner allocation ID */
+};
+
+/* Memory allocated with NA_Mem_alloc() */
+struct na_sm_mem_alloc {
+    LIST_ENTRY(na_sm_mem_alloc) entry; /* Entry in alloc list */
+    struct na_sm_mem_shared_info info; /* Shared memory info */
+    char name[NA_SM_MAX_FILENAME];     /* SHM file name */
+};
+
+/* Allocation list */
+struct na_sm_mem_alloc_list {
+    LIST_HEAD(, na_sm_mem_alloc) list;
+    hg_thread_rwlock_t lock;
+};
+
 /* IOV descriptor */
 union na_sm_iov {
     struct iovec s[NA_SM_IOV_STATIC_MAX]; /* Single segment */
@@ -323,8 +408,9 @@ union na_sm_iov {
 
 /* Memory handle */
 struct na_sm_mem_handle {
-    struct na_sm_mem_desc_info info; /* Segment info */
-    union na_sm_iov iov;             /* Remain last */
+    struct na_sm_mem_desc_info info;     /* Segment info */
+    struct na_sm_mem_shared_info shared; /* Shared memory info */
+    union na_sm_iov iov;                 /* Remain last */
 };
 
 /* Msg info */
@@ -382,7 +468,8 @@ struct na_sm_endpoint {
     struct na_sm_unexpected_msg_queue
         unexpected_msg_queue;                  /* Unexpected msg queue */
     struct na_sm_op_queue unexpected_op_queue; /* Unexpected op queue */
-    struct na_sm_op_queue expected_op_queue;   /* Expected op queue */
+    struct na_sm_op_queue
+        expected_op_queues[NA_SM_EXPECTED_OP_QUEUE_COUNT]; /* Expected ops */
     struct na_sm_op_queue retry_op_queue;      /* Retry op queue */
     struct na_sm_addr_list poll_addr_list;     /* List of addresses to poll */
     struct na_sm_addr *source_addr;            /* Source addr */
@@ -390,6 +477,11 @@ struct na_sm_endpoint {
     int sock;                                  /* Sock fd */
     enum na_sm_poll_type sock_poll_type;       /* Sock poll type */
     hg_atomic_int32_t nofile;                  /* Number of opened fds */
+    hg_atomic_int64_t *retry_count;            /* Number of op retries */
+    hg_atomic_int64_t *notify_count;           /* Notifications sent */
+    hg_atomic_int64_t *notify_skip_count;      /* Notifications skipped */
+    hg_thread_key_t wait_key;                  /* Wait armed by thread */
+    hg_atomic_int32_t waiters;                 /* Threads that may block */
     uint32_t nofile_max;                       /* Max number of fds */
     bool listen;                               /* Listen on sock */
 };
@@ -401,9 +493,11 @@ struct na_sm_context {
 
 /* Private data */
 struct na_sm_class {
-    struct na_sm_endpoint endpoint; /* Endpoint */
-    size_t iov_max;                 /* Max number of IOVs */
-    uint8_t context_max;            /* Max number of contexts */
+    struct na_sm_endpoint endpoint;         /* Endpoint */
+    struct na_sm_mem_alloc_list mem_allocs; /* Shared memory allocations */
+    size_t iov_max;                         /* Max number of IOVs */
+    size_t msg_size_max;                    /* Max size of eager msgs */
+    uint8_t context_max;                    /* Max number of contexts */
 };
 
 /********************/
@@ -501,6 +595,13 @@ na_sm_addr_key_hash(hg_hash_table_key_t key);
 static NA_INLINE int
 na_sm_addr_key_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2);
 
+/**
+ * Get expected op queue that addr/tag pair hashes to.
+ */
+static NA_INLINE struct na_sm_op_queue *
+na_sm_expected_op_queue(struct na_sm_endpoint *na_sm_endpoint,
+    const struct na_sm_addr *na_sm_addr, na_tag_t tag);
+
 /**
  * Get SM address from string.
  */
@@ -509,10 +610,19 @@ na_sm_string_to_addr(
     const char *str, char *uri, size_t size, struct na_sm_addr_key *addr_key_p);
 
 /**
- * Open shared-memory region.
+ * Compute layout of copy buffer pool and return total size of region.
+ */
+static size_t
+na_sm_region_layout(
+    struct na_sm_copy_buf *copy_buf, size_t buf_size, unsigned int buf_count);
+
+/**
+ * Open shared-memory region. Buffer size and count are only used when
+ * creating the region, they are otherwise read from the existing region.
  */
 static na_return_t
-na_sm_region_open(const char *uri, bool create, struct na_sm_region **region_p);
+na_sm_region_open(const char *uri, bool create, size_t buf_size,
+    unsigned int buf_count, struct na_sm_region **region_p);
 
 /**
  * Close shared-memory region.
@@ -600,7 +710,8 @@ na_sm_poll_deregister(hg_poll_set_t *poll_set, int fd);
  */
 static na_return_t
 na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
-    bool listen, bool no_wait, uint32_t nofile_max);
+    bool listen, bool no_wait, size_t copy_buf_size,
+    unsigned int copy_buf_count, uint32_t nofile_max);
 
 /**
  * Close shared-memory endpoint.
@@ -716,7 +827,15 @@ na_sm_msg_send_post(struct na_sm_endpoint *na_sm_endpoint, na_cb_type_t cb_type,
  * Reserve shared buffer.
  */
 static NA_INLINE na_return_t
-na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int *index);
+na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf,
+    uint8_t queue_pair_idx, unsigned int *index);
+
+/**
+ * Reserve shared buffer from a given bitmask.
+ */
+static NA_INLINE na_return_t
+na_sm_buf_reserve_word(struct na_sm_copy_buf *na_sm_copy_buf,
+    unsigned int word, unsigned int *index);
 
 /**
  * Release shared buffer.
@@ -731,6 +850,12 @@ static NA_INLINE void
 na_sm_buf_copy_to(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index,
     const void *src, size_t n);
 
+/**
+ * Get size of msg stored in shared buffer.
+ */
+static NA_INLINE size_t
+na_sm_buf_get_size(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index);
+
 /**
  * Copy from shared buffer to dest.
  */
@@ -789,6 +914,45 @@ na_sm_process_vm_readv(pid_t pid, const struct iovec *local_iov,
     unsigned long liovcnt, const struct iovec *remote_iov,
     unsigned long riovcnt, size_t length);
 
+/**
+ * Copy from/to peer memory allocated with NA_Mem_alloc(), mapping it first if
+ * not already mapped.
+ */
+static na_return_t
+na_sm_mem_copy(struct na_sm_addr *na_sm_addr,
+    const struct na_sm_mem_shared_info *shared_info, na_cb_type_t cb_type,
+    const struct iovec *local_iov, unsigned long liovcnt,
+    const struct iovec *remote_iov, unsigned long riovcnt, size_t length);
+
+/**
+ * Check that segments are within shared memory allocation.
+ */
+static NA_INLINE bool
+na_sm_mem_iov_contained(const struct iovec *iov, unsigned long iovcnt,
+    const struct na_sm_mem_shared_info *shared_info);
+
+/**
+ * Get cached mapping of peer memory.
+ */
+static NA_INLINE struct na_sm_mem_map *
+na_sm_mem_map_find(struct na_sm_mem_map_cache *na_sm_mem_map_cache,
+    const struct na_sm_mem_shared_info *shared_info);
+
+/**
+ * Map peer memory and add mapping to cache, evicting the oldest mapping if
+ * cache is full.
+ */
+static na_return_t
+na_sm_mem_map_insert(struct na_sm_mem_map_cache *na_sm_mem_map_cache,
+    const struct na_sm_mem_shared_info *shared_info,
+    struct na_sm_mem_map **na_sm_mem_map_p);
+
+/**
+ * Unmap all cached mappings.
+ */
+static void
+na_sm_mem_map_cache_clear(struct na_sm_mem_map_cache *na_sm_mem_map_cache);
+
 /**
  * Poll waiting for timeout milliseconds.
  */
@@ -803,6 +967,33 @@ na_sm_progress_wait(na_context_t *context,
 static na_return_t
 na_sm_progress(struct na_sm_endpoint *na_sm_endpoint, unsigned int *count_p);
 
+/**
+ * Progress all rx queues without waiting for notifications.
+ */
+static na_return_t
+na_sm_progress_rx_queues(
+    struct na_sm_endpoint *na_sm_endpoint, unsigned int *count_p);
+
+/**
+ * Register the calling thread as a waiter so that peers notify us.
+ * Returns false (and unregisters) if a message arrived in the meantime.
+ */
+static bool
+na_sm_wait_enter(struct na_sm_endpoint *na_sm_endpoint);
+
+/**
+ * Unregister a waiter, must follow a successful na_sm_wait_enter() from the
+ * same thread. Peers stop notifying us once there is no waiter left.
+ */
+static void
+na_sm_wait_exit(struct na_sm_endpoint *na_sm_endpoint);
+
+/**
+ * Release the wait armed by the calling thread from na_sm_poll_try_wait().
+ */
+static NA_INLINE void
+na_sm_wait_release(struct na_sm_endpoint *na_sm_endpoint);
+
 /**
  * Progress on endpoint sock.
  */
@@ -1007,6 +1198,15 @@ na_sm_msg_recv_expected(na_class_t *na_class, na_context_t *context,
     na_cb_t callback, void *arg, void *buf, size_t buf_size, void *plugin_data,
     na_addr_t *source_addr, uint8_t source_id, na_tag_t tag, na_op_id_t *op_id);
 
+/* mem_alloc */
+static void *
+na_sm_mem_alloc(na_class_t *na_class, size_t buf_size, unsigned long flags,
+    void **plugin_data_p);
+
+/* mem_free */
+static void
+na_sm_mem_free(na_class_t *na_class, void *buf, void *plugin_data);
+
 /* mem_handle_create */
 static na_return_t
 na_sm_mem_handle_create(na_class_t *na_class, void *buf, size_t buf_size,
@@ -1028,6 +1228,15 @@ na_sm_mem_handle_free(na_class_t *na_class, na_mem_handle_t *mem_handle);
 static size_t
 na_sm_mem_handle_get_max_segments(const na_class_t *na_class);
 
+/* mem_register */
+static na_return_t
+na_sm_mem_register(na_class_t *na_class, na_mem_handle_t *mem_handle,
+    enum na_mem_type mem_type, uint64_t device);
+
+/* mem_deregister */
+static na_return_t
+na_sm_mem_deregister(na_class_t *na_class, na_mem_handle_t *mem_handle);
+
 /* mem_handle_get_serialize_size */
 static NA_INLINE size_t
 na_sm_mem_handle_get_serialize_size(
@@ -1129,8 +1338,8 @@ const struct na_class_ops NA_PLUGIN_OPS(sm) = {
 #endif
     na_sm_mem_handle_free,               /* mem_handle_free */
     na_sm_mem_handle_get_max_segments,   /* mem_handle_get_max_segments */
-    NULL,                                /* mem_register */
-    NULL,                                /* mem_deregister */
+    na_sm_mem_register,                  /* mem_register */
+    na_sm_mem_deregister,                /* mem_deregister */
     na_sm_mem_handle_get_serialize_size, /* mem_handle_get_serialize_size */
     na_sm_mem_handle_serialize,          /* mem_handle_serialize */
     na_sm_mem_handle_deserialize,        /* mem_handle_deserialize */
@@ -1140,7 +1349,9 @@ const struct na_class_ops NA_PLUGIN_OPS(sm) = {
     na_sm_poll_try_wait,                 /* poll_try_wait */
     na_sm_poll,                          /* poll */
     na_sm_poll_wait,                     /* poll_wait */
-    na_sm_cancel                         /* cancel */
+    na_sm_cancel,                        /* cancel */
+    na_sm_mem_alloc,                     /* mem_alloc */
+    na_sm_mem_free                       /* mem_free */
 };
 
 /********************/
@@ -1407,7 +1618,7 @@ na_sm_shm_cleanup(const char *fpath, const struct stat NA_UNUSED *sb,
 static void
 na_sm_msg_queue_init(struct na_sm_msg_queue *na_sm_queue)
 {
-    unsigned int count = NA_SM_NUM_BUFS;
+    unsigned int count = NA_SM_MSG_QUEUE_SIZE;
 
     na_sm_queue->prod_size = na_sm_queue->cons_size = count;
     na_sm_queue->prod_mask = na_sm_queue->cons_mask = count - 1;
@@ -1415,6 +1626,7 @@ na_sm_msg_queue_init(struct na_sm_msg_queue *na_sm_queue)
     hg_atomic_init32(&na_sm_queue->cons_head, 0);
     hg_atomic_init32(&na_sm_queue->prod_tail, 0);
     hg_atomic_init32(&na_sm_queue->cons_tail, 0);
+    hg_atomic_init32(&na_sm_queue->cons_waiting, 0);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1595,6 +1807,19 @@ na_sm_addr_key_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2)
     return (addr_key1->pid == addr_key2->pid && addr_key1->id == addr_key2->id);
 }
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE struct na_sm_op_queue *
+na_sm_expected_op_queue(struct na_sm_endpoint *na_sm_endpoint,
+    const struct na_sm_addr *na_sm_addr, na_tag_t tag)
+{
+    /* Multiplicative hash, ops with same addr/tag always share a queue so
+     * that matching remains in posting order */
+    uint32_t key = (uint32_t) ((uintptr_t) na_sm_addr >> 4) ^ (uint32_t) tag;
+    uint32_t idx = (key * 0x9e3779b1U) >> (32 - NA_SM_EXPECTED_OP_QUEUE_BITS);
+
+    return &na_sm_endpoint->expected_op_queues[idx];
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_string_to_addr(
@@ -1624,12 +1849,46 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static size_t
+na_sm_region_layout(
+    struct na_sm_copy_buf *copy_buf, size_t buf_size, unsigned int buf_count)
+{
+    /* Pool follows the region, which is page aligned, offsets are first
+     * computed from the start of the region */
+    size_t base = offsetof(struct na_sm_region, copy_bufs);
+    size_t offset = sizeof(struct na_sm_region);
+
+    unsigned int word_count = buf_count / NA_SM_COPY_BUF_WORD_BITS;
+
+    copy_buf->buf_size = buf_size;
+    copy_buf->buf_count = buf_count;
+
+    /* Keep a quarter of the words as overflow pool, a single word is only
+     * used as overflow pool */
+    copy_buf->partition_count =
+        (word_count > 1) ? word_count - MAX(word_count / 4, 1) : 0;
+
+    copy_buf->available_offset = offset - base;
+    offset += word_count * sizeof(union na_sm_cacheline_atomic_int64);
+
+    copy_buf->sizes_offset = offset - base;
+    offset +=
+        NA_SM_ROUND_UP(buf_count * sizeof(uint32_t), NA_SM_CACHE_LINE_SIZE);
+
+    copy_buf->bufs_offset = NA_SM_ROUND_UP(offset, NA_SM_PAGE_SIZE) - base;
+
+    return base + copy_buf->bufs_offset + buf_count * buf_size;
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
-na_sm_region_open(const char *uri, bool create, struct na_sm_region **region_p)
+na_sm_region_open(const char *uri, bool create, size_t buf_size,
+    unsigned int buf_count, struct na_sm_region **region_p)
 {
     char filename[NA_SM_MAX_FILENAME];
     struct na_sm_region *na_sm_region = NULL;
+    size_t region_size = sizeof(struct na_sm_region);
     na_return_t ret = NA_SUCCESS;
     int rc;
 
@@ -1638,25 +1897,52 @@ na_sm_region_open(const char *uri, bool create, struct na_sm_region **region_p)
     NA_CHECK_SUBSYS_ERROR(cls, rc < 0 || rc > NA_SM_MAX_FILENAME, done, ret,
         NA_OVERFLOW, "NA_SM_PRINT_SHM_NAME() failed, rc: %d", rc);
 
-    /* Open SHM object */
-    NA_LOG_SUBSYS_DEBUG(cls, "shm_map() %s", filename);
-    na_sm_region = (struct na_sm_region *) na_sm_shm_map(
-        filename, sizeof(struct na_sm_region), create);
-    NA_CHECK_SUBSYS_ERROR(cls, na_sm_region == NULL, done, ret, NA_NODEV,
-        "Could not map new SM region (%s)", filename);
+    if (create) {
+        struct na_sm_copy_buf copy_buf;
+
+        region_size = na_sm_region_layout(&copy_buf, buf_size, buf_count);
+
+        /* Open SHM object */
+        NA_LOG_SUBSYS_DEBUG(cls, "shm_map() %s (%zu bytes)", filename,
+            region_size);
+        na_sm_region =
+            (struct na_sm_region *) na_sm_shm_map(filename, region_size, true);
+        NA_CHECK_SUBSYS_ERROR(cls, na_sm_region == NULL, done, ret, NA_NODEV,
+            "Could not map new SM region (%s)", filename);
+
+        na_sm_region->size = region_size;
+        na_sm_region->copy_bufs = copy_buf;
+    } else {
+        /* Map fixed part first to retrieve the size of the buffer pool */
+        NA_LOG_SUBSYS_DEBUG(cls, "shm_map() %s", filename);
+        na_sm_region =
+            (struct na_sm_region *) na_sm_shm_map(filename, region_size, false);
+        NA_CHECK_SUBSYS_ERROR(cls, na_sm_region == NULL, done, ret, NA_NODEV,
+            "Could not map SM region (%s)", filename);
+
+        region_size = na_sm_region->size;
+        ret = na_sm_shm_unmap(NULL, na_sm_region, sizeof(struct na_sm_region));
+        NA_CHECK_SUBSYS_NA_ERROR(cls, done, ret, "Could not unmap SM region");
+
+        NA_LOG_SUBSYS_DEBUG(cls, "shm_map() %s (%zu bytes)", filename,
+            region_size);
+        na_sm_region =
+            (struct na_sm_region *) na_sm_shm_map(filename, region_size, false);
+        NA_CHECK_SUBSYS_ERROR(cls, na_sm_region == NULL, done, ret, NA_NODEV,
+            "Could not map SM region (%s)", filename);
+    }
 
     if (create) {
-        int i;
+        struct na_sm_copy_buf *copy_bufs = &na_sm_region->copy_bufs;
+        unsigned int i;
 
-        /* Initialize copy buf (all buffers are available by default) */
-        hg_atomic_init64(
-            &na_sm_region->copy_bufs.available.val, ~((int64_t) 0));
-        memset(&na_sm_region->copy_bufs.buf, 0,
-            sizeof(na_sm_region->copy_bufs.buf));
+        /* Initialize copy bufs (all buffers are available by default) */
+        for (i = 0; i < buf_count / NA_SM_COPY_BUF_WORD_BITS; i++)
+            hg_atomic_init64(
+                NA_SM_COPY_BUF_AVAILABLE(copy_bufs, i), ~((int64_t) 0));
 
-        /* Initialize locks */
-        for (i = 0; i < NA_SM_NUM_BUFS; i++)
-            hg_thread_spin_init(&na_sm_region->copy_bufs.buf_locks[i]);
+        for (i = 0; i < buf_count; i++)
+            NA_SM_COPY_BUF_MSG_SIZE(copy_bufs, i) = 0;
 
         /* Initialize queue pairs */
         for (i = 0; i < 4; i++)
@@ -1695,7 +1981,7 @@ na_sm_region_close(const char *uri, struct na_sm_region *region)
 
     NA_LOG_SUBSYS_DEBUG(
         cls, "shm_unmap() %s", (filename_p == NULL) ? "is NULL" : filename_p);
-    ret = na_sm_shm_unmap(filename_p, region, sizeof(struct na_sm_region));
+    ret = na_sm_shm_unmap(filename_p, region, region->size);
     NA_CHECK_SUBSYS_NA_ERROR(cls, done, ret, "Could not unmap SM region (%s)",
         (filename_p == NULL) ? "is NULL" : filename_p);
 
@@ -2117,7 +2403,8 @@ done:
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
-    bool listen, bool no_wait, uint32_t nofile_max)
+    bool listen, bool no_wait, size_t copy_buf_size,
+    unsigned int copy_buf_count, uint32_t nofile_max)
 {
     static hg_atomic_int32_t sm_id_g = HG_ATOMIC_VAR_INIT(0);
     struct na_sm_addr_key addr_key = {0, 0};
@@ -2125,9 +2412,10 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
     char uri[NA_SM_MAX_FILENAME], *uri_p = NULL;
     uint8_t queue_pair_idx = 0;
     bool queue_pair_reserved = false, sock_registered = false,
-         tx_notify_registered = false;
+         tx_notify_registered = false, wait_key_created = false;
     int tx_notify = -1, rx_notify = -1;
     na_return_t ret = NA_SUCCESS, err_ret;
+    unsigned int i;
 
     /* Get PID */
     addr_key.pid = getpid();
@@ -2150,8 +2438,10 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
     TAILQ_INIT(&na_sm_endpoint->unexpected_op_queue.queue);
     hg_thread_spin_init(&na_sm_endpoint->unexpected_op_queue.lock);
 
-    TAILQ_INIT(&na_sm_endpoint->expected_op_queue.queue);
-    hg_thread_spin_init(&na_sm_endpoint->expected_op_queue.lock);
+    for (i = 0; i < NA_SM_EXPECTED_OP_QUEUE_COUNT; i++) {
+        TAILQ_INIT(&na_sm_endpoint->expected_op_queues[i].queue);
+        hg_thread_spin_init(&na_sm_endpoint->expected_op_queues[i].lock);
+    }
 
     TAILQ_INIT(&na_sm_endpoint->retry_op_queue.queue);
     hg_thread_spin_init(&na_sm_endpoint->retry_op_queue.lock);
@@ -2160,6 +2450,21 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
     hg_atomic_init32(&na_sm_endpoint->nofile, 0);
     na_sm_endpoint->nofile_max = nofile_max;
 
+    /* Ops retried because no copy buffer or queue entry was available */
+    HG_LOG_ADD_COUNTER64(na, &na_sm_endpoint->retry_count, "sm_retry_count",
+        "SM op retries");
+
+    /* Peers are only notified when they are about to block */
+    HG_LOG_ADD_COUNTER64(na, &na_sm_endpoint->notify_count,
+        "sm_notify_count", "SM notifications sent");
+    HG_LOG_ADD_COUNTER64(na, &na_sm_endpoint->notify_skip_count,
+        "sm_notify_skip_count", "SM notifications skipped");
+    hg_atomic_init32(&na_sm_endpoint->waiters, 0);
+    NA_CHECK_SUBSYS_ERROR(cls,
+        hg_thread_key_create(&na_sm_endpoint->wait_key) != HG_UTIL_SUCCESS,
+        error, ret, NA_NOMEM, "hg_thread_key_create() failed");
+    wait_key_created = true;
+
     /* Initialize poll addr list */
     LIST_INIT(&na_sm_endpoint->poll_addr_list.list);
     hg_thread_spin_init(&na_sm_endpoint->poll_addr_list.lock);
@@ -2195,7 +2500,8 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *name,
         uri_p = uri;
 
         /* If we're listening, create a new shm region using URI */
-        ret = na_sm_region_open(uri_p, true, &shared_region);
+        ret = na_sm_region_open(uri_p, true, copy_buf_size, copy_buf_count,
+            &shared_region);
         NA_CHECK_SUBSYS_NA_ERROR(
             cls, error, ret, "Could not open shared-memory region");
 
@@ -2342,9 +2648,12 @@ error:
 
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_msg_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_op_queue.lock);
-    hg_thread_spin_destroy(&na_sm_endpoint->expected_op_queue.lock);
+    for (i = 0; i < NA_SM_EXPECTED_OP_QUEUE_COUNT; i++)
+        hg_thread_spin_destroy(&na_sm_endpoint->expected_op_queues[i].lock);
     hg_thread_spin_destroy(&na_sm_endpoint->retry_op_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->poll_addr_list.lock);
+    if (wait_key_created)
+        (void) hg_thread_key_delete(na_sm_endpoint->wait_key);
 
     return ret;
 }
@@ -2355,6 +2664,7 @@ na_sm_endpoint_close(struct na_sm_endpoint *na_sm_endpoint)
 {
     struct na_sm_addr *source_addr = na_sm_endpoint->source_addr;
     na_return_t ret = NA_SUCCESS;
+    unsigned int i;
     bool empty;
 
     /* Check that poll addr list is empty */
@@ -2389,10 +2699,12 @@ na_sm_endpoint_close(struct na_sm_endpoint *na_sm_endpoint)
     NA_CHECK_SUBSYS_ERROR(cls, empty == false, done, ret, NA_BUSY,
         "Unexpected op queue should be empty");
 
-    /* Check that expected op queue is empty */
-    empty = TAILQ_EMPTY(&na_sm_endpoint->expected_op_queue.queue);
-    NA_CHECK_SUBSYS_ERROR(cls, empty == false, done, ret, NA_BUSY,
-        "Expected op queue should be empty");
+    /* Check that expected op queues are empty */
+    for (i = 0; i < NA_SM_EXPECTED_OP_QUEUE_COUNT; i++) {
+        empty = TAILQ_EMPTY(&na_sm_endpoint->expected_op_queues[i].queue);
+        NA_CHECK_SUBSYS_ERROR(cls, empty == false, done, ret, NA_BUSY,
+            "Expected op queue should be empty");
+    }
 
     /* Check that retry op queue is empty */
     empty = TAILQ_EMPTY(&na_sm_endpoint->retry_op_queue.queue);
@@ -2478,9 +2790,11 @@ na_sm_endpoint_close(struct na_sm_endpoint *na_sm_endpoint)
     /* Destroy mutexes */
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_msg_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_op_queue.lock);
-    hg_thread_spin_destroy(&na_sm_endpoint->expected_op_queue.lock);
+    for (i = 0; i < NA_SM_EXPECTED_OP_QUEUE_COUNT; i++)
+        hg_thread_spin_destroy(&na_sm_endpoint->expected_op_queues[i].lock);
     hg_thread_spin_destroy(&na_sm_endpoint->retry_op_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->poll_addr_list.lock);
+    (void) hg_thread_key_delete(na_sm_endpoint->wait_key);
 
 done:
     return ret;
@@ -2645,6 +2959,7 @@ na_sm_addr_create(struct na_sm_endpoint *na_sm_endpoint, const char *uri,
     hg_atomic_init32(&na_sm_addr->refcount, 1);
     hg_atomic_init32(&na_sm_addr->status, 0);
     hg_thread_mutex_init(&na_sm_addr->resolve_lock);
+    hg_thread_rwlock_init(&na_sm_addr->maps.lock);
 
     /* Keep a copy of the URI to open SHM/sock paths */
     if (uri) {
@@ -2685,6 +3000,8 @@ na_sm_addr_destroy(struct na_sm_addr *na_sm_addr)
             &na_sm_addr->endpoint->addr_map, &na_sm_addr->addr_key);
     }
 
+    na_sm_mem_map_cache_clear(&na_sm_addr->maps);
+    hg_thread_rwlock_destroy(&na_sm_addr->maps.lock);
     hg_thread_mutex_destroy(&na_sm_addr->resolve_lock);
     free(na_sm_addr->uri);
     free(na_sm_addr);
@@ -2739,7 +3056,7 @@ na_sm_addr_resolve(struct na_sm_addr *na_sm_addr)
     /* Open shm region */
     if (!na_sm_addr->shared_region) {
         ret = na_sm_region_open(
-            na_sm_addr->uri, false, &na_sm_addr->shared_region);
+            na_sm_addr->uri, false, 0, 0, &na_sm_addr->shared_region);
         NA_CHECK_SUBSYS_NA_ERROR(
             addr, error, ret, "Could not open shared-memory region");
     }
@@ -2822,9 +3139,12 @@ na_sm_addr_resolve(struct na_sm_addr *na_sm_addr)
 
     hg_atomic_or32(&na_sm_addr->status, NA_SM_ADDR_RESOLVED);
 
-    /* Add address to list of addresses to poll */
+    /* Add address to list of addresses to poll, peer must notify us if we
+     * are already blocked */
     hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
     LIST_INSERT_HEAD(&na_sm_endpoint->poll_addr_list.list, na_sm_addr, entry);
+    hg_atomic_or32(&na_sm_addr->rx_queue->cons_waiting,
+        hg_atomic_get32(&na_sm_endpoint->waiters) > 0);
     hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
 
     return NA_SUCCESS;
@@ -3085,8 +3405,8 @@ na_sm_msg_send(struct na_sm_class *na_sm_class, na_context_t *context,
 {
     na_return_t ret;
 
-    NA_CHECK_SUBSYS_ERROR(msg, buf_size > NA_SM_COPY_BUF_SIZE, error, ret,
-        NA_OVERFLOW, "Exceeds copy buf size, %zu", buf_size);
+    NA_CHECK_SUBSYS_ERROR(msg, buf_size > na_sm_class->msg_size_max, error,
+        ret, NA_OVERFLOW, "Exceeds copy buf size, %zu", buf_size);
 
     /* Check op_id */
     NA_CHECK_SUBSYS_ERROR(op, na_sm_op_id == NULL, error, ret, NA_INVALID_ARG,
@@ -3151,9 +3471,15 @@ na_sm_msg_send_post(struct na_sm_endpoint *na_sm_endpoint, na_cb_type_t cb_type,
 
     /* No need to reserve for 0-size messages */
     if (buf_size > 0) {
+        /* Peers are expected to use the same eager size */
+        NA_CHECK_SUBSYS_ERROR(msg,
+            buf_size > na_sm_addr->shared_region->copy_bufs.buf_size, error,
+            ret, NA_OVERFLOW, "Exceeds peer copy buf size (%zu > %zu)",
+            buf_size, na_sm_addr->shared_region->copy_bufs.buf_size);
+
         /* Try to reserve buffer atomically */
-        ret =
-            na_sm_buf_reserve(&na_sm_addr->shared_region->copy_bufs, &buf_idx);
+        ret = na_sm_buf_reserve(&na_sm_addr->shared_region->copy_bufs,
+            na_sm_addr->queue_pair_idx, &buf_idx);
         if (unlikely(ret == NA_AGAIN))
             return NA_AGAIN;
 
@@ -3164,24 +3490,35 @@ na_sm_msg_send_post(struct na_sm_endpoint *na_sm_endpoint, na_cb_type_t cb_type,
 
     /* Post message to queue */
     msg_hdr = (union na_sm_msg_hdr){.hdr.type = cb_type,
-        .hdr.buf_idx = buf_idx & 0xff,
-        .hdr.buf_size = buf_size & 0xffff,
+        .hdr.buf_idx = buf_idx & 0xffff,
+        .hdr.has_buf = buf_size > 0,
         .hdr.tag = tag};
 
     rc = na_sm_msg_queue_push(na_sm_addr->tx_queue, &msg_hdr);
     NA_CHECK_SUBSYS_ERROR(
         msg, rc == false, release, ret, NA_AGAIN, "Full queue");
 
+    /* Skip notification if peer is polling its rx queue. Both sides use
+     * read-modify-write operations on the flag so that they are ordered with
+     * the queue accesses: either the peer sees the message before blocking
+     * or we see that it may block (see na_sm_wait_enter()) */
+    if (hg_atomic_or32(&na_sm_addr->tx_queue->cons_waiting, 0) == 0) {
+        hg_atomic_incr64(na_sm_endpoint->notify_skip_count);
+        return NA_SUCCESS;
+    }
+
     /* Notify remote if notifications are enabled */
     if (na_sm_addr == na_sm_endpoint->source_addr &&
         na_sm_addr->rx_notify > 0) {
         int rc1 = hg_event_set(na_sm_addr->rx_notify);
         NA_CHECK_SUBSYS_ERROR(msg, rc1 != HG_UTIL_SUCCESS, release, ret,
             na_sm_errno_to_na(errno), "Could not send completion notification");
+        hg_atomic_incr64(na_sm_endpoint->notify_count);
     } else if (na_sm_addr->tx_notify > 0) {
         ret = na_sm_event_set(na_sm_addr->tx_notify);
         NA_CHECK_SUBSYS_NA_ERROR(
             msg, release, ret, "Could not send completion notification");
+        hg_atomic_incr64(na_sm_endpoint->notify_count);
     }
 
     return NA_SUCCESS;
@@ -3196,39 +3533,73 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE na_return_t
-na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int *index)
+na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf,
+    uint8_t queue_pair_idx, unsigned int *index)
 {
-    int64_t bits = (int64_t) 1;
-    unsigned int i = 0;
+    unsigned int word_count =
+        na_sm_copy_buf->buf_count / NA_SM_COPY_BUF_WORD_BITS;
+    unsigned int partition_count = na_sm_copy_buf->partition_count;
+    unsigned int overflow_count = word_count - partition_count;
+    unsigned int i;
+
+    /* Use credits from own partition first */
+    if (partition_count > 0 &&
+        na_sm_buf_reserve_word(na_sm_copy_buf,
+            queue_pair_idx % partition_count, index) == NA_SUCCESS)
+        return NA_SUCCESS;
 
-    do {
-        int64_t available = hg_atomic_get64(&na_sm_copy_buf->available.val);
-        if (!available) {
-            /* Nothing available */
-            break;
-        }
-        if ((available & bits) != bits) {
-            /* Already reserved */
-            hg_atomic_fence();
-            i++;
-            bits <<= 1;
+    /* Steal from overflow pool */
+    for (i = 0; i < overflow_count; i++)
+        if (na_sm_buf_reserve_word(na_sm_copy_buf,
+                partition_count + (queue_pair_idx + i) % overflow_count,
+                index) == NA_SUCCESS)
+            return NA_SUCCESS;
+
+    /* Steal from other partitions as a last resort */
+    for (i = 1; i < partition_count; i++)
+        if (na_sm_buf_reserve_word(na_sm_copy_buf,
+                (queue_pair_idx + i) % partition_count, index) == NA_SUCCESS)
+            return NA_SUCCESS;
+
+    return NA_AGAIN;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_return_t
+na_sm_buf_reserve_word(struct na_sm_copy_buf *na_sm_copy_buf,
+    unsigned int word, unsigned int *index)
+{
+    hg_atomic_int64_t *available_p =
+        NA_SM_COPY_BUF_AVAILABLE(na_sm_copy_buf, word);
+    uint64_t available;
+
+    while ((available = (uint64_t) hg_atomic_get64(available_p)) != 0) {
+        /* Pick lowest available bit */
+        uint64_t bits = available & (~available + 1);
+        unsigned int i;
+
+        /* Can't use atomic XOR directly, if there is a race and the cas
+         * fails, we should be able to pick the next one available */
+        if (!hg_atomic_cas64(available_p, (int64_t) available,
+                (int64_t) (available & ~bits)))
             continue;
-        }
 
-        if (hg_atomic_cas64(
-                &na_sm_copy_buf->available.val, available, available & ~bits)) {
+#if defined(__GNUC__)
+        i = (unsigned int) __builtin_ctzll(bits);
+#else
+        for (i = 0; (bits >> i) != 1; i++)
+            continue;
+#endif
+        *index = word * NA_SM_COPY_BUF_WORD_BITS + i;
 #ifdef NA_HAS_DEBUG
+        {
             char buf[65] = {'\0'};
-            available = hg_atomic_get64(&na_sm_copy_buf->available.val);
             NA_LOG_SUBSYS_DEBUG(msg, "Reserved bit index %u\n### Available: %s",
-                i, lltoa((uint64_t) available, buf, 2));
-#endif
-            *index = i;
-            return NA_SUCCESS;
+                *index, lltoa((uint64_t) hg_atomic_get64(available_p), buf, 2));
         }
-        /* Can't use atomic XOR directly, if there is a race and the cas
-         * fails, we should be able to pick the next one available */
-    } while (i < NA_SM_NUM_BUFS);
+#endif
+        return NA_SUCCESS;
+    }
 
     return NA_AGAIN;
 }
@@ -3237,7 +3608,10 @@ na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int *index)
 static NA_INLINE void
 na_sm_buf_release(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index)
 {
-    hg_atomic_or64(&na_sm_copy_buf->available.val, (int64_t) 1 << index);
+    unsigned int word = index / NA_SM_COPY_BUF_WORD_BITS;
+
+    hg_atomic_or64(NA_SM_COPY_BUF_AVAILABLE(na_sm_copy_buf, word),
+        (int64_t) 1 << (index % NA_SM_COPY_BUF_WORD_BITS));
     NA_LOG_SUBSYS_DEBUG(msg, "Released bit index %u", index);
 }
 
@@ -3246,9 +3620,16 @@ static NA_INLINE void
 na_sm_buf_copy_to(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index,
     const void *src, size_t n)
 {
-    hg_thread_spin_lock(&na_sm_copy_buf->buf_locks[index]);
-    memcpy(na_sm_copy_buf->buf[index], src, n);
-    hg_thread_spin_unlock(&na_sm_copy_buf->buf_locks[index]);
+    /* Buffer is owned until msg is pushed, no need to lock */
+    memcpy(NA_SM_COPY_BUF(na_sm_copy_buf, index), src, n);
+    NA_SM_COPY_BUF_MSG_SIZE(na_sm_copy_buf, index) = (uint32_t) n;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE size_t
+na_sm_buf_get_size(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index)
+{
+    return (size_t) NA_SM_COPY_BUF_MSG_SIZE(na_sm_copy_buf, index);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -3256,9 +3637,8 @@ static NA_INLINE void
 na_sm_buf_copy_from(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index,
     void *dest, size_t n)
 {
-    hg_thread_spin_lock(&na_sm_copy_buf->buf_locks[index]);
-    memcpy(dest, na_sm_copy_buf->buf[index], n);
-    hg_thread_spin_unlock(&na_sm_copy_buf->buf_locks[index]);
+    /* Buffer is owned until it is released, no need to lock */
+    memcpy(dest, NA_SM_COPY_BUF(na_sm_copy_buf, index), n);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -3283,11 +3663,13 @@ na_sm_rma(struct na_sm_class *na_sm_class, na_context_t *context,
     na_return_t ret;
 
 #if !defined(NA_SM_HAS_CMA) && !defined(__APPLE__)
-    NA_GOTO_SUBSYS_ERROR(
-        error, ret, NA_OPNOTSUPPORTED, "Not implemented for this platform");
+    /* Only memory allocated with NA_Mem_alloc() can be accessed */
+    NA_CHECK_SUBSYS_ERROR(rma,
+        !(na_sm_mem_handle_remote->info.flags & NA_SM_MEM_SHARED), error, ret,
+        NA_OPNOTSUPPORTED, "Not implemented for this platform");
 #endif
 
-    switch (na_sm_mem_handle_remote->info.flags) {
+    switch (na_sm_mem_handle_remote->info.flags & NA_MEM_READWRITE) {
         case NA_MEM_READ_ONLY:
             NA_CHECK_SUBSYS_ERROR(rma, cb_type == NA_CB_PUT, error, ret,
                 NA_PERMISSION, "Registered memory requires write permission");
@@ -3368,9 +3750,15 @@ na_sm_rma(struct na_sm_class *na_sm_class, na_context_t *context,
     NA_LOG_SUBSYS_DEBUG(rma, "Posting rma op (op id=%p)", (void *) na_sm_op_id);
 
     /* NB. addr does not need to be fully "resolved" to issue RMA */
-    ret = process_vm_op(
-        na_sm_addr->addr_key.pid, liov, liovcnt, riov, riovcnt, length);
-    NA_CHECK_SUBSYS_NA_ERROR(rma, release, ret, "process_vm_op() failed");
+    if (na_sm_mem_handle_remote->info.flags & NA_SM_MEM_SHARED) {
+        ret = na_sm_mem_copy(na_sm_addr, &na_sm_mem_handle_remote->shared,
+            cb_type, liov, liovcnt, riov, riovcnt, length);
+        NA_CHECK_SUBSYS_NA_ERROR(rma, release, ret, "na_sm_mem_copy() failed");
+    } else {
+        ret = process_vm_op(
+            na_sm_addr->addr_key.pid, liov, liovcnt, riov, riovcnt, length);
+        NA_CHECK_SUBSYS_NA_ERROR(rma, release, ret, "process_vm_op() failed");
+    }
 
     /* Free before adding to completion queue */
     if (liovcnt > NA_SM_IOV_STATIC_MAX &&
@@ -3622,6 +4010,190 @@ error:
 }
 #endif
 
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_mem_copy(struct na_sm_addr *na_sm_addr,
+    const struct na_sm_mem_shared_info *shared_info, na_cb_type_t cb_type,
+    const struct iovec *local_iov, unsigned long liovcnt,
+    const struct iovec *remote_iov, unsigned long riovcnt, size_t length)
+{
+    struct na_sm_mem_map_cache *na_sm_mem_map_cache = &na_sm_addr->maps;
+    struct na_sm_mem_map *na_sm_mem_map;
+    unsigned long i = 0, j = 0;
+    size_t local_off = 0, remote_off = 0;
+    bool wrlocked = false;
+    na_return_t ret = NA_SUCCESS;
+
+    /* Descriptors come from peers, do not trust them and only map memory
+     * that was allocated by the process that the address refers to */
+    NA_CHECK_SUBSYS_ERROR(rma, shared_info->pid != na_sm_addr->addr_key.pid,
+        error, ret, NA_INVALID_ARG,
+        "Shared memory of process %d does not belong to peer %d",
+        shared_info->pid, na_sm_addr->addr_key.pid);
+    NA_CHECK_SUBSYS_ERROR(rma,
+        !na_sm_mem_iov_contained(remote_iov, riovcnt, shared_info), error, ret,
+        NA_INVALID_ARG, "Remote segments exceed shared memory bounds");
+
+    /* Mappings are only unmapped under write lock, keep read lock while
+     * copying */
+    hg_thread_rwlock_rdlock(&na_sm_mem_map_cache->lock);
+    na_sm_mem_map = na_sm_mem_map_find(na_sm_mem_map_cache, shared_info);
+    if (na_sm_mem_map == NULL) {
+        hg_thread_rwlock_release_rdlock(&na_sm_mem_map_cache->lock);
+        hg_thread_rwlock_wrlock(&na_sm_mem_map_cache->lock);
+        wrlocked = true;
+
+        na_sm_mem_map = na_sm_mem_map_find(na_sm_mem_map_cache, shared_info);
+        if (na_sm_mem_map == NULL) {
+            ret = na_sm_mem_map_insert(
+                na_sm_mem_map_cache, shared_info, &na_sm_mem_map);
+            NA_CHECK_SUBSYS_NA_ERROR(
+                rma, unlock, ret, "Could not map peer memory");
+        }
+    }
+
+    while (length > 0 && i < liovcnt && j < riovcnt) {
+        size_t len = MIN(MIN(local_iov[i].iov_len - local_off,
+                             remote_iov[j].iov_len - remote_off),
+            length);
+        char *local_ptr = (char *) local_iov[i].iov_base + local_off;
+        char *remote_ptr = (char *) na_sm_mem_map->base +
+                           ((char *) remote_iov[j].iov_base -
+                               (char *) shared_info->base) +
+                           remote_off;
+
+        if (cb_type == NA_CB_PUT)
+            memcpy(remote_ptr, local_ptr, len);
+        else
+            memcpy(local_ptr, remote_ptr, len);
+
+        length -= len;
+        local_off += len;
+        remote_off += len;
+        if (local_off == local_iov[i].iov_len) {
+            i++;
+            local_off = 0;
+        }
+        if (remote_off == remote_iov[j].iov_len) {
+            j++;
+            remote_off = 0;
+        }
+    }
+
+unlock:
+    if (wrlocked)
+        hg_thread_rwlock_release_wrlock(&na_sm_mem_map_cache->lock);
+    else
+        hg_thread_rwlock_release_rdlock(&na_sm_mem_map_cache->lock);
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE bool
+na_sm_mem_iov_contained(const struct iovec *iov, unsigned long iovcnt,
+    const struct na_sm_mem_shared_info *shared_info)
+{
+    uintptr_t base = (uintptr_t) shared_info->base;
+    unsigned long i;
+
+    for (i = 0; i < iovcnt; i++) {
+        uintptr_t start = (uintptr_t) iov[i].iov_base;
+
+        if (start < base || start - base > shared_info->size ||
+            iov[i].iov_len > shared_info->size - (start - base))
+            return false;
+    }
+
+    return true;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE struct na_sm_mem_map *
+na_sm_mem_map_find(struct na_sm_mem_map_cache *na_sm_mem_map_cache,
+    const struct na_sm_mem_shared_info *shared_info)
+{
+    unsigned int i;
+
+    for (i = 0; i < na_sm_mem_map_cache->count; i++) {
+        struct na_sm_mem_map *na_sm_mem_map = &na_sm_mem_map_cache->maps[i];
+
+        if (na_sm_mem_map->id == shared_info->id &&
+            na_sm_mem_map->pid == shared_info->pid &&
+            na_sm_mem_map->remote_base == shared_info->base &&
+            na_sm_mem_map->size == shared_info->size)
+            return na_sm_mem_map;
+    }
+
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_mem_map_insert(struct na_sm_mem_map_cache *na_sm_mem_map_cache,
+    const struct na_sm_mem_shared_info *shared_info,
+    struct na_sm_mem_map **na_sm_mem_map_p)
+{
+    char name[NA_SM_MAX_FILENAME];
+    struct na_sm_mem_map *na_sm_mem_map;
+    void *base;
+    na_return_t ret;
+    int rc;
+
+    rc = NA_SM_PRINT_MEM_SHM_NAME(
+        name, NA_SM_MAX_FILENAME, shared_info->pid, shared_info->id);
+    NA_CHECK_SUBSYS_ERROR(rma, rc < 0 || rc > NA_SM_MAX_FILENAME, error, ret,
+        NA_OVERFLOW, "NA_SM_PRINT_MEM_SHM_NAME() failed, rc: %d", rc);
+
+    base = na_sm_shm_map(name, shared_info->size, false);
+    NA_CHECK_SUBSYS_ERROR(rma, base == NULL, error, ret, NA_NODEV,
+        "Could not map shared memory %s", name);
+
+    if (na_sm_mem_map_cache->count < NA_SM_MEM_MAP_CACHE_MAX)
+        na_sm_mem_map =
+            &na_sm_mem_map_cache->maps[na_sm_mem_map_cache->count++];
+    else {
+        /* Evict oldest mapping */
+        na_sm_mem_map = &na_sm_mem_map_cache->maps[na_sm_mem_map_cache->next];
+        na_sm_mem_map_cache->next =
+            (na_sm_mem_map_cache->next + 1) % NA_SM_MEM_MAP_CACHE_MAX;
+
+        NA_LOG_SUBSYS_DEBUG(rma, "Evicting mapping of %d/%" PRIu32,
+            na_sm_mem_map->pid, na_sm_mem_map->id);
+        (void) na_sm_shm_unmap(NULL, na_sm_mem_map->base, na_sm_mem_map->size);
+    }
+
+    NA_LOG_SUBSYS_DEBUG(
+        rma, "Mapped %s (%zu bytes) at %p", name, shared_info->size, base);
+
+    *na_sm_mem_map = (struct na_sm_mem_map){.base = base,
+        .remote_base = shared_info->base,
+        .size = shared_info->size,
+        .pid = shared_info->pid,
+        .id = shared_info->id};
+    *na_sm_mem_map_p = na_sm_mem_map;
+
+    return NA_SUCCESS;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_mem_map_cache_clear(struct na_sm_mem_map_cache *na_sm_mem_map_cache)
+{
+    unsigned int i;
+
+    for (i = 0; i < na_sm_mem_map_cache->count; i++)
+        (void) na_sm_shm_unmap(NULL, na_sm_mem_map_cache->maps[i].base,
+            na_sm_mem_map_cache->maps[i].size);
+
+    na_sm_mem_map_cache->count = 0;
+    na_sm_mem_map_cache->next = 0;
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_progress_wait(na_context_t *context,
@@ -3630,14 +4202,27 @@ na_sm_progress_wait(na_context_t *context,
 {
     struct hg_poll_event *events = NA_SM_CONTEXT(context)->events;
     unsigned int nevents = 0, count = 0, i;
+    bool waiting = false;
     na_return_t ret;
     int rc;
 
+    /* This thread is progressing again, it no longer waits on our fd */
+    na_sm_wait_release(na_sm_endpoint);
+
+    /* Peers only notify us if we are about to block */
+    if (timeout > 0) {
+        waiting = na_sm_wait_enter(na_sm_endpoint);
+        if (!waiting)
+            timeout = 0;
+    }
+
     /* Just wait on a single event, anything greater may increase
      * latency, and slow down progress, we will not wait next round
      * if something is still in the queues */
     rc = hg_poll_wait(
         na_sm_endpoint->poll_set, timeout, NA_SM_MAX_EVENTS, events, &nevents);
+    if (waiting)
+        na_sm_wait_exit(na_sm_endpoint);
     NA_CHECK_SUBSYS_ERROR(poll, rc != HG_UTIL_SUCCESS, error, ret,
         na_sm_errno_to_na(errno), "hg_poll_wait() failed");
 
@@ -3691,6 +4276,10 @@ na_sm_progress_wait(na_context_t *context,
         count += (unsigned int) (progressed_rx | progressed_notify);
     }
 
+    /* Notifications are skipped while we poll, look at rx queues directly */
+    ret = na_sm_progress_rx_queues(na_sm_endpoint, &count);
+    NA_CHECK_SUBSYS_NA_ERROR(poll, error, ret, "Could not progress rx queues");
+
     *count_p = count;
 
     return NA_SUCCESS;
@@ -3702,13 +4291,40 @@ error:
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_progress(struct na_sm_endpoint *na_sm_endpoint, unsigned int *count_p)
+{
+    unsigned int count = 0;
+    na_return_t ret;
+
+    /* Check whether something is in one of the rx queues */
+    ret = na_sm_progress_rx_queues(na_sm_endpoint, &count);
+    NA_CHECK_SUBSYS_NA_ERROR(poll, done, ret, "Could not progress rx queues");
+
+    /* Look for message in cmd queue (if listening) */
+    if (na_sm_endpoint->source_addr->shared_region) {
+        bool progressed_cmd = false;
+
+        ret = na_sm_progress_cmd_queue(na_sm_endpoint, &progressed_cmd);
+        NA_CHECK_SUBSYS_NA_ERROR(
+            poll, done, ret, "Could not progress cmd queue");
+        count += (unsigned int) progressed_cmd;
+    }
+
+    *count_p = count;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_progress_rx_queues(
+    struct na_sm_endpoint *na_sm_endpoint, unsigned int *count_p)
 {
     struct na_sm_addr_list *poll_addr_list = &na_sm_endpoint->poll_addr_list;
     struct na_sm_addr *poll_addr;
     unsigned int count = 0;
     na_return_t ret = NA_SUCCESS;
 
-    /* Check whether something is in one of the rx queues */
     hg_thread_spin_lock(&poll_addr_list->lock);
     LIST_FOREACH (poll_addr, &poll_addr_list->list, entry) {
         bool progressed_rx = false;
@@ -3725,20 +4341,67 @@ na_sm_progress(struct na_sm_endpoint *na_sm_endpoint, unsigned int *count_p)
     }
     hg_thread_spin_unlock(&poll_addr_list->lock);
 
-    /* Look for message in cmd queue (if listening) */
-    if (na_sm_endpoint->source_addr->shared_region) {
-        bool progressed_cmd = false;
+    *count_p += count;
 
-        ret = na_sm_progress_cmd_queue(na_sm_endpoint, &progressed_cmd);
-        NA_CHECK_SUBSYS_NA_ERROR(
-            poll, done, ret, "Could not progress cmd queue");
-        count += (unsigned int) progressed_cmd;
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static bool
+na_sm_wait_enter(struct na_sm_endpoint *na_sm_endpoint)
+{
+    struct na_sm_addr_list *poll_addr_list = &na_sm_endpoint->poll_addr_list;
+    struct na_sm_addr *poll_addr;
+    bool empty = true;
+
+    /* Flags are only raised by the first waiter, others are serialized
+     * behind it by the lock */
+    hg_thread_spin_lock(&poll_addr_list->lock);
+    if (hg_atomic_incr32(&na_sm_endpoint->waiters) == 1)
+        LIST_FOREACH (poll_addr, &poll_addr_list->list, entry)
+            hg_atomic_or32(&poll_addr->rx_queue->cons_waiting, 1);
+
+    /* Pairs with the read-modify-write of the flag in na_sm_msg_send_post(),
+     * a message pushed before peers could see the flag must be picked up */
+    LIST_FOREACH (poll_addr, &poll_addr_list->list, entry) {
+        if (!na_sm_msg_queue_is_empty(poll_addr->rx_queue)) {
+            empty = false;
+            break;
+        }
     }
+    hg_thread_spin_unlock(&poll_addr_list->lock);
 
-    *count_p = count;
+    if (!empty)
+        na_sm_wait_exit(na_sm_endpoint);
 
-done:
-    return ret;
+    return empty;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_wait_exit(struct na_sm_endpoint *na_sm_endpoint)
+{
+    struct na_sm_addr_list *poll_addr_list = &na_sm_endpoint->poll_addr_list;
+    struct na_sm_addr *poll_addr;
+
+    /* Other threads may still be blocked, only the last waiter clears */
+    hg_thread_spin_lock(&poll_addr_list->lock);
+    if (hg_atomic_decr32(&na_sm_endpoint->waiters) == 0)
+        LIST_FOREACH (poll_addr, &poll_addr_list->list, entry)
+            hg_atomic_set32(&poll_addr->rx_queue->cons_waiting, 0);
+    hg_thread_spin_unlock(&poll_addr_list->lock);
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE void
+na_sm_wait_release(struct na_sm_endpoint *na_sm_endpoint)
+{
+    if (hg_thread_getspecific(na_sm_endpoint->wait_key) == NULL)
+        return;
+
+    (void) hg_thread_setspecific(na_sm_endpoint->wait_key, NULL);
+    na_sm_wait_exit(na_sm_endpoint);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -3849,10 +4512,13 @@ na_sm_process_cmd(struct na_sm_endpoint *na_sm_endpoint,
             /* Unexpected addresses are always resolved */
             hg_atomic_or32(&na_sm_addr->status, NA_SM_ADDR_RESOLVED);
 
-            /* Add address to list of addresses to poll */
+            /* Add address to list of addresses to poll, peer must notify
+             * us if we are already blocked */
             hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
             LIST_INSERT_HEAD(
                 &na_sm_endpoint->poll_addr_list.list, na_sm_addr, entry);
+            hg_atomic_or32(&na_sm_addr->rx_queue->cons_waiting,
+                hg_atomic_get32(&na_sm_endpoint->waiters) > 0);
             hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
             break;
         }
@@ -3955,8 +4621,9 @@ na_sm_progress_rx_queue(struct na_sm_endpoint *na_sm_endpoint,
                 msg, done, ret, "Could not make progress on unexpected msg");
             break;
         case NA_CB_SEND_EXPECTED:
-            na_sm_process_expected(
-                &na_sm_endpoint->expected_op_queue, poll_addr, msg_hdr);
+            na_sm_process_expected(na_sm_expected_op_queue(na_sm_endpoint,
+                                       poll_addr, (na_tag_t) msg_hdr.hdr.tag),
+                poll_addr, msg_hdr);
             break;
         default:
             NA_GOTO_SUBSYS_ERROR(
@@ -3975,8 +4642,12 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
     struct na_sm_addr *poll_addr, union na_sm_msg_hdr msg_hdr,
     struct na_sm_unexpected_msg_queue *unexpected_msg_queue)
 {
+    struct na_sm_copy_buf *copy_bufs = &poll_addr->shared_region->copy_bufs;
     struct na_sm_unexpected_info *na_sm_unexpected_info = NULL;
     struct na_sm_op_id *na_sm_op_id = NULL;
+    size_t buf_size = (msg_hdr.hdr.has_buf)
+                          ? na_sm_buf_get_size(copy_bufs, msg_hdr.hdr.buf_idx)
+                          : 0;
     na_return_t ret = NA_SUCCESS;
 
     NA_LOG_SUBSYS_DEBUG(msg, "Processing unexpected msg");
@@ -3991,27 +4662,31 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
     hg_thread_spin_unlock(&unexpected_op_queue->lock);
 
     if (likely(na_sm_op_id)) {
+        size_t copy_size = MIN(buf_size, na_sm_op_id->info.msg.buf_size);
+
         /* Fill info */
         na_sm_op_id->completion_data.callback_info.info.recv_unexpected =
             (struct na_cb_info_recv_unexpected){
                 .tag = (na_tag_t) msg_hdr.hdr.tag,
-                .actual_buf_size = (size_t) msg_hdr.hdr.buf_size,
+                .actual_buf_size = buf_size,
                 .source = (na_addr_t *) poll_addr};
         na_sm_addr_ref_incr(poll_addr);
 
-        if (msg_hdr.hdr.buf_size > 0) {
+        if (msg_hdr.hdr.has_buf) {
             /* Copy buffer */
-            na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
-                msg_hdr.hdr.buf_idx, na_sm_op_id->info.msg.buf.ptr,
-                msg_hdr.hdr.buf_size);
+            na_sm_buf_copy_from(copy_bufs, msg_hdr.hdr.buf_idx,
+                na_sm_op_id->info.msg.buf.ptr, copy_size);
 
             /* Release buffer */
-            na_sm_buf_release(
-                &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+            na_sm_buf_release(copy_bufs, msg_hdr.hdr.buf_idx);
         }
 
         /* Complete operation (no need to notify) */
-        na_sm_complete(na_sm_op_id, NA_SUCCESS);
+        NA_CHECK_SUBSYS_WARNING(msg, copy_size < buf_size,
+            "Msg truncated (%zu > %zu), peers must use the same eager size",
+            buf_size, copy_size);
+        na_sm_complete(
+            na_sm_op_id, (copy_size < buf_size) ? NA_MSGSIZE : NA_SUCCESS);
     } else {
         NA_LOG_SUBSYS_WARNING(
             perf, "No operation was preposted, data must be copied");
@@ -4024,7 +4699,7 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
             NA_NOMEM, "Could not allocate unexpected info");
 
         na_sm_unexpected_info->na_sm_addr = poll_addr;
-        na_sm_unexpected_info->buf_size = (size_t) msg_hdr.hdr.buf_size;
+        na_sm_unexpected_info->buf_size = buf_size;
         na_sm_unexpected_info->tag = (na_tag_t) msg_hdr.hdr.tag;
 
         if (na_sm_unexpected_info->buf_size > 0) {
@@ -4036,13 +4711,11 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
                 "Could not allocate na_sm_unexpected_info buf");
 
             /* Copy buffer */
-            na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
-                msg_hdr.hdr.buf_idx, na_sm_unexpected_info->buf,
-                msg_hdr.hdr.buf_size);
+            na_sm_buf_copy_from(copy_bufs, msg_hdr.hdr.buf_idx,
+                na_sm_unexpected_info->buf, buf_size);
 
             /* Release buffer */
-            na_sm_buf_release(
-                &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+            na_sm_buf_release(copy_bufs, msg_hdr.hdr.buf_idx);
         } else
             na_sm_unexpected_info->buf = NULL;
 
@@ -4067,7 +4740,9 @@ static void
 na_sm_process_expected(struct na_sm_op_queue *expected_op_queue,
     struct na_sm_addr *poll_addr, union na_sm_msg_hdr msg_hdr)
 {
+    struct na_sm_copy_buf *copy_bufs = &poll_addr->shared_region->copy_bufs;
     struct na_sm_op_id *na_sm_op_id = NULL;
+    size_t buf_size, copy_size;
 
     NA_LOG_SUBSYS_DEBUG(msg, "Processing expected msg");
 
@@ -4087,30 +4762,36 @@ na_sm_process_expected(struct na_sm_op_queue *expected_op_queue,
     if (na_sm_op_id == NULL) {
         NA_LOG_SUBSYS_WARNING(
             op, "No OP ID posted for that operation, dropping msg");
-        if (msg_hdr.hdr.buf_size > 0) {
+        if (msg_hdr.hdr.has_buf) {
             /* Release buffer */
-            na_sm_buf_release(
-                &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+            na_sm_buf_release(copy_bufs, msg_hdr.hdr.buf_idx);
         }
         return;
     }
 
+    buf_size = (msg_hdr.hdr.has_buf)
+                   ? na_sm_buf_get_size(copy_bufs, msg_hdr.hdr.buf_idx)
+                   : 0;
+    copy_size = MIN(buf_size, na_sm_op_id->info.msg.buf_size);
+
     na_sm_op_id->completion_data.callback_info.info.recv_expected
-        .actual_buf_size = msg_hdr.hdr.buf_size;
+        .actual_buf_size = buf_size;
 
-    if (msg_hdr.hdr.buf_size > 0) {
+    if (msg_hdr.hdr.has_buf) {
         /* Copy buffer */
-        na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
-            msg_hdr.hdr.buf_idx, na_sm_op_id->info.msg.buf.ptr,
-            msg_hdr.hdr.buf_size);
+        na_sm_buf_copy_from(copy_bufs, msg_hdr.hdr.buf_idx,
+            na_sm_op_id->info.msg.buf.ptr, copy_size);
 
         /* Release buffer */
-        na_sm_buf_release(
-            &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+        na_sm_buf_release(copy_bufs, msg_hdr.hdr.buf_idx);
     }
 
     /* Complete operation */
-    na_sm_complete(na_sm_op_id, NA_SUCCESS);
+    NA_CHECK_SUBSYS_WARNING(msg, copy_size < buf_size,
+        "Msg truncated (%zu > %zu), peers must use the same eager size",
+        buf_size, copy_size);
+    na_sm_complete(
+        na_sm_op_id, (copy_size < buf_size) ? NA_MSGSIZE : NA_SUCCESS);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -4197,6 +4878,8 @@ na_sm_op_retry(struct na_sm_class *na_sm_class, struct na_sm_op_id *na_sm_op_id)
     NA_LOG_SUBSYS_DEBUG(op, "Pushing %p for retry (%s)", (void *) na_sm_op_id,
         na_cb_type_to_string(na_sm_op_id->completion_data.callback_info.type));
 
+    hg_atomic_incr64(na_sm_class->endpoint.retry_count);
+
     /* Push op ID to retry queue */
     hg_thread_spin_lock(&retry_op_queue->lock);
     TAILQ_INSERT_TAIL(&retry_op_queue->queue, na_sm_op_id, entry);
@@ -4292,10 +4975,34 @@ na_sm_initialize(
 {
     const struct na_init_info *na_init_info = &na_info->na_init_info;
     struct na_sm_class *na_sm_class = NULL;
+    size_t copy_buf_size = MAX(
+        na_init_info->max_unexpected_size, na_init_info->max_expected_size);
+    unsigned int copy_buf_count = na_init_info->msg_buf_count;
     struct rlimit rlimit;
     na_return_t ret;
     int rc;
 
+    /* Eager msgs are copied through page-aligned shared buffers */
+    if (copy_buf_size == 0)
+        copy_buf_size = NA_SM_COPY_BUF_SIZE_DEFAULT;
+    NA_CHECK_SUBSYS_ERROR(cls, copy_buf_size > NA_SM_COPY_BUF_SIZE_MAX, error,
+        ret, NA_OVERFLOW, "Max msg size exceeds max copy buf size (%zu > %d)",
+        copy_buf_size, NA_SM_COPY_BUF_SIZE_MAX);
+    copy_buf_size = NA_SM_ROUND_UP(copy_buf_size, NA_SM_PAGE_SIZE);
+
+    /* Buffers are reserved by words of 64 bits */
+    if (copy_buf_count == 0)
+        copy_buf_count = NA_SM_COPY_BUF_COUNT_DEFAULT;
+    NA_CHECK_SUBSYS_ERROR(cls, copy_buf_count > NA_SM_COPY_BUF_COUNT_MAX,
+        error, ret, NA_OVERFLOW,
+        "Msg buf count exceeds max copy buf count (%u > %d)", copy_buf_count,
+        NA_SM_COPY_BUF_COUNT_MAX);
+    copy_buf_count =
+        NA_SM_ROUND_UP(copy_buf_count, NA_SM_COPY_BUF_WORD_BITS);
+
+    NA_LOG_SUBSYS_DEBUG(cls, "Using %u copy buffers of %zu bytes",
+        copy_buf_count, copy_buf_size);
+
     /* Reset errno */
     errno = 0;
 
@@ -4311,6 +5018,8 @@ na_sm_initialize(
     na_sm_class = (struct na_sm_class *) calloc(1, sizeof(*na_sm_class));
     NA_CHECK_SUBSYS_ERROR(cls, na_sm_class == NULL, error, ret, NA_NOMEM,
         "Could not allocate SM private class");
+    LIST_INIT(&na_sm_class->mem_allocs.list);
+    hg_thread_rwlock_init(&na_sm_class->mem_allocs.lock);
 
 #ifdef NA_SM_HAS_CMA
     na_sm_class->iov_max = (size_t) sysconf(_SC_IOV_MAX);
@@ -4318,11 +5027,12 @@ na_sm_initialize(
     na_sm_class->iov_max = 1;
 #endif
     na_sm_class->context_max = na_init_info->max_contexts;
+    na_sm_class->msg_size_max = copy_buf_size;
 
     /* Open endpoint */
     ret = na_sm_endpoint_open(&na_sm_class->endpoint, na_info->host_name,
-        listen, na_init_info->progress_mode & NA_NO_BLOCK,
-        (uint32_t) rlimit.rlim_cur);
+        listen, na_init_info->progress_mode & NA_NO_BLOCK, copy_buf_size,
+        copy_buf_count, (uint32_t) rlimit.rlim_cur);
     NA_CHECK_SUBSYS_NA_ERROR(cls, error, ret, "Could not open endpoint");
 
     na_class->plugin_class = (void *) na_sm_class;
@@ -4330,7 +5040,10 @@ na_sm_initialize(
     return NA_SUCCESS;
 
 error:
-    free(na_sm_class);
+    if (na_sm_class) {
+        hg_thread_rwlock_destroy(&na_sm_class->mem_allocs.lock);
+        free(na_sm_class);
+    }
 
     return ret;
 }
@@ -4350,6 +5063,12 @@ na_sm_finalize(na_class_t *na_class)
     ret = na_sm_endpoint_close(&NA_SM_CLASS(na_class)->endpoint);
     NA_CHECK_SUBSYS_NA_ERROR(cls, done, ret, "Could not close endpoint");
 
+    /* Check that shared memory allocations have been freed */
+    NA_CHECK_SUBSYS_ERROR(cls,
+        !LIST_EMPTY(&NA_SM_CLASS(na_class)->mem_allocs.list), done, ret,
+        NA_BUSY, "Shared memory allocations should be freed");
+    hg_thread_rwlock_destroy(&NA_SM_CLASS(na_class)->mem_allocs.lock);
+
     free(na_class->plugin_class);
     na_class->plugin_class = NULL;
 
@@ -4648,16 +5367,16 @@ done:
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE size_t
-na_sm_msg_get_max_unexpected_size(const na_class_t NA_UNUSED *na_class)
+na_sm_msg_get_max_unexpected_size(const na_class_t *na_class)
 {
-    return NA_SM_UNEXPECTED_SIZE;
+    return NA_SM_CLASS(na_class)->msg_size_max;
 }
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE size_t
-na_sm_msg_get_max_expected_size(const na_class_t NA_UNUSED *na_class)
+na_sm_msg_get_max_expected_size(const na_class_t *na_class)
 {
-    return NA_SM_EXPECTED_SIZE;
+    return NA_SM_CLASS(na_class)->msg_size_max;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -4691,7 +5410,8 @@ na_sm_msg_recv_unexpected(na_class_t *na_class, na_context_t *context,
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
     na_return_t ret;
 
-    NA_CHECK_SUBSYS_ERROR(msg, buf_size > NA_SM_UNEXPECTED_SIZE, error, ret,
+    NA_CHECK_SUBSYS_ERROR(msg,
+        buf_size > NA_SM_CLASS(na_class)->msg_size_max, error, ret,
         NA_OVERFLOW, "Exceeds unexpected size, %zu", buf_size);
 
     /* Check op_id */
@@ -4716,6 +5436,8 @@ na_sm_msg_recv_unexpected(na_class_t *na_class, na_context_t *context,
     hg_thread_spin_unlock(&unexpected_msg_queue->lock);
 
     if (unlikely(na_sm_unexpected_info)) {
+        size_t copy_size = MIN(na_sm_unexpected_info->buf_size, buf_size);
+
         /* Fill unexpected info */
         na_sm_op_id->completion_data.callback_info.info.recv_unexpected =
             (struct na_cb_info_recv_unexpected){
@@ -4727,11 +5449,17 @@ na_sm_msg_recv_unexpected(na_class_t *na_class, na_context_t *context,
         if (na_sm_unexpected_info->buf_size > 0) {
             /* Copy buffers */
             memcpy(na_sm_op_id->info.msg.buf.ptr, na_sm_unexpected_info->buf,
-                na_sm_unexpected_info->buf_size);
+                copy_size);
             free(na_sm_unexpected_info->buf);
         }
+        NA_CHECK_SUBSYS_WARNING(msg,
+            copy_size < na_sm_unexpected_info->buf_size,
+            "Msg truncated (%zu > %zu), peers must use the same eager size",
+            na_sm_unexpected_info->buf_size, copy_size);
+        na_sm_complete(na_sm_op_id,
+            (copy_size < na_sm_unexpected_info->buf_size) ? NA_MSGSIZE
+                                                          : NA_SUCCESS);
         free(na_sm_unexpected_info);
-        na_sm_complete(na_sm_op_id, NA_SUCCESS);
 
         /* Notify local completion */
         na_sm_complete_signal(NA_SM_CLASS(na_class));
@@ -4776,13 +5504,14 @@ na_sm_msg_recv_expected(na_class_t *na_class, na_context_t *context,
     void NA_UNUSED *plugin_data, na_addr_t *source_addr,
     uint8_t NA_UNUSED source_id, na_tag_t tag, na_op_id_t *op_id)
 {
-    struct na_sm_op_queue *expected_op_queue =
-        &NA_SM_CLASS(na_class)->endpoint.expected_op_queue;
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
     struct na_sm_addr *na_sm_addr = (struct na_sm_addr *) source_addr;
+    struct na_sm_op_queue *expected_op_queue = na_sm_expected_op_queue(
+        &NA_SM_CLASS(na_class)->endpoint, na_sm_addr, tag);
     na_return_t ret;
 
-    NA_CHECK_SUBSYS_ERROR(msg, buf_size > NA_SM_EXPECTED_SIZE, error, ret,
+    NA_CHECK_SUBSYS_ERROR(msg,
+        buf_size > NA_SM_CLASS(na_class)->msg_size_max, error, ret,
         NA_OVERFLOW, "Exceeds expected size, %zu", buf_size);
 
     /* Check op_id */
@@ -4815,6 +5544,81 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static void *
+na_sm_mem_alloc(na_class_t *na_class, size_t buf_size,
+    unsigned long NA_UNUSED flags, void **plugin_data_p)
+{
+    static hg_atomic_int32_t mem_id_g = HG_ATOMIC_VAR_INIT(0);
+    struct na_sm_mem_alloc_list *na_sm_mem_alloc_list =
+        &NA_SM_CLASS(na_class)->mem_allocs;
+    struct na_sm_mem_alloc *na_sm_mem_alloc = NULL;
+    int rc;
+
+    na_sm_mem_alloc =
+        (struct na_sm_mem_alloc *) calloc(1, sizeof(*na_sm_mem_alloc));
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, na_sm_mem_alloc == NULL, error,
+        "Could not allocate NA SM mem alloc");
+
+    /* Back memory with a SHM file that peers can map */
+    na_sm_mem_alloc->info.pid = getpid();
+    na_sm_mem_alloc->info.id = (uint32_t) hg_atomic_incr32(&mem_id_g);
+    na_sm_mem_alloc->info.size = NA_SM_ROUND_UP(buf_size, NA_SM_PAGE_SIZE);
+
+    rc = NA_SM_PRINT_MEM_SHM_NAME(na_sm_mem_alloc->name, NA_SM_MAX_FILENAME,
+        na_sm_mem_alloc->info.pid, na_sm_mem_alloc->info.id);
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, rc < 0 || rc > NA_SM_MAX_FILENAME, error,
+        "NA_SM_PRINT_MEM_SHM_NAME() failed, rc: %d", rc);
+
+    na_sm_mem_alloc->info.base = na_sm_shm_map(
+        na_sm_mem_alloc->name, na_sm_mem_alloc->info.size, true);
+    NA_CHECK_SUBSYS_ERROR_NORET(mem, na_sm_mem_alloc->info.base == NULL, error,
+        "Could not map shared memory %s", na_sm_mem_alloc->name);
+
+    hg_thread_rwlock_wrlock(&na_sm_mem_alloc_list->lock);
+    LIST_INSERT_HEAD(&na_sm_mem_alloc_list->list, na_sm_mem_alloc, entry);
+    hg_thread_rwlock_release_wrlock(&na_sm_mem_alloc_list->lock);
+
+    *plugin_data_p = na_sm_mem_alloc;
+
+    return na_sm_mem_alloc->info.base;
+
+error:
+    free(na_sm_mem_alloc);
+
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_mem_free(na_class_t *na_class, void *buf, void *plugin_data)
+{
+    struct na_sm_mem_alloc_list *na_sm_mem_alloc_list =
+        &NA_SM_CLASS(na_class)->mem_allocs;
+    struct na_sm_mem_alloc *na_sm_mem_alloc =
+        (struct na_sm_mem_alloc *) plugin_data;
+    na_return_t ret;
+
+    NA_CHECK_SUBSYS_ERROR_NORET(mem,
+        na_sm_mem_alloc == NULL || na_sm_mem_alloc->info.base != buf, done,
+        "Invalid plugin data");
+
+    hg_thread_rwlock_wrlock(&na_sm_mem_alloc_list->lock);
+    LIST_REMOVE(na_sm_mem_alloc, entry);
+    hg_thread_rwlock_release_wrlock(&na_sm_mem_alloc_list->lock);
+
+    /* Peers that mapped that memory keep it alive until they unmap it */
+    ret = na_sm_shm_unmap(na_sm_mem_alloc->name, na_sm_mem_alloc->info.base,
+        na_sm_mem_alloc->info.size);
+    NA_CHECK_SUBSYS_WARNING(mem, ret != NA_SUCCESS,
+        "Could not unmap shared memory %s", na_sm_mem_alloc->name);
+
+    free(na_sm_mem_alloc);
+
+done:
+    return;
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_mem_handle_create(na_class_t NA_UNUSED *na_class, void *buf,
@@ -4920,6 +5724,50 @@ na_sm_mem_handle_get_max_segments(const na_class_t *na_class)
     return NA_SM_CLASS(na_class)->iov_max;
 }
 
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_mem_register(na_class_t *na_class, na_mem_handle_t *mem_handle,
+    enum na_mem_type mem_type, uint64_t NA_UNUSED device)
+{
+    struct na_sm_mem_alloc_list *na_sm_mem_alloc_list =
+        &NA_SM_CLASS(na_class)->mem_allocs;
+    struct na_sm_mem_handle *na_sm_mem_handle =
+        (struct na_sm_mem_handle *) mem_handle;
+    const struct iovec *iov = NA_SM_IOV(na_sm_mem_handle);
+    struct na_sm_mem_alloc *na_sm_mem_alloc;
+
+    if (mem_type != NA_MEM_TYPE_HOST)
+        return NA_SUCCESS;
+
+    /* Peers can directly map memory that was allocated with NA_Mem_alloc(),
+     * other memory is accessed through CMA */
+    hg_thread_rwlock_rdlock(&na_sm_mem_alloc_list->lock);
+    LIST_FOREACH (na_sm_mem_alloc, &na_sm_mem_alloc_list->list, entry) {
+        if (na_sm_mem_iov_contained(
+                iov, na_sm_mem_handle->info.iovcnt, &na_sm_mem_alloc->info)) {
+            na_sm_mem_handle->shared = na_sm_mem_alloc->info;
+            na_sm_mem_handle->info.flags |= NA_SM_MEM_SHARED;
+            break;
+        }
+    }
+    hg_thread_rwlock_release_rdlock(&na_sm_mem_alloc_list->lock);
+
+    return NA_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_mem_deregister(
+    na_class_t NA_UNUSED *na_class, na_mem_handle_t *mem_handle)
+{
+    struct na_sm_mem_handle *na_sm_mem_handle =
+        (struct na_sm_mem_handle *) mem_handle;
+
+    na_sm_mem_handle->info.flags &= (uint8_t) ~NA_SM_MEM_SHARED;
+
+    return NA_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE size_t
 na_sm_mem_handle_get_serialize_size(
@@ -4927,9 +5775,13 @@ na_sm_mem_handle_get_serialize_size(
 {
     struct na_sm_mem_handle *na_sm_mem_handle =
         (struct na_sm_mem_handle *) mem_handle;
+    size_t size = sizeof(na_sm_mem_handle->info) +
+                  na_sm_mem_handle->info.iovcnt * sizeof(struct iovec);
+
+    if (na_sm_mem_handle->info.flags & NA_SM_MEM_SHARED)
+        size += sizeof(na_sm_mem_handle->shared);
 
-    return sizeof(na_sm_mem_handle->info) +
-           na_sm_mem_handle->info.iovcnt * sizeof(struct iovec);
+    return size;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -4948,6 +5800,11 @@ na_sm_mem_handle_serialize(na_class_t NA_UNUSED *na_class, void *buf,
     NA_ENCODE(done, ret, buf_ptr, buf_size_left, &na_sm_mem_handle->info,
         struct na_sm_mem_desc_info);
 
+    /* Shared memory info */
+    if (na_sm_mem_handle->info.flags & NA_SM_MEM_SHARED)
+        NA_ENCODE(done, ret, buf_ptr, buf_size_left, &na_sm_mem_handle->shared,
+            struct na_sm_mem_shared_info);
+
     /* IOV */
     NA_ENCODE_ARRAY(done, ret, buf_ptr, buf_size_left, iov, struct iovec,
         na_sm_mem_handle->info.iovcnt);
@@ -4978,6 +5835,11 @@ na_sm_mem_handle_deserialize(na_class_t NA_UNUSED *na_class,
     NA_DECODE(error, ret, buf_ptr, buf_size_left, &na_sm_mem_handle->info,
         struct na_sm_mem_desc_info);
 
+    /* Shared memory info */
+    if (na_sm_mem_handle->info.flags & NA_SM_MEM_SHARED)
+        NA_DECODE(error, ret, buf_ptr, buf_size_left,
+            &na_sm_mem_handle->shared, struct na_sm_mem_shared_info);
+
     /* IOV */
     if (na_sm_mem_handle->info.iovcnt > NA_SM_IOV_STATIC_MAX) {
         /* Allocate IOV */
@@ -5077,6 +5939,18 @@ na_sm_poll_try_wait(na_class_t *na_class, na_context_t NA_UNUSED *context)
     if (!empty)
         return false;
 
+    if (!na_sm_endpoint->poll_set)
+        return true;
+
+    /* Caller may block on our fd, ask peers to notify us until this thread
+     * progresses again (see na_sm_progress_wait()). The wait is armed once
+     * per thread so that repeated queries do not add waiters */
+    if (hg_thread_getspecific(na_sm_endpoint->wait_key) != NULL)
+        return true;
+    if (!na_sm_wait_enter(na_sm_endpoint))
+        return false;
+    (void) hg_thread_setspecific(na_sm_endpoint->wait_key, na_sm_endpoint);
+
     return true;
 }
 
@@ -5190,8 +6064,10 @@ na_sm_cancel(
             op_queue = &NA_SM_CLASS(na_class)->endpoint.unexpected_op_queue;
             break;
         case NA_CB_RECV_EXPECTED:
-            /* Must remove op_id from unexpected op queue */
-            op_queue = &NA_SM_CLASS(na_class)->endpoint.expected_op_queue;
+            /* Must remove op_id from expected op queue */
+            op_queue =
+                na_sm_expected_op_queue(&NA_SM_CLASS(na_class)->endpoint,
+                    na_sm_op_id->addr, na_sm_op_id->info.msg.tag);
             break;
         case NA_CB_SEND_UNEXPECTED:
         case NA_CB_SEND_EXPECTED:
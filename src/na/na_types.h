@@ -77,7 +77,9 @@ struct na_init_info {
     size_t max_expected_size;
 
     /* Progress mode flag. Setting NA_NO_BLOCK will force busy-spin on progress
-     * and remove any wait/notification calls. */
+     * and remove any wait/notification calls. Setting NA_ADAPTIVE_POLL will
+     * busy-spin for a period adapted to recent event arrivals before blocking
+     * (HG progress only). */
     uint8_t progress_mode;
 
     /* Preferred address format. Default is NA_ADDR_UNSPEC. */
@@ -97,9 +99,27 @@ struct na_init_info {
 
     /* Preferred traffic class. Default is NA_TC_UNSPEC */
     enum na_traffic_class traffic_class;
+
+    /* Number of eager message buffers hint that can be passed to control the
+     * number of messages that can be in flight without retrying (currently
+     * used by the na+sm plugin). Default is 0 (plugin default). */
+    unsigned int msg_buf_count;
 };
 
 /* Previous versions of init info to keep compatiblity with older versions */
+struct na_init_info_5_0 {
+    const char *ip_subnet;
+    const char *auth_key;
+    size_t max_unexpected_size;
+    size_t max_expected_size;
+    uint8_t progress_mode;
+    enum na_addr_format addr_format;
+    uint8_t max_contexts;
+    uint8_t thread_mode;
+    bool request_mem_device;
+    enum na_traffic_class traffic_class;
+};
+
 struct na_init_info_4_0 {
     const char *ip_subnet;
     const char *auth_key;
@@ -250,8 +270,9 @@ typedef void (*na_cb_t)(const struct na_cb_info *callback_info);
 #define NA_MEM_READWRITE  0x03
 
 /* Progress modes */
-#define NA_NO_BLOCK 0x01 /*!< no blocking progress */
-#define NA_NO_RETRY 0x02 /*!< no retry of operations in progress */
+#define NA_NO_BLOCK      0x01 /*!< no blocking progress */
+#define NA_NO_RETRY      0x02 /*!< no retry of operations in progress */
+#define NA_ADAPTIVE_POLL 0x04 /*!< busy-poll adaptively before blocking */
 
 /* Thread modes (default is thread-safe) */
 #define NA_THREAD_MODE_SINGLE_CLS                                              \
@@ -272,7 +293,8 @@ typedef void (*na_cb_t)(const struct na_cb_info *callback_info);
         .max_contexts = 1,                                                     \
         .thread_mode = 0,                                                      \
         .request_mem_device = false,                                           \
-        .traffic_class = NA_TC_UNSPEC})
+        .traffic_class = NA_TC_UNSPEC,                                         \
+        .msg_buf_count = 0})
 
 /* NA init info initializer */
 #define NA_INIT_INFO_INITIALIZER_4_0                                           \
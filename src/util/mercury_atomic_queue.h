@@ -126,6 +126,20 @@ hg_atomic_queue_push(struct hg_atomic_queue *hg_atomic_queue, void *entry);
 static HG_UTIL_INLINE void *
 hg_atomic_queue_pop_mc(struct hg_atomic_queue *hg_atomic_queue);
 
+/**
+ * Pop up to \count entries from the queue (multi-consumer). Entries are
+ * reserved at once so that only a single compare-and-swap is required.
+ *
+ * \param hg_atomic_queue [IN/OUT]  pointer to queue
+ * \param entries [OUT]             array of popped objects
+ * \param count [IN]                maximum number of entries to pop
+ *
+ * \return Number of entries popped or 0 if queue is empty
+ */
+static HG_UTIL_INLINE unsigned int
+hg_atomic_queue_pop_mc_n(
+    struct hg_atomic_queue *hg_atomic_queue, void **entries, unsigned int count);
+
 /**
  * Pop an entry from the queue (single consumer).
  *
@@ -226,6 +240,50 @@ hg_atomic_queue_pop_mc(struct hg_atomic_queue *hg_atomic_queue)
     return entry;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE unsigned int
+hg_atomic_queue_pop_mc_n(
+    struct hg_atomic_queue *hg_atomic_queue, void **entries, unsigned int count)
+{
+    int32_t cons_head, cons_next;
+    unsigned int avail, i;
+
+    if (count == 0)
+        return 0;
+
+    do {
+        cons_head = hg_atomic_get32(&hg_atomic_queue->cons_head);
+        avail = ((unsigned int) hg_atomic_get32(&hg_atomic_queue->prod_tail) -
+                    (unsigned int) cons_head) &
+                hg_atomic_queue->cons_mask;
+        if (avail == 0)
+            return 0;
+        if (avail > count)
+            avail = count;
+        cons_next = (cons_head + (int32_t) avail) &
+                    (int32_t) hg_atomic_queue->cons_mask;
+    } while (
+        !hg_atomic_cas32(&hg_atomic_queue->cons_head, cons_head, cons_next));
+
+    for (i = 0; i < avail; i++)
+        entries[i] = (void *) hg_atomic_get64(
+            &hg_atomic_queue
+                 ->ring[((unsigned int) cons_head + i) &
+                        hg_atomic_queue->cons_mask]);
+
+    /*
+     * If there are other dequeues in progress
+     * that preceded us, we need to wait for them
+     * to complete
+     */
+    while (hg_atomic_get32(&hg_atomic_queue->cons_tail) != cons_head)
+        cpu_spinwait();
+
+    hg_atomic_set32(&hg_atomic_queue->cons_tail, cons_next);
+
+    return avail;
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_UTIL_INLINE void *
 hg_atomic_queue_pop_sc(struct hg_atomic_queue *hg_atomic_queue)